@@ -160,6 +160,22 @@
  * }
  * ~~~~~~~~~~~~~~~~~~~~~~~~
  *
+ * Lock-free message queues
+ * ------------------------
+ * By default, sending a message disables interrupts for the whole thread
+ * lookup and enqueue operation. If the optional `core_msg_lockfree` module is
+ * used, the message queue of a thread is operated as a lock-free
+ * multi-producer single-consumer ring instead: @ref msg_try_send() and
+ * @ref msg_send_int() reserve and fill a queue slot using the atomic
+ * operations of @ref sys_atomic_utils and only disable interrupts for a short
+ * moment if the receiver has to be woken up. Direct delivery to a thread
+ * blocked in @ref msg_receive() without any queued messages, blocking sends
+ * and replies still take the interrupt-disabled path.
+ *
+ * With this module, @ref msg_try_send() may report a full queue while the
+ * last free slot is concurrently being released by the receiver. Messages
+ * must not be sent to threads that may exit concurrently.
+ *
  * Timing & messages
  * =================
  * Timing out the reception of a message or sending messages at a certain time
@@ -317,6 +333,37 @@ int msg_receive(msg_t *m);
  */
 int msg_try_receive(msg_t *m);
 
+/**
+ * @brief Receive a batch of messages.
+ *
+ * This function blocks until at least one message was received. It then
+ * takes up to @p max messages from the message queue of the calling thread
+ * in a single critical section, so a burst of messages can be processed with
+ * a single wakeup. The messages are written to @p out in the order they have
+ * been sent.
+ *
+ * @param[out] out  Preallocated array of at least @p max messages, must not
+ *                  be NULL.
+ * @param[in]  max  Maximum number of messages to receive, must be > 0.
+ *
+ * @return  number of messages received, always >= 1.
+ */
+int msg_receive_many(msg_t *out, unsigned max);
+
+/**
+ * @brief Try to receive a batch of messages.
+ *
+ * Like @ref msg_receive_many(), but does not block if no message can be
+ * received.
+ *
+ * @param[out] out  Preallocated array of at least @p max messages, must not
+ *                  be NULL.
+ * @param[in]  max  Maximum number of messages to receive, must be > 0.
+ *
+ * @return  number of messages received, 0 if there was none.
+ */
+int msg_try_receive_many(msg_t *out, unsigned max);
+
 /**
  * @brief Send a message, block until reply received.
  *
@@ -35,6 +35,9 @@
 #endif
 #include "irq.h"
 #include "cib.h"
+#if MODULE_CORE_MSG_LOCKFREE
+#include "atomic_utils.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -42,21 +45,150 @@
 static int _msg_receive(msg_t *m, int block);
 static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
                      unsigned state);
+static int _msg_send_oneway(msg_t *m, kernel_pid_t target_pid);
 
-static int queue_msg(thread_t *target, const msg_t *m)
+#if MODULE_CORE_MSG_LOCKFREE
+/*
+ * The message queue is a multi-producer single-consumer ring:
+ *
+ * - `msg_reserved` counts the slots that are either filled or being filled.
+ *   Senders reserve a slot by incrementing it, the receiver releases a slot by
+ *   decrementing it after having copied the message out.
+ * - `msg_queue.write_count` hands out the reserved slots in order.
+ * - a slot holds a message once its `sender_pid` is set. The sender sets it
+ *   last, the receiver clears it before releasing the slot.
+ *
+ * Senders never disable interrupts. The receiver side (_queue_get()) always
+ * runs with interrupts disabled, either in the receiving thread or on behalf
+ * of it by a sender waking it up, so there is only one consumer at a time.
+ */
+static int _queue_put(thread_t *target, const msg_t *m)
+{
+    if (!thread_has_msg_queue(target)) {
+        return 0;
+    }
+
+    unsigned size = cib_size(&target->msg_queue);
+
+    if (atomic_fetch_add_unsigned(&target->msg_reserved, 1) >= size) {
+        atomic_fetch_sub_unsigned(&target->msg_reserved, 1);
+        return 0;
+    }
+
+    unsigned n = atomic_fetch_add_unsigned(&target->msg_queue.write_count, 1)
+                 & target->msg_queue.mask;
+    msg_t *dest = &target->msg_array[n];
+
+    dest->type = m->type;
+    dest->content = m->content;
+    atomic_store_kernel_pid(&dest->sender_pid, m->sender_pid);
+    return 1;
+}
+
+static int _queue_get(thread_t *thread, msg_t *m)
+{
+    msg_t *src = &thread->msg_array[thread->msg_queue.read_count &
+                                    thread->msg_queue.mask];
+    kernel_pid_t sender_pid = atomic_load_kernel_pid(&src->sender_pid);
+
+    /* the oldest slot may still be filled by a preempted sender, which then
+     * takes care of waking up the receiver */
+    if (sender_pid == KERNEL_PID_UNDEF) {
+        return 0;
+    }
+
+    m->type = src->type;
+    m->content = src->content;
+    m->sender_pid = sender_pid;
+    atomic_store_kernel_pid(&src->sender_pid, KERNEL_PID_UNDEF);
+    thread->msg_queue.read_count++;
+    atomic_fetch_sub_unsigned(&thread->msg_reserved, 1);
+    return 1;
+}
+
+/* Messages for a receive blocked thread are only copied directly, if no
+ * messages are queued for it that would be overtaken. */
+static inline bool _receive_blocked(const thread_t *target)
+{
+    return (target->status == STATUS_RECEIVE_BLOCKED) &&
+           !atomic_load_unsigned(&target->msg_reserved);
+}
+
+/* Wake up @p target after a message has been queued without disabling
+ * interrupts, if it is waiting for one. */
+static void _queue_notify(thread_t *target)
+{
+    thread_status_t status = target->status;
+
+#if MODULE_CORE_THREAD_FLAGS
+    atomic_fetch_or_u16(&target->flags, THREAD_FLAG_MSG_WAITING);
+    if ((status != STATUS_RECEIVE_BLOCKED) &&
+        (status != STATUS_FLAG_BLOCKED_ANY) &&
+        (status != STATUS_FLAG_BLOCKED_ALL)) {
+        return;
+    }
+#else
+    if (status != STATUS_RECEIVE_BLOCKED) {
+        return;
+    }
+#endif
+
+    unsigned state = irq_disable();
+
+    if (target->status == STATUS_RECEIVE_BLOCKED) {
+        if (_queue_get(target, target->wait_data)) {
+            sched_set_status(target, STATUS_PENDING);
+            sched_context_switch_request = 1;
+        }
+    }
+#if MODULE_CORE_THREAD_FLAGS
+    else {
+        thread_flags_wake(target);
+    }
+#endif
+
+    irq_restore(state);
+}
+#else
+static int _queue_put(thread_t *target, const msg_t *m)
 {
     int n = cib_put(&(target->msg_queue));
 
     if (n < 0) {
+        return 0;
+    }
+
+    target->msg_array[n] = *m;
+    return 1;
+}
+
+static int _queue_get(thread_t *thread, msg_t *m)
+{
+    int n = cib_get(&(thread->msg_queue));
+
+    if (n < 0) {
+        return 0;
+    }
+
+    *m = thread->msg_array[n];
+    return 1;
+}
+
+static inline bool _receive_blocked(const thread_t *target)
+{
+    return target->status == STATUS_RECEIVE_BLOCKED;
+}
+#endif
+
+static int queue_msg(thread_t *target, const msg_t *m)
+{
+    if (!_queue_put(target, m)) {
         DEBUG("queue_msg(): message queue of thread %" PRIkernel_pid
               " is full (or there is none)\n", target->pid);
         return 0;
     }
 
     DEBUG("queue_msg(): queuing message\n");
-    msg_t *dest = &target->msg_array[n];
-
-    *dest = *m;
 #if MODULE_CORE_THREAD_FLAGS
     target->flags |= THREAD_FLAG_MSG_WAITING;
     thread_flags_wake(target);
@@ -75,6 +207,31 @@ int msg_send(msg_t *m, kernel_pid_t target_pid)
     return _msg_send(m, target_pid, true, irq_disable());
 }
 
+#if MODULE_CORE_MSG_LOCKFREE
+static int _msg_send_lockfree(msg_t *m, kernel_pid_t target_pid)
+{
+    thread_t *target = thread_get_unchecked(target_pid);
+
+    if (target == NULL) {
+        DEBUG("%s: target thread %d does not exist\n", __func__, target_pid);
+        return -1;
+    }
+
+    if ((target->status == STATUS_RECEIVE_BLOCKED) || !_queue_put(target, m)) {
+        /* direct delivery or full queue: take the interrupt disabled path */
+        unsigned state = irq_disable();
+        int res = _msg_send_oneway(m, target_pid);
+        irq_restore(state);
+        return res;
+    }
+
+    DEBUG("%s: queued message for %" PRIkernel_pid "\n", __func__, target_pid);
+    /* the target may have gone receive blocked while the message was queued */
+    _queue_notify(target);
+    return 1;
+}
+#endif
+
 int msg_try_send(msg_t *m, kernel_pid_t target_pid)
 {
     if (irq_is_in()) {
@@ -83,7 +240,16 @@ int msg_try_send(msg_t *m, kernel_pid_t target_pid)
     if (thread_getpid() == target_pid) {
         return msg_send_to_self(m);
     }
+#if MODULE_CORE_MSG_LOCKFREE
+    m->sender_pid = thread_getpid();
+    int res = _msg_send_lockfree(m, target_pid);
+    if (sched_context_switch_request) {
+        thread_yield_higher();
+    }
+    return res;
+#else
     return _msg_send(m, target_pid, false, irq_disable());
+#endif
 }
 
 static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
@@ -112,7 +278,7 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
           __LINE__, thread_getpid(), target_pid,
           block, (int)me->status, (int)target->status);
 
-    if (target->status != STATUS_RECEIVE_BLOCKED) {
+    if (!_receive_blocked(target)) {
         DEBUG(
             "msg_send() %s:%i: Target %" PRIkernel_pid " is not RECEIVE_BLOCKED.\n",
             __FILE__, __LINE__, target_pid);
@@ -209,7 +375,7 @@ static int _msg_send_oneway(msg_t *m, kernel_pid_t target_pid)
         return -1;
     }
 
-    if (target->status == STATUS_RECEIVE_BLOCKED) {
+    if (_receive_blocked(target)) {
         DEBUG("%s: Direct msg copy from %" PRIkernel_pid " to %"
               PRIkernel_pid ".\n", __func__, thread_getpid(), target_pid);
 
@@ -237,7 +403,11 @@ int msg_send_int(msg_t *m, kernel_pid_t target_pid)
 
     m->sender_pid = KERNEL_PID_ISR;
 
+#if MODULE_CORE_MSG_LOCKFREE
+    res = _msg_send_lockfree(m, target_pid);
+#else
     res = _msg_send_oneway(m, target_pid);
+#endif
 
     return res;
 }
@@ -362,22 +532,21 @@ static int _msg_receive(msg_t *m, int block)
 
     thread_t *me = thread_get_active();
 
-    int queue_index = -1;
+    int queued = 0;
 
     if (thread_has_msg_queue(me)) {
-        queue_index = cib_get(&(me->msg_queue));
+        queued = _queue_get(me, m);
     }
 
     /* no message, fail */
-    if ((!block) && ((!me->msg_waiters.next) && (queue_index == -1))) {
+    if ((!block) && ((!me->msg_waiters.next) && !queued)) {
         irq_restore(state);
         return -1;
     }
 
-    if (queue_index >= 0) {
+    if (queued) {
         DEBUG("_msg_receive: %" PRIkernel_pid ": _msg_receive(): We've got a "
               "queued message.\n", thread_getpid());
-        *m = me->msg_array[queue_index];
     }
     else {
         me->wait_data = (void *)m;
@@ -389,7 +558,7 @@ static int _msg_receive(msg_t *m, int block)
         DEBUG("_msg_receive: %" PRIkernel_pid ": _msg_receive(): No thread in "
               "waiting list.\n", thread_getpid());
 
-        if (queue_index < 0) {
+        if (!queued) {
             DEBUG("_msg_receive(): %" PRIkernel_pid ": No msg in queue. Going "
                   "blocked.\n", thread_getpid());
             sched_set_status(me, STATUS_RECEIVE_BLOCKED);
@@ -413,16 +582,18 @@ static int _msg_receive(msg_t *m, int block)
         thread_t *sender =
             container_of((clist_node_t *)next, thread_t, rq_entry);
 
-        if (queue_index >= 0) {
+        /* copy msg */
+        msg_t *sender_msg = (msg_t *)sender->wait_data;
+
+        if (queued) {
             /* We've already got a message from the queue. As there is a
              * waiter, take it's message into the just freed queue space.
              */
-            m = &(me->msg_array[cib_put(&(me->msg_queue))]);
+            _queue_put(me, sender_msg);
+        }
+        else {
+            *m = *sender_msg;
         }
-
-        /* copy msg */
-        msg_t *sender_msg = (msg_t *)sender->wait_data;
-        *m = *sender_msg;
 
         /* remove sender from queue */
         uint16_t sender_prio = THREAD_PRIORITY_IDLE;
@@ -442,6 +613,80 @@ static int _msg_receive(msg_t *m, int block)
     DEBUG("This should have never been reached!\n");
 }
 
+/* Take up to max messages from the queue of the calling thread, moving as
+ * many blocked senders into the freed queue space. Never blocks. */
+static int _msg_receive_queued(msg_t *out, unsigned max)
+{
+    unsigned state = irq_disable();
+    thread_t *me = thread_get_active();
+    unsigned n = 0;
+
+    if (thread_has_msg_queue(me)) {
+        while ((n < max) && _queue_get(me, &out[n])) {
+            n++;
+        }
+    }
+
+    uint16_t sender_prio = THREAD_PRIORITY_IDLE;
+
+    for (unsigned i = 0; i < n; i++) {
+        list_node_t *next = list_remove_head(&me->msg_waiters);
+
+        if (next == NULL) {
+            break;
+        }
+
+        thread_t *sender =
+            container_of((clist_node_t *)next, thread_t, rq_entry);
+
+        _queue_put(me, sender->wait_data);
+        if (sender->status != STATUS_REPLY_BLOCKED) {
+            sender->wait_data = NULL;
+            sched_set_status(sender, STATUS_PENDING);
+            sender_prio = MIN(sender_prio, sender->priority);
+        }
+    }
+
+    irq_restore(state);
+    if (sender_prio < THREAD_PRIORITY_IDLE) {
+        sched_switch(sender_prio);
+    }
+
+    DEBUG("%s: %" PRIkernel_pid ": got %u messages\n", __func__,
+          thread_getpid(), n);
+    return n;
+}
+
+int msg_receive_many(msg_t *out, unsigned max)
+{
+    assert(max > 0);
+
+    int n = _msg_receive_queued(out, max);
+
+    if (n == 0) {
+        /* nothing queued: block for a single message, then take whatever
+         * has been queued in the meantime */
+        _msg_receive(out, 1);
+        n = 1 + _msg_receive_queued(out + 1, max - 1);
+    }
+
+    return n;
+}
+
+int msg_try_receive_many(msg_t *out, unsigned max)
+{
+    assert(max > 0);
+
+    int n = _msg_receive_queued(out, max);
+
+    if ((n == 0) && (_msg_receive(out, 0) == 1)) {
+        /* message of a blocked sender to a thread without queue */
+        n = 1;
+    }
+
+    return n;
+}
+
 static unsigned _msg_avail(thread_t *thread)
 {
     DEBUG("msg_available: %" PRIkernel_pid ": msg_available.\n",
@@ -450,7 +695,21 @@ static unsigned _msg_avail(thread_t *thread)
     unsigned queue_count = 0;
 
     if (thread_has_msg_queue(thread)) {
+#if MODULE_CORE_MSG_LOCKFREE
+        /* write_count also counts slots that are still being filled, only
+         * count the filled slots _queue_get() can take in order */
+        unsigned reserved = cib_avail(&(thread->msg_queue));
+        unsigned read_count = thread->msg_queue.read_count;
+
+        while ((queue_count < reserved) &&
+               (atomic_load_kernel_pid(&thread->msg_array[
+                    (read_count + queue_count) & thread->msg_queue.mask
+                ].sender_pid) != KERNEL_PID_UNDEF)) {
+            queue_count++;
+        }
+#else
         queue_count = cib_avail(&(thread->msg_queue));
+#endif
     }
 
     return queue_count;
@@ -503,6 +762,13 @@ void msg_init_queue(msg_t *array, int num)
 
     me->msg_array = array;
     cib_init(&(me->msg_queue), num);
+#if MODULE_CORE_MSG_LOCKFREE
+    /* unused slots are marked by an undefined sender */
+    for (int i = 0; i < num; i++) {
+        array[i].sender_pid = KERNEL_PID_UNDEF;
+    }
+    me->msg_reserved = 0;
+#endif
 }
 
 void msg_queue_print(void)
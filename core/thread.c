@@ -352,6 +352,9 @@ kernel_pid_t thread_create(char *stack, int stacksize, uint8_t priority,
     cib_init(&(thread->msg_queue), 0);
     thread->msg_array = NULL;
 #endif
+#ifdef MODULE_CORE_MSG_LOCKFREE
+    thread->msg_reserved = 0;
+#endif
 
     sched_num_threads++;
 
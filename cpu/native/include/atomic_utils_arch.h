@@ -66,6 +66,90 @@ static inline void atomic_store_u32(volatile uint32_t *dest, uint32_t val)
     __atomic_store_4(dest, val, __ATOMIC_SEQ_CST);
 }
 
+#define HAS_ATOMIC_FETCH_ADD_U8
+static inline uint8_t atomic_fetch_add_u8(volatile uint8_t *dest,
+                                          uint8_t val)
+{
+    return __atomic_fetch_add_1(dest, val, __ATOMIC_SEQ_CST);
+}
+
+#define HAS_ATOMIC_FETCH_ADD_U16
+static inline uint16_t atomic_fetch_add_u16(volatile uint16_t *dest,
+                                            uint16_t val)
+{
+    return __atomic_fetch_add_2(dest, val, __ATOMIC_SEQ_CST);
+}
+
+#define HAS_ATOMIC_FETCH_ADD_U32
+static inline uint32_t atomic_fetch_add_u32(volatile uint32_t *dest,
+                                            uint32_t val)
+{
+    return __atomic_fetch_add_4(dest, val, __ATOMIC_SEQ_CST);
+}
+
+#define HAS_ATOMIC_FETCH_SUB_U8
+static inline uint8_t atomic_fetch_sub_u8(volatile uint8_t *dest,
+                                          uint8_t val)
+{
+    return __atomic_fetch_sub_1(dest, val, __ATOMIC_SEQ_CST);
+}
+
+#define HAS_ATOMIC_FETCH_SUB_U16
+static inline uint16_t atomic_fetch_sub_u16(volatile uint16_t *dest,
+                                            uint16_t val)
+{
+    return __atomic_fetch_sub_2(dest, val, __ATOMIC_SEQ_CST);
+}
+
+#define HAS_ATOMIC_FETCH_SUB_U32
+static inline uint32_t atomic_fetch_sub_u32(volatile uint32_t *dest,
+                                            uint32_t val)
+{
+    return __atomic_fetch_sub_4(dest, val, __ATOMIC_SEQ_CST);
+}
+
+#define HAS_ATOMIC_FETCH_OR_U8
+static inline uint8_t atomic_fetch_or_u8(volatile uint8_t *dest,
+                                         uint8_t val)
+{
+    return __atomic_fetch_or_1(dest, val, __ATOMIC_SEQ_CST);
+}
+
+#define HAS_ATOMIC_FETCH_OR_U16
+static inline uint16_t atomic_fetch_or_u16(volatile uint16_t *dest,
+                                           uint16_t val)
+{
+    return __atomic_fetch_or_2(dest, val, __ATOMIC_SEQ_CST);
+}
+
+#define HAS_ATOMIC_FETCH_OR_U32
+static inline uint32_t atomic_fetch_or_u32(volatile uint32_t *dest,
+                                           uint32_t val)
+{
+    return __atomic_fetch_or_4(dest, val, __ATOMIC_SEQ_CST);
+}
+
+#define HAS_ATOMIC_FETCH_AND_U8
+static inline uint8_t atomic_fetch_and_u8(volatile uint8_t *dest,
+                                          uint8_t val)
+{
+    return __atomic_fetch_and_1(dest, val, __ATOMIC_SEQ_CST);
+}
+
+#define HAS_ATOMIC_FETCH_AND_U16
+static inline uint16_t atomic_fetch_and_u16(volatile uint16_t *dest,
+                                            uint16_t val)
+{
+    return __atomic_fetch_and_2(dest, val, __ATOMIC_SEQ_CST);
+}
+
+#define HAS_ATOMIC_FETCH_AND_U32
+static inline uint32_t atomic_fetch_and_u32(volatile uint32_t *dest,
+                                            uint32_t val)
+{
+    return __atomic_fetch_and_4(dest, val, __ATOMIC_SEQ_CST);
+}
+
 #endif /* __clang__ */
 #endif /* DOXYGEN */
 
@@ -79,11 +79,22 @@ PSEUDOMODULES += event_timeout_ztimer
 PSEUDOMODULES += evtimer_mbox
 PSEUDOMODULES += fatfs_vfs_format
 PSEUDOMODULES += fdcan
+## @addtogroup net_fib
+## @{
+## Look up single hop entries in a longest prefix match trie instead of
+## scanning the whole table (`fib_lpm`)
+PSEUDOMODULES += fib_lpm
+## @}
 PSEUDOMODULES += fmt_%
 PSEUDOMODULES += gcoap_forward_proxy
 PSEUDOMODULES += gcoap_forward_proxy_thread
 PSEUDOMODULES += gcoap_fileserver
 PSEUDOMODULES += gcoap_dtls
+## @addtogroup net_gcoap
+## @{
+## Run the handlers of resources with @ref COAP_OFFLOAD in worker threads
+PSEUDOMODULES += gcoap_workers
+## @}
 ## @addtogroup net_gcoap_dns
 ## @{
 ## Enable @ref net_gcoap_dns
@@ -119,7 +130,23 @@ PSEUDOMODULES += gnrc_ipv6_nib_6lbr
 PSEUDOMODULES += gnrc_ipv6_nib_6ln
 PSEUDOMODULES += gnrc_ipv6_nib_6lr
 PSEUDOMODULES += gnrc_ipv6_nib_dns
+## @addtogroup net_gnrc_ipv6_nib_nc
+## @{
+## @defgroup net_gnrc_ipv6_nib_nc_hashed gnrc_ipv6_nib_nc_hashed: Hashed neighbor index
+## @brief   Look up neighbors in the NIB via a hash table over their addresses
+##
+## See @ref CONFIG_GNRC_IPV6_NIB_NC_HASH_BUCKETS_EXP.
+## @}
+PSEUDOMODULES += gnrc_ipv6_nib_nc_hashed
 PSEUDOMODULES += gnrc_ipv6_nib_rio
+## @addtogroup net_gnrc_ipv6_nib_ft
+## @{
+## @defgroup net_gnrc_ipv6_nib_route_cache gnrc_ipv6_nib_route_cache: Route lookup cache
+## @brief   Cache the results of forwarding table lookups per destination
+##
+## See @ref CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_SIZE.
+## @}
+PSEUDOMODULES += gnrc_ipv6_nib_route_cache
 PSEUDOMODULES += gnrc_ipv6_nib_router
 PSEUDOMODULES += gnrc_ipv6_nib_rtr_adv_pio_cb
 PSEUDOMODULES += gnrc_lorawan_1_1
@@ -132,6 +159,74 @@ PSEUDOMODULES += gnrc_netif_6lo
 PSEUDOMODULES += gnrc_netif_ipv6
 PSEUDOMODULES += gnrc_netif_single
 PSEUDOMODULES += gnrc_netif_dedup
+PSEUDOMODULES += gnrc_netif_rxbuf
+## @defgroup net_gnrc_netif_pktq_prio gnrc_netif_pktq_prio: Priority-aware send queue
+## @ingroup net_gnrc_netif_pktq
+## @brief   One send queue per traffic class for @ref net_gnrc_netif_pktq
+##
+## Network control traffic is sent with strict priority, best effort and bulk
+## traffic share the link by deficit round robin. Each class has its own depth
+## limit, drops are counted in `netstats_t::tx_queue_drops`.
+PSEUDOMODULES += gnrc_netif_pktq_prio
+
+## @addtogroup net_gnrc_netreg
+## @{
+## @defgroup net_gnrc_netreg_hashed gnrc_netreg_hashed: Hashed netreg lookups
+## @brief  Keep the registry in a hash table keyed by type and demux context
+##
+## By default, @ref gnrc_netreg_lookup() scans all entries registered for a
+## type, e.g. all UDP sockets, for every packet. With this module, entries are
+## kept in @ref CONFIG_GNRC_NETREG_HASH_BUCKETS_EXP buckets indexed by a hash of
+## their type and demux context instead, so lookups do not depend on the
+## number of registered entries.
+## @{
+PSEUDOMODULES += gnrc_netreg_hashed
+## @}
+## @}
+
+## @addtogroup net_gnrc_pktbuf
+## @{
+## @defgroup net_gnrc_pktbuf_static_tlsf gnrc_pktbuf_static_tlsf: TLSF allocator for gnrc_pktbuf_static
+## @brief  Two-level segregated fit allocator for the static packet buffer
+##
+## Replaces the first-fit free list of `gnrc_pktbuf_static` with segregated
+## size classes, so allocating and releasing packet buffer space takes bounded
+## time regardless of how many chunks are in use. Recommended for large
+## @ref CONFIG_GNRC_PKTBUF_SIZE values. With `DEVELHELP` enabled,
+## @ref gnrc_pktbuf_stats() reports fragmentation statistics.
+##
+## Only available on 32 and 64 bit platforms.
+## @{
+PSEUDOMODULES += gnrc_pktbuf_static_tlsf
+## @}
+## @defgroup net_gnrc_pktbuf_static_snip_slab gnrc_pktbuf_static_snip_slab: Packet snip slab for gnrc_pktbuf_static
+## @brief  Allocate packet snip descriptors of the static packet buffer from a slab
+##
+## Keeps the fixed-size @ref gnrc_pktsnip_t descriptors in a dedicated
+## @ref sys_memarray of @ref CONFIG_GNRC_PKTBUF_STATIC_SNIP_SLAB_NUMOF entries,
+## so they do not fragment the packet buffer holding the packet data.
+## With `DEVELHELP` enabled, @ref gnrc_pktbuf_stats() reports the slab's
+## occupancy.
+## @{
+PSEUDOMODULES += gnrc_pktbuf_static_snip_slab
+## @}
+## @defgroup net_gnrc_pktbuf_static_magazine gnrc_pktbuf_static_magazine: Per-thread caches for gnrc_pktbuf_static
+## @brief  Serve small allocations of the static packet buffer from per-thread caches
+##
+## Up to @ref CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_NUMOF threads get a cache of
+## packet snip descriptors and data chunks of up to
+## @ref CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_CHUNK_MAX bytes. Packet snips
+## allocated from it and released by a thread holding the only reference do
+## not lock the packet buffer. Caches are refilled and drained in batches, so
+## the lock shared by all threads is only taken once every few operations.
+## Each cache holds at most @ref CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_BYTES
+## bytes of the packet buffer that are not available to other threads.
+## With `DEVELHELP` enabled, @ref gnrc_pktbuf_stats() reports the caches'
+## hit rates.
+## @{
+PSEUDOMODULES += gnrc_pktbuf_static_magazine
+## @}
+## @}
 
 
 ## @addtogroup 	net_gnrc_nettype
@@ -201,6 +296,15 @@ PSEUDOMODULES += gnrc_sixloenc
 PSEUDOMODULES += gnrc_sixlowpan_border_router_default
 PSEUDOMODULES += gnrc_sixlowpan_default
 PSEUDOMODULES += gnrc_sixlowpan_frag_hint
+## @addtogroup net_gnrc_sixlowpan_frag_rb
+## @{
+## @defgroup net_gnrc_sixlowpan_frag_rb_hashed gnrc_sixlowpan_frag_rb_hashed: Hashed reassembly buffer index
+## @brief   Look up reassembly buffer entries via a hash table over their
+##          (source, destination, tag) tuple
+##
+## See @ref CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_BUCKETS_EXP.
+## @}
+PSEUDOMODULES += gnrc_sixlowpan_frag_rb_hashed
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_ecn
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_ecn_if_in
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_ecn_if_out
@@ -302,6 +406,10 @@ PSEUDOMODULES += netdev_new_api
 PSEUDOMODULES += netdev_register
 PSEUDOMODULES += netstats
 PSEUDOMODULES += netstats_l2
+## @defgroup    net_netstats_latency_mod netstats_latency
+## @ingroup     net_netstats_latency
+## @brief       Record per-interface latency histograms in @ref net_gnrc_netif
+PSEUDOMODULES += netstats_latency
 PSEUDOMODULES += netstats_neighbor_etx
 PSEUDOMODULES += netstats_neighbor_count
 PSEUDOMODULES += netstats_neighbor_rssi
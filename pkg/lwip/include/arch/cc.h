@@ -27,6 +27,7 @@
 #include "irq.h"
 #include "byteorder.h"
 #include "mutex.h"
+#include "net/inet_csum.h"
 
 #ifdef MODULE_LOG
 #define LOG_LEVEL LOG_INFO
@@ -103,6 +104,18 @@ extern "C" {
 #endif
 /** @} */
 
+/**
+ * @brief   Copies @p len bytes from @p src to @p dst and returns the checksum
+ *          of the copied data in network byte order
+ *
+ * Used with `LWIP_CHECKSUM_ON_COPY` when TCP payload is copied into the send
+ * buffer, so the payload is not read a second time by the checksum
+ * calculation on output.
+ */
+#define LWIP_CHKSUM_COPY(dst, src, len) \
+    htons(inet_csum_slice_copy(0, (uint8_t *)(dst), (const uint8_t *)(src), \
+                               (len), 0))
+
 #ifdef __cplusplus
 }
 #endif
@@ -157,6 +157,10 @@ extern "C" {
 
 #define LWIP_SOCKET             0
 
+#ifdef MODULE_INET_CSUM
+#define LWIP_CHECKSUM_ON_COPY   1
+#endif
+
 #define LWIP_DONT_PROVIDE_BYTEORDER_FUNCTIONS
 #define MEMP_MEM_MALLOC         1
 #define NETIF_MAX_HWADDR_LEN    (GNRC_NETIF_HDR_L2ADDR_MAX_LEN)
@@ -0,0 +1,158 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_checksum_crc
+ * @{
+ *
+ * @file
+ * @brief       Generic CRC implementation
+ *
+ * For reflected models, the register holds the CRC in its lower `width` bits,
+ * LSB first. For all other models, it holds the CRC in its upper `width` bits,
+ * MSB first. This way, every width can be processed byte by byte without
+ * additional shifts.
+ *
+ * @}
+ */
+
+#include <assert.h>
+
+#include "checksum/crc.h"
+
+const crc_model_t crc_model_crc32 = {
+    .width = 32, .poly = 0x04c11db7, .init = 0xffffffff,
+    .refin = true, .refout = true, .xorout = 0xffffffff,
+};
+
+const crc_model_t crc_model_crc32c = {
+    .width = 32, .poly = 0x1edc6f41, .init = 0xffffffff,
+    .refin = true, .refout = true, .xorout = 0xffffffff,
+};
+
+const crc_model_t crc_model_crc16_kermit = {
+    .width = 16, .poly = 0x1021, .init = 0x0000,
+    .refin = true, .refout = true, .xorout = 0x0000,
+};
+
+const crc_model_t crc_model_crc16_ccitt_false = {
+    .width = 16, .poly = 0x1021, .init = 0xffff,
+    .refin = false, .refout = false, .xorout = 0x0000,
+};
+
+const crc_model_t crc_model_crc8_smbus = {
+    .width = 8, .poly = 0x07, .init = 0x00,
+    .refin = false, .refout = false, .xorout = 0x00,
+};
+
+static uint32_t _reflect(uint32_t v, unsigned width)
+{
+    uint32_t res = 0;
+
+    for (unsigned i = 0; i < width; i++) {
+        res = (res << 1) | (v & 1);
+        v >>= 1;
+    }
+    return res;
+}
+
+static inline uint32_t _mask(unsigned width)
+{
+    return UINT32_MAX >> (32 - width);
+}
+
+/* polynomial in the register representation of the model */
+static uint32_t _poly(const crc_model_t *model)
+{
+    if (model->refin) {
+        return _reflect(model->poly, model->width);
+    }
+    return model->poly << (32 - model->width);
+}
+
+static inline uint32_t _shift8_ref(uint32_t poly, uint32_t crc)
+{
+    for (unsigned i = 0; i < 8; i++) {
+        crc = (crc >> 1) ^ ((crc & 1) ? poly : 0);
+    }
+    return crc;
+}
+
+static inline uint32_t _shift8(uint32_t poly, uint32_t crc)
+{
+    for (unsigned i = 0; i < 8; i++) {
+        crc = (crc << 1) ^ ((crc >> 31) ? poly : 0);
+    }
+    return crc;
+}
+
+void crc_table_init(const crc_model_t *model, uint32_t table[256])
+{
+    uint32_t poly = _poly(model);
+
+    assert((model->width >= 1) && (model->width <= 32));
+
+    for (unsigned i = 0; i < 256; i++) {
+        table[i] = model->refin ? _shift8_ref(poly, i)
+                                : _shift8(poly, (uint32_t)i << 24);
+    }
+}
+
+uint32_t crc_start(const crc_model_t *model)
+{
+    uint32_t init = model->init & _mask(model->width);
+
+    assert((model->width >= 1) && (model->width <= 32));
+
+    if (model->refin) {
+        return _reflect(init, model->width);
+    }
+    return init << (32 - model->width);
+}
+
+uint32_t crc_update(const crc_model_t *model, const uint32_t *table,
+                    uint32_t crc, const void *buf, size_t len)
+{
+    const uint8_t *p = buf;
+
+    if (table) {
+        if (model->refin) {
+            while (len--) {
+                crc = (crc >> 8) ^ table[(crc ^ *p++) & 0xff];
+            }
+        }
+        else {
+            while (len--) {
+                crc = (crc << 8) ^ table[(crc >> 24) ^ *p++];
+            }
+        }
+        return crc;
+    }
+
+    uint32_t poly = _poly(model);
+
+    if (model->refin) {
+        while (len--) {
+            crc = _shift8_ref(poly, crc ^ *p++);
+        }
+    }
+    else {
+        while (len--) {
+            crc = _shift8(poly, crc ^ ((uint32_t)*p++ << 24));
+        }
+    }
+    return crc;
+}
+
+uint32_t crc_finish(const crc_model_t *model, uint32_t crc)
+{
+    if (!model->refin) {
+        crc >>= 32 - model->width;
+    }
+    if (model->refin != model->refout) {
+        crc = _reflect(crc, model->width);
+    }
+    return (crc ^ model->xorout) & _mask(model->width);
+}
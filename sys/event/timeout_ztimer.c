@@ -45,6 +45,19 @@ void event_timeout_set(event_timeout_t *event_timeout, uint32_t timeout)
     }
 }
 
+#if IS_USED(MODULE_ZTIMER_SLACK)
+void event_timeout_set_slack(event_timeout_t *event_timeout, uint32_t timeout,
+                             uint32_t slack)
+{
+    if (timeout == 0) {
+        event_post(event_timeout->queue, event_timeout->event);
+    } else {
+        ztimer_set_slack(event_timeout->clock, &event_timeout->timer, timeout,
+                         slack);
+    }
+}
+#endif
+
 void event_timeout_clear(event_timeout_t *event_timeout)
 {
     if (event_timeout->clock) {
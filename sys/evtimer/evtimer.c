@@ -93,7 +93,12 @@ static void _del_event_from_list(evtimer_t *evtimer, evtimer_event_t *event)
 static void _set_timer(evtimer_t *evtimer)
 {
     evtimer_event_t *next_event = evtimer->events;
+#if IS_USED(MODULE_ZTIMER_SLACK)
+    evtimer->base = ztimer_set_slack(ZTIMER_MSEC, &evtimer->timer,
+                                     next_event->offset, evtimer->slack);
+#else
     evtimer->base = ztimer_set(ZTIMER_MSEC, &evtimer->timer, next_event->offset);
+#endif
     DEBUG("evtimer: now=%" PRIu32 " ms setting ztimer to %" PRIu32 " ms\n",
           evtimer->base, next_event->offset);
 }
@@ -114,9 +119,14 @@ static void _update_head_offset(evtimer_t *evtimer)
         evtimer_event_t *event = evtimer->events;
         uint32_t now = ztimer_now(ZTIMER_MSEC);
         uint32_t elapsed = now - evtimer->base;
-        if (elapsed > event->offset) {
+        /* the timer may fire late (e.g. when set with slack), so more than
+         * the first event may be due by now */
+        while (event && (elapsed > event->offset)) {
+            elapsed -= event->offset;
             event->offset = 0;
-        } else {
+            event = event->next;
+        }
+        if (event) {
             event->offset -= elapsed;
         }
         evtimer->base = now;
@@ -172,7 +182,9 @@ static void _evtimer_handler(void *arg)
     evtimer_t *evtimer = (evtimer_t *)arg;
 
     /* this function gets called directly by ztimer if the set ztimer expired.
-     * Thus the offset of the first event is down to zero. */
+     * Thus the offset of the first event is down to zero, and so are those of
+     * the events that became due while the timer was late. */
+    _update_head_offset(evtimer);
     evtimer_event_t *event = evtimer->events;
     event->offset = 0;
 
@@ -189,6 +201,9 @@ void evtimer_init(evtimer_t *evtimer, evtimer_callback_t handler)
     evtimer->callback = handler;
     evtimer->timer.callback = _evtimer_handler;
     evtimer->timer.arg = (void *)evtimer;
+#if IS_USED(MODULE_ZTIMER_SLACK)
+    evtimer->slack = 0;
+#endif
     evtimer->events = NULL;
 }
 
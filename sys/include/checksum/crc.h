@@ -0,0 +1,143 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_checksum_crc Generic CRC
+ * @ingroup     sys_checksum
+ *
+ * @brief       CRC of any width up to 32 bit, described by a parameter model
+ * @details     A CRC is described by a @ref crc_model_t, using the parameters
+ *              of the "Catalogue of parametrised CRC algorithms" (width,
+ *              polynomial, initial value, input and output reflection and
+ *              final XOR value). Some common models are provided, others can
+ *              be defined by the application.
+ *
+ *              Without a look-up table, the CRC is calculated bit by bit.
+ *              With a 256 entry look-up table, generated once by
+ *              @ref crc_table_init(), it is calculated byte by byte.
+ *
+ *              For CRC-32 (@ref sys_checksum_crc32) and the CRC16-CCITT
+ *              variants (@ref sys_checksum_crc16_ccitt), the dedicated
+ *              implementations are faster, as they use constant tables in
+ *              ROM and, in case of CRC-32, can process multiple bytes at a
+ *              time.
+ *
+ * @{
+ * @file
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Parameters of a CRC algorithm
+ */
+typedef struct {
+    uint32_t poly;      /**< generator polynomial, without the top bit */
+    uint32_t init;      /**< initial register value */
+    uint32_t xorout;    /**< value XORed to the final register value */
+    uint8_t width;      /**< width of the CRC in bits, 1 to 32 */
+    bool refin;         /**< process bytes LSB first */
+    bool refout;        /**< reflect the final register value */
+} crc_model_t;
+
+/**
+ * @brief   CRC-32 (ISO-HDLC), as used by Ethernet, zlib and @ref crc32()
+ */
+extern const crc_model_t crc_model_crc32;
+
+/**
+ * @brief   CRC-32C (ISCSI, Castagnoli polynomial)
+ */
+extern const crc_model_t crc_model_crc32c;
+
+/**
+ * @brief   CRC-16/KERMIT, as used for the IEEE 802.15.4 FCS
+ */
+extern const crc_model_t crc_model_crc16_kermit;
+
+/**
+ * @brief   CRC-16/IBM-3740, also known as CRC-16/CCITT-FALSE
+ */
+extern const crc_model_t crc_model_crc16_ccitt_false;
+
+/**
+ * @brief   CRC-8/SMBUS
+ */
+extern const crc_model_t crc_model_crc8_smbus;
+
+/**
+ * @brief   Generate the look-up table for @p model
+ *
+ * @param[in]  model    CRC model
+ * @param[out] table    table of 256 entries to fill
+ */
+void crc_table_init(const crc_model_t *model, uint32_t table[256]);
+
+/**
+ * @brief   Start a CRC calculation
+ *
+ * @param[in]  model    CRC model
+ *
+ * @return  register value to pass to @ref crc_update()
+ */
+uint32_t crc_start(const crc_model_t *model);
+
+/**
+ * @brief   Add data to a CRC calculation
+ *
+ * @param[in]  model    CRC model
+ * @param[in]  table    look-up table generated by @ref crc_table_init() for
+ *                      @p model, or NULL to calculate the CRC bit by bit
+ * @param[in]  crc      register value returned by @ref crc_start() or a
+ *                      previous call to @ref crc_update()
+ * @param[in]  buf      data to checksum
+ * @param[in]  len      length of @p buf in bytes
+ *
+ * @return  register value to pass to @ref crc_update() or @ref crc_finish()
+ */
+uint32_t crc_update(const crc_model_t *model, const uint32_t *table,
+                    uint32_t crc, const void *buf, size_t len);
+
+/**
+ * @brief   Finish a CRC calculation
+ *
+ * @param[in]  model    CRC model
+ * @param[in]  crc      register value returned by @ref crc_update()
+ *
+ * @return  the CRC
+ */
+uint32_t crc_finish(const crc_model_t *model, uint32_t crc);
+
+/**
+ * @brief   Calculate the CRC of @p buf in one go
+ *
+ * @param[in]  model    CRC model
+ * @param[in]  table    look-up table generated by @ref crc_table_init() for
+ *                      @p model, or NULL to calculate the CRC bit by bit
+ * @param[in]  buf      data to checksum
+ * @param[in]  len      length of @p buf in bytes
+ *
+ * @return  the CRC
+ */
+static inline uint32_t crc_calc(const crc_model_t *model, const uint32_t *table,
+                                const void *buf, size_t len)
+{
+    return crc_finish(model,
+                      crc_update(model, table, crc_start(model), buf, len));
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
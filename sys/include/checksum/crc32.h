@@ -26,13 +26,28 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Number of bytes processed per step by the `crc32_fast` module
+ *
+ * With 1, a single 1 KiB look-up table is used and the data is processed
+ * byte by byte. With 4 or 8 (slicing-by-4/8), 4 or 8 tables of 1 KiB each
+ * are used to process 4 or 8 bytes at a time. See `tests/bench/sys_checksum_crc`
+ * for the speed-up on a given board.
+ *
+ * Has no effect without the `crc32_fast` module.
+ */
+#ifndef CONFIG_CRC32_FAST_SLICES
+#define CONFIG_CRC32_FAST_SLICES    1
+#endif
+
 /**
  * @brief   CRC-32 checksum
  *
  * Uses the `0xedb88320` polynomial
  *
  * @note enable the `crc32_fast` module for a look-up table based implementation
- *       that trades code size for speed.
+ *       that trades code size for speed. See @ref CONFIG_CRC32_FAST_SLICES
+ *       for trading even more code size for speed.
  *
  * @param[in] buf   The data to checksum
  * @param[in] size  Length of the data in bytes
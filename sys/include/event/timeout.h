@@ -94,6 +94,24 @@ void event_timeout_init(event_timeout_t *event_timeout, event_queue_t *queue,
  */
 void event_timeout_set(event_timeout_t *event_timeout, uint32_t timeout);
 
+#if IS_USED(MODULE_ZTIMER_SLACK) || DOXYGEN
+/**
+ * @brief   Set a timeout that may trigger up to @p slack ticks late
+ *
+ * Like @ref event_timeout_set(), but the underlying timer is set with
+ * @ref ztimer_set_slack(), so it can share an interrupt with other timers.
+ *
+ * @note    Only available with the `ztimer_slack` module.
+ *
+ * @param[in]   event_timeout   event_timout context object to use
+ * @param[in]   timeout         timeout in ztimer_clock_t ticks
+ * @param[in]   slack           ticks the event may be triggered later than
+ *                              @p timeout
+ */
+void event_timeout_set_slack(event_timeout_t *event_timeout, uint32_t timeout,
+                             uint32_t slack);
+#endif
+
 /**
  * @brief   Clear a timeout event
  *
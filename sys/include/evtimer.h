@@ -68,6 +68,9 @@ typedef void(*evtimer_callback_t)(evtimer_event_t* event);
 typedef struct {
     ztimer_t timer;                 /**< Timer */
     uint32_t base;                  /**< Absolute time the first event is built on */
+#if IS_USED(MODULE_ZTIMER_SLACK) || defined(DOXYGEN)
+    uint32_t slack;                 /**< Milliseconds events may be handled late */
+#endif
     evtimer_callback_t callback;    /**< Handler function for this evtimer's
                                          event type */
     evtimer_event_t *events;        /**< Event queue */
@@ -85,6 +88,26 @@ typedef struct {
  */
 void evtimer_init(evtimer_t *evtimer, evtimer_callback_t handler);
 
+#if IS_USED(MODULE_ZTIMER_SLACK) || defined(DOXYGEN)
+/**
+ * @brief   Lets the events of an event timer be handled up to @p slack
+ *          milliseconds late
+ *
+ * The timer of @p evtimer is then set with @ref ztimer_set_slack(), so it can
+ * share an interrupt with other timers. Events are never handled early, and
+ * the lateness of one event does not delay the events after it.
+ *
+ * @note    Only available with the `ztimer_slack` module.
+ *
+ * @param[in] evtimer   An event timer
+ * @param[in] slack     Milliseconds events may be handled late, 0 by default
+ */
+static inline void evtimer_set_slack(evtimer_t *evtimer, uint32_t slack)
+{
+    evtimer->slack = slack;
+}
+#endif
+
 /**
  * @brief   Adds event to an event timer
  *
@@ -15,6 +15,13 @@
  *
  * This module is unused by RIOT's networking stacks, see @ref net_gnrc_ipv6_nib_ft
  * instead.
+ *
+ * By default, every lookup scans all entries of a table. With the `fib_lpm`
+ * module, single hop tables additionally keep their entries in a path
+ * compressed binary trie, so lookups only visit the entries whose prefix may
+ * match the destination. The trie is updated when entries are added or
+ * removed. Expired entries are removed when a lookup or an addition comes
+ * across them.
  * @{
  *
  * @file
@@ -18,6 +18,7 @@
  * @author      Martin Landsmann <martin.landsmann@haw-hamburg.de>
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "sched.h"
@@ -34,6 +35,26 @@ extern "C" {
  */
 #define FIB_MAX_REGISTERED_RP (5)
 
+#if defined(MODULE_FIB_LPM) || defined(DOXYGEN)
+/**
+ * @brief Node of the longest prefix match trie of a FIB table
+ *
+ * @note  Only available with the `fib_lpm` module.
+ */
+typedef struct fib_lpm_node {
+    /** parent node, NULL for the root of the trie */
+    struct fib_lpm_node *parent;
+    /** subtrees whose keys continue with a 0 or 1 bit respectively */
+    struct fib_lpm_node *child[2];
+    /** next entry with the same key */
+    struct fib_lpm_node *dup;
+    /** number of leading address bits the key of the node consists of */
+    uint16_t bits;
+    /** the node is a branching node without an entry */
+    bool branch;
+} fib_lpm_node_t;
+#endif
+
 /**
  * @brief Container descriptor for a FIB entry
  */
@@ -50,6 +71,15 @@ typedef struct {
     uint32_t next_hop_flags;
     /** Pointer to the shared generic address */
     universal_address_container_t *next_hop;
+#if defined(MODULE_FIB_LPM) || defined(DOXYGEN)
+    /**
+     * @brief Trie node of this entry, followed by a branching node the trie
+     *        may use for any entry
+     *
+     * @note  Only available with the `fib_lpm` module.
+     */
+    fib_lpm_node_t lpm[2];
+#endif
 } fib_entry_t;
 
 /**
@@ -132,6 +162,12 @@ typedef struct {
     *   e.g. when the unreachable destination is covered by the prefix
     */
     universal_address_container_t* prefix_rp[FIB_MAX_REGISTERED_RP];
+#if defined(MODULE_FIB_LPM) || defined(DOXYGEN)
+    /** root of the longest prefix match trie of the single hop entries.
+    *   @note  Only available with the `fib_lpm` module.
+    */
+    fib_lpm_node_t *lpm_root;
+#endif
 } fib_table_t;
 
 #ifdef __cplusplus
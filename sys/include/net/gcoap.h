@@ -66,8 +66,8 @@
  * An application resource includes a callback function, a coap_handler_t. After
  * reading the request, the callback must use functions provided by gcoap to
  * format the response, as described below. The callback *must* read the request
- * thoroughly before calling the functions, because the response buffer likely
- * reuses the request buffer. See `examples/networking/coap/gcoap/client.c` for a simple
+ * thoroughly before calling the functions, because the response buffer may
+ * reuse the request buffer. See `examples/networking/coap/gcoap/client.c` for a simple
  * example of a callback.
  *
  * Here is the expected sequence for a callback function:
@@ -93,6 +93,39 @@
  * If no payload, call only gcoap_response() to write the full response. If you
  * need to add Options, follow the first three steps in the list above instead.
  *
+ * ### Worker threads ###
+ *
+ * By default, the gcoap thread runs every handler itself, so a slow handler
+ * (e.g. one that reads a file from flash) delays all other CoAP traffic. With
+ * the `gcoap_workers` module, a resource with the @ref COAP_OFFLOAD flag in
+ * coap_resource_t::methods is handled by one of
+ * @ref CONFIG_GCOAP_WORKERS_NUMOF worker threads instead:
+ *
+ * ```c
+ * static const coap_resource_t _resources[] = {
+ *     { "/fw", COAP_GET | COAP_OFFLOAD, _fw_handler, NULL },
+ *     { "/led", COAP_GET | COAP_PUT, _led_handler, NULL },
+ * };
+ * ```
+ *
+ * The gcoap thread still receives and parses the request, finds the resource
+ * and does the Observe bookkeeping, then passes the request to the worker with
+ * the fewest pending requests. The worker runs the handler and sends the
+ * response. Handlers of resources without the flag keep running in the gcoap
+ * thread. Requests received via DTLS are always handled by the gcoap thread.
+ *
+ * A request passed to a worker keeps its response buffer until the response
+ * is sent. Workers never take the last free buffer, it is reserved for the
+ * gcoap thread, so @ref CONFIG_GCOAP_RESP_BUFS_MAX must be larger than
+ * @ref CONFIG_GCOAP_WORKERS_NUMOF, which is the default with this module. The
+ * gcoap thread never waits for a worker: if passing a request to a worker
+ * would take the reserved buffer, it is answered with 5.03 (Service
+ * Unavailable) instead. Hence, an offloaded handler may itself send requests
+ * with gcoap and wait for their responses.
+ *
+ * A retransmission of a confirmable request that a worker is still handling
+ * is ignored, the response of the worker answers it.
+ *
  * ### Resource list creation ###
  *
  * gcoap allows customization of the function that provides the list of registered
@@ -366,7 +399,20 @@
  * for a response, so the gcoap thread does not block while waiting. The user is
  * notified via the same callback, whether the message is received or the wait
  * times out. We track the response with an entry in the
- * `_coap_state.open_reqs` array.
+ * `_coap_state.open_reqs` array. The entries are indexed by the token and the
+ * message ID of the request, so matching a response takes about the same time
+ * however many requests are waiting.
+ *
+ * ### Receiving a PDU ###
+ *
+ * With GNRC, a request is parsed in place in the packet buffer of the network
+ * stack and its response is built in one of @ref CONFIG_GCOAP_RESP_BUFS_MAX
+ * response buffers, so the request is never copied. As with a copied request,
+ * a request larger than @ref CONFIG_GCOAP_PDU_BUF_SIZE is answered with 4.13
+ * (Request Entity Too Large) without calling a handler. The packet is released
+ * once the response is sent. Responses to requests of this node, PDUs received via DTLS and PDUs
+ * received with other network stacks are copied into a response buffer, which
+ * then also holds the response to the PDU.
  *
  * ## Implementation Status ##
  * gcoap includes server and client capability. Available features include:
@@ -465,6 +511,11 @@ extern "C" {
 
 /**
  * @brief   Maximum number of requests awaiting a response
+ *
+ * @details Waiting requests are hashed by token and by message ID, so this
+ *          can be raised to hundreds without slowing down the matching of
+ *          responses. Every waiting confirmable request also needs a buffer
+ *          for retransmissions, see @ref CONFIG_GCOAP_RESEND_BUFS_MAX.
  */
 #ifndef CONFIG_GCOAP_REQ_WAITING_MAX
 #define CONFIG_GCOAP_REQ_WAITING_MAX   (2)
@@ -533,6 +584,11 @@ extern "C" {
  * In normal operations the timeout between retransmissions doubles. When
  * CONFIG_GCOAP_NO_RETRANS_BACKOFF is defined this doubling does not happen.
  *
+ * With the `ztimer_slack` module, a timeout may expire anywhere between the
+ * randomly picked value and the end of its range of
+ * @ref CONFIG_COAP_RANDOM_FACTOR_1000, so that it can share an interrupt with
+ * other timers.
+ *
  * @see CONFIG_COAP_ACK_TIMEOUT_MS
  */
 #define CONFIG_GCOAP_NO_RETRANS_BACKOFF
@@ -667,6 +723,24 @@ extern "C" {
 #endif
 /** @} */
 
+/**
+ * @brief   Stack size of a worker thread of the `gcoap_workers` module
+ */
+#ifndef GCOAP_WORKER_STACK_SIZE
+#define GCOAP_WORKER_STACK_SIZE (THREAD_STACKSIZE_DEFAULT + DEBUG_EXTRA_STACKSIZE \
+                                 + GCOAP_VFS_EXTRA_STACKSIZE)
+#endif
+
+/**
+ * @brief   Priority of the worker threads of the `gcoap_workers` module
+ *
+ * Must be lower than the priority of the gcoap thread, so the gcoap thread
+ * keeps handling PDUs while a worker runs a handler.
+ */
+#ifndef GCOAP_WORKER_PRIO
+#define GCOAP_WORKER_PRIO       (THREAD_PRIORITY_MAIN)
+#endif
+
 /**
  * @ingroup net_gcoap_conf
  * @brief   Count of PDU buffers available for resending confirmable messages
@@ -675,6 +749,48 @@ extern "C" {
 #define CONFIG_GCOAP_RESEND_BUFS_MAX      (1)
 #endif
 
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Number of worker threads of the `gcoap_workers` module
+ *
+ * See the _Worker threads_ section of @ref net_gcoap.
+ */
+#ifndef CONFIG_GCOAP_WORKERS_NUMOF
+#define CONFIG_GCOAP_WORKERS_NUMOF        (2)
+#endif
+
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Count of PDU buffers for responses
+ *
+ * Every PDU in processing takes one buffer, see the _Receiving a PDU_
+ * implementation notes.
+ *
+ * With the `gcoap_workers` module, every request passed to a worker keeps its
+ * buffer and one buffer is reserved for the gcoap thread, so there must be
+ * more buffers than workers. Further requests for offloaded resources are
+ * answered with 5.03 while all other buffers are held by workers.
+ */
+#ifndef CONFIG_GCOAP_RESP_BUFS_MAX
+#if IS_USED(MODULE_GCOAP_WORKERS) || defined(DOXYGEN)
+#define CONFIG_GCOAP_RESP_BUFS_MAX        (CONFIG_GCOAP_WORKERS_NUMOF + 1)
+#else
+#define CONFIG_GCOAP_RESP_BUFS_MAX        (1)
+#endif
+#endif
+
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Number of listeners whose resources are indexed by a resource trie
+ *
+ * Only used with the `nanocoap_resource_trie` module, see
+ * @ref net_nanocoap_resource_trie. The resources of further listeners are
+ * searched linearly.
+ */
+#ifndef CONFIG_GCOAP_RESOURCE_TRIE_NUMOF
+#define CONFIG_GCOAP_RESOURCE_TRIE_NUMOF  (4)
+#endif
+
 /**
  * @name Bitwise positional flags for encoding resource links
  * @anchor COAP_LINK_FLAG_
@@ -1028,8 +1144,10 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
  * @brief   Initializes a CoAP response packet on a buffer
  *
  * Initializes payload location within the buffer based on packet setup.
+ * @p buf may differ from the buffer of the request, @p pdu refers to @p buf
+ * afterwards.
  *
- * @param[out] pdu      Response metadata
+ * @param[in,out] pdu   Request metadata, response metadata afterwards
  * @param[in] buf       Buffer containing the PDU
  * @param[in] len       Length of the buffer
  * @param[in] code      Response code
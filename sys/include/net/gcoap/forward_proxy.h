@@ -64,6 +64,8 @@ void gcoap_forward_proxy_init(void);
  * @return    -ENOTSUP       if the forward proxy is not compiled in
  * @return    -ENOENT        if @p pkt does not contain a Proxy-Uri option
  * @return    -EINVAL        if Proxy-Uri is malformed
+ * @return    -EMSGSIZE      if the forwarded request does not fit into
+ *                           @ref CONFIG_GCOAP_PDU_BUF_SIZE
  */
 int gcoap_forward_proxy_request_process(coap_pkt_t *pkt,
                                         const sock_udp_ep_t *client, const sock_udp_ep_t *local);
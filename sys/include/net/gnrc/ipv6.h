@@ -149,6 +149,17 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_MSG_QUEUE_SIZE_EXP    (3U)
 #endif
 
+/**
+ * @brief   Maximum number of messages the IPv6 thread takes from its message
+ *          queue at once.
+ *
+ *          See @ref msg_receive_many(). Each message in a batch takes
+ *          `sizeof(msg_t)` of the thread's stack.
+ */
+#ifndef CONFIG_GNRC_IPV6_MSG_BATCH_SIZE
+#define CONFIG_GNRC_IPV6_MSG_BATCH_SIZE        (4U)
+#endif
+
 #ifdef DOXYGEN
 /**
  * @brief   Add a static IPv6 link local address to any network interface
@@ -287,6 +287,18 @@ extern "C" {
 #  define CONFIG_GNRC_IPV6_NIB_NUMOF                 (4)
 #endif
 
+/**
+ * @brief   Number of buckets of the on-link entry index as exponent of 2
+ *
+ * Only used with module `gnrc_ipv6_nib_nc_hashed`. The index maps the IPv6
+ * address of a neighbor to its NIB entry, so neighbor lookups do not need to
+ * search all @ref CONFIG_GNRC_IPV6_NIB_NUMOF entries. Each bucket costs one
+ * pointer, so choose it in the order of @ref CONFIG_GNRC_IPV6_NIB_NUMOF.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_NC_HASH_BUCKETS_EXP
+#  define CONFIG_GNRC_IPV6_NIB_NC_HASH_BUCKETS_EXP   (4U)
+#endif
+
 /**
  * @brief Per-neighbor packet queue capacity
  *
@@ -309,6 +321,32 @@ extern "C" {
 #  define CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF            (8)
 #endif
 
+/**
+ * @brief   Number of entries in the route lookup cache
+ *
+ * Only used with module `gnrc_ipv6_nib_route_cache`. The cache remembers the
+ * best matching off-link entry of the most recently looked up destinations,
+ * so steady flows do not need to search all
+ * @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF off-link entries for every packet.
+ * Entries are replaced round-robin and the cache is flushed whenever an
+ * off-link entry is added or removed.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_SIZE
+#  define CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_SIZE      (8)
+#endif
+
+/**
+ * @brief   Milliseconds the timers of the NIB may fire late
+ *
+ * Only used with module `ztimer_slack`. The NIB's timers (neighbor
+ * unreachability detection, router and neighbor advertisements, lifetimes of
+ * addresses, prefixes and routes, ...) then share interrupts with other
+ * timers. Events are never handled early.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_TIMER_SLACK_MS
+#  define CONFIG_GNRC_IPV6_NIB_TIMER_SLACK_MS        (16)
+#endif
+
 #if CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C || defined(DOXYGEN)
 /**
  * @brief   Number of authoritative border router entries in NIB
@@ -42,6 +42,16 @@ typedef struct {
     uint16_t iface;         /**< interface to gnrc_ipv6_nib_ft_t::next_hop */
 } gnrc_ipv6_nib_ft_t;
 
+/**
+ * @brief   Counters of the route lookup cache
+ *
+ * @note    Only available with module `gnrc_ipv6_nib_route_cache`.
+ */
+typedef struct {
+    uint32_t hits;          /**< lookups answered from the cache */
+    uint32_t misses;        /**< lookups that searched the off-link entries */
+} gnrc_ipv6_nib_ft_cache_stats_t;
+
 /**
  * @brief   Gets the best matching forwarding table entry to a destination
  *
@@ -149,6 +159,21 @@ bool gnrc_ipv6_nib_ft_iter(const ipv6_addr_t *next_hop, unsigned iface,
  */
 void gnrc_ipv6_nib_ft_print(const gnrc_ipv6_nib_ft_t *fte);
 
+#if defined(MODULE_GNRC_IPV6_NIB_ROUTE_CACHE) || defined(DOXYGEN)
+/**
+ * @brief   Gets the counters of the route lookup cache
+ *
+ * @pre `stats != NULL`
+ *
+ * @note    Only available with module `gnrc_ipv6_nib_route_cache`.
+ *
+ * @see @ref CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_SIZE
+ *
+ * @param[out] stats    The counters of the route lookup cache.
+ */
+void gnrc_ipv6_nib_ft_cache_stats(gnrc_ipv6_nib_ft_cache_stats_t *stats);
+#endif  /* MODULE_GNRC_IPV6_NIB_ROUTE_CACHE */
+
 #ifdef __cplusplus
 }
 #endif
@@ -66,6 +66,9 @@
 #ifdef MODULE_NETSTATS_L2
 #include "net/netstats.h"
 #endif
+#if IS_USED(MODULE_NETSTATS_LATENCY)
+#include "net/netstats/latency.h"
+#endif
 #include "rmutex.h"
 #include "net/netif.h"
 
@@ -137,6 +140,10 @@ typedef struct {
 #if IS_USED(MODULE_NETSTATS_L2) || defined(DOXYGEN)
     netstats_t stats;                       /**< transceiver's statistics */
 #endif
+#if IS_USED(MODULE_NETSTATS_LATENCY) || defined(DOXYGEN)
+    netstats_latency_t latency;             /**< latency histograms */
+    netstats_latency_probe_t latency_probe; /**< frames currently timed */
+#endif
 #if IS_USED(MODULE_GNRC_NETIF_LORAWAN) || defined(DOXYGEN)
     gnrc_netif_lorawan_t lorawan;           /**< LoRaWAN component */
 #endif
@@ -210,6 +217,20 @@ typedef struct {
      * @note    Only available with @ref net_gnrc_netif_pktq.
      */
     gnrc_netif_pktq_t send_queue;
+#endif
+#if IS_USED(MODULE_GNRC_NETIF_RXBUF) || defined(DOXYGEN)
+    /**
+     * @brief   Buffer posted for the next received frame
+     *
+     * @note    Only available with @ref net_gnrc_netif_rxbuf.
+     */
+    gnrc_pktsnip_t *rx_buf;
+    /**
+     * @brief   Size of gnrc_netif_t::rx_buf
+     *
+     * @note    Only available with @ref net_gnrc_netif_rxbuf.
+     */
+    uint16_t rx_buf_len;
 #endif
     /**
      * @brief   Message queue for the netif thread
@@ -79,6 +79,39 @@ extern "C" {
 #define CONFIG_GNRC_NETIF_PKTQ_TIMER_US       (5000U)
 #endif
 
+/**
+ * @name    Per-class send queue limits with module `gnrc_netif_pktq_prio`
+ *
+ * The depth limits the number of packets a network interface queues for a
+ * traffic class (see @ref gnrc_netif_pktq_class_t), so a single class can't
+ * exhaust the shared pool of @ref CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE entries.
+ * Packets exceeding it are dropped and counted in netstats_t::tx_queue_drops.
+ *
+ * The quantum is the number of bytes a class below
+ * @ref GNRC_NETIF_PKTQ_CLASS_CONTROL may send per deficit round robin round,
+ * i.e. the ratio of the quanta is the ratio of the link capacity the classes
+ * get when all of them are backlogged.
+ *
+ * @see     net_gnrc_netif_pktq
+ * @{
+ */
+#ifndef CONFIG_GNRC_NETIF_PKTQ_DEPTH_CONTROL
+#define CONFIG_GNRC_NETIF_PKTQ_DEPTH_CONTROL  (4U)  /**< depth of the control queue */
+#endif
+#ifndef CONFIG_GNRC_NETIF_PKTQ_DEPTH_DEFAULT
+#define CONFIG_GNRC_NETIF_PKTQ_DEPTH_DEFAULT  (8U)  /**< depth of the best effort queue */
+#endif
+#ifndef CONFIG_GNRC_NETIF_PKTQ_DEPTH_BULK
+#define CONFIG_GNRC_NETIF_PKTQ_DEPTH_BULK     (4U)  /**< depth of the bulk queue */
+#endif
+#ifndef CONFIG_GNRC_NETIF_PKTQ_QUANTUM_DEFAULT
+#define CONFIG_GNRC_NETIF_PKTQ_QUANTUM_DEFAULT (256U) /**< quantum of the best effort queue */
+#endif
+#ifndef CONFIG_GNRC_NETIF_PKTQ_QUANTUM_BULK
+#define CONFIG_GNRC_NETIF_PKTQ_QUANTUM_BULK   (128U) /**< quantum of the bulk queue */
+#endif
+/** @} */
+
 /**
  * @brief   Number of multicast addresses needed for @ref net_gnrc_rpl "RPL".
  *
@@ -173,6 +206,18 @@ extern "C" {
 #ifndef CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US
 #define CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US   (0U)
 #endif
+
+/**
+ * @brief   Maximum number of messages a network interface thread takes from
+ *          its message queue at once.
+ *
+ *          See @ref msg_try_receive_many(). Pending events are handled before
+ *          the next batch of messages is taken. Each message in a batch takes
+ *          `sizeof(msg_t)` of the thread's stack.
+ */
+#ifndef CONFIG_GNRC_NETIF_MSG_BATCH_SIZE
+#define CONFIG_GNRC_NETIF_MSG_BATCH_SIZE   (4U)
+#endif
 /** @} */
 
 /**
@@ -112,6 +112,16 @@ extern "C" {
  *          can be used to check for presence of a valid timestamp.
  */
 #define GNRC_NETIF_HDR_FLAGS_TIMESTAMP  (0x08)
+
+/**
+ * @brief   Send queue class of the packet
+ *
+ * @details Holds the @ref gnrc_netif_pktq_class_t (plus one) of the queue
+ *          @ref net_gnrc_netif_pktq puts the packet in with module
+ *          `gnrc_netif_pktq_prio`. If 0, the class is derived from the
+ *          network layer header. Use gnrc_netif_hdr_set_qclass() to set it.
+ */
+#define GNRC_NETIF_HDR_FLAGS_QCLASS     (0x03)
 /**
  * @}
  */
@@ -153,6 +163,16 @@ typedef struct {
      */
     uint64_t timestamp;
 #endif /* MODULE_GNRC_NETIF_TIMESTAMP */
+#if IS_USED(MODULE_NETSTATS_LATENCY) || defined(DOXYGEN)
+    /**
+     * @brief   Time in µs the network interface took the packet for sending,
+     *          0 if the packet is not timed
+     *
+     * This field is only provided if module `netstats_latency` is used and
+     * only ever set by @ref net_gnrc_netif.
+     */
+    uint32_t tx_time;
+#endif
 } gnrc_netif_hdr_t;
 
 /**
@@ -268,6 +288,37 @@ static inline void gnrc_netif_hdr_set_timestamp(gnrc_netif_hdr_t *hdr,
 #endif
 }
 
+/**
+ * @brief   Set the send queue class of the packet
+ *
+ * Network layers that hide the network header from the link layer (e.g.
+ * @ref net_gnrc_sixlowpan "6LoWPAN") use this to keep the class of the
+ * original packet for all its frames.
+ *
+ * @param[out] hdr      Header to set the class in
+ * @param[in] qclass    Send queue class of the packet
+ *                      (a @ref gnrc_netif_pktq_class_t)
+ */
+static inline void gnrc_netif_hdr_set_qclass(gnrc_netif_hdr_t *hdr,
+                                             unsigned qclass)
+{
+    hdr->flags &= ~GNRC_NETIF_HDR_FLAGS_QCLASS;
+    hdr->flags |= (qclass + 1) & GNRC_NETIF_HDR_FLAGS_QCLASS;
+}
+
+/**
+ * @brief   Get the send queue class of the packet
+ *
+ * @param[in] hdr   Header to read the class from
+ *
+ * @return  The class set by gnrc_netif_hdr_set_qclass()
+ * @return  -1 if no class was set
+ */
+static inline int gnrc_netif_hdr_get_qclass(const gnrc_netif_hdr_t *hdr)
+{
+    return (int)(hdr->flags & GNRC_NETIF_HDR_FLAGS_QCLASS) - 1;
+}
+
 /**
  * @brief   Get the timestamp of the frame in nanoseconds since epoch
  * @param[in]   hdr     Header to read the timestamp from
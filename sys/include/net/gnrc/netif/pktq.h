@@ -42,7 +42,9 @@ extern "C" {
  *
  * @return  0 on success
  * @return  -1 when the pool of available gnrc_pktqueue_t entries (of size
- *          @ref CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE) is depleted
+ *          @ref CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE) is depleted or, with module
+ *          `gnrc_netif_pktq_prio`, when the queue for the class of @p pkt
+ *          (see gnrc_netif_pktq_class()) is at its depth limit
  */
 int gnrc_netif_pktq_put(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt);
 
@@ -53,6 +55,44 @@ int gnrc_netif_pktq_put(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt);
  */
 unsigned gnrc_netif_pktq_usage(void);
 
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_PRIO) || defined(DOXYGEN)
+/**
+ * @brief   Determines the send queue class of a packet
+ *
+ * Only available with module `gnrc_netif_pktq_prio`.
+ *
+ * A class set with gnrc_netif_hdr_set_qclass() takes precedence. Otherwise
+ * IPv6 packets with DSCP CS6 or CS7 as well as NDP (including 6LoWPAN-ND
+ * DAR/DAC) and RPL messages are
+ * @ref GNRC_NETIF_PKTQ_CLASS_CONTROL, IPv6 packets with DSCP CS1 or LE are
+ * @ref GNRC_NETIF_PKTQ_CLASS_BULK, and anything else is
+ * @ref GNRC_NETIF_PKTQ_CLASS_DEFAULT.
+ *
+ * @pre `pkt != NULL`
+ *
+ * @param[in] pkt   A packet, starting with its @ref net_gnrc_netif_hdr.
+ *
+ * @return  The send queue class of @p pkt
+ */
+gnrc_netif_pktq_class_t gnrc_netif_pktq_class(const gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief   Removes the next packet to send from the class queues of a
+ *          network interface
+ *
+ * @ref GNRC_NETIF_PKTQ_CLASS_CONTROL is served with strict priority, the
+ * other classes by deficit round robin.
+ *
+ * @internal    Use gnrc_netif_pktq_get() instead.
+ *
+ * @param[in] netif A network interface. May not be NULL.
+ *
+ * @return  A packet on success
+ * @return  NULL when all queues are empty
+ */
+gnrc_pktsnip_t *gnrc_netif_pktq_sched(gnrc_netif_t *netif);
+#endif
+
 /**
  * @brief   Gets a packet from the packet send queue of a network interface
  *
@@ -65,7 +105,9 @@ unsigned gnrc_netif_pktq_usage(void);
  */
 static inline gnrc_pktsnip_t *gnrc_netif_pktq_get(gnrc_netif_t *netif)
 {
-#if IS_USED(MODULE_GNRC_NETIF_PKTQ)
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_PRIO)
+    return gnrc_netif_pktq_sched(netif);
+#elif IS_USED(MODULE_GNRC_NETIF_PKTQ)
     assert(netif != NULL);
 
     gnrc_pktsnip_t *pkt = NULL;
@@ -103,6 +145,9 @@ void gnrc_netif_pktq_sched_get(gnrc_netif_t *netif);
  * @brief   Pushes a packet back to the head of the packet send queue of a
  *          network interface
  *
+ * With module `gnrc_netif_pktq_prio` the packet is pushed back to the head of
+ * the queue of its class, even if that queue is at its depth limit.
+ *
  * @pre `netif != NULL`
  * @pre `pkt != NULL`
  *
@@ -127,7 +172,16 @@ int gnrc_netif_pktq_push_back(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt);
  */
 static inline bool gnrc_netif_pktq_empty(gnrc_netif_t *netif)
 {
-#if IS_USED(MODULE_GNRC_NETIF_PKTQ)
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_PRIO)
+    assert(netif != NULL);
+
+    for (unsigned i = 0; i < GNRC_NETIF_PKTQ_CLASS_NUMOF; i++) {
+        if (netif->send_queue.queues[i] != NULL) {
+            return false;
+        }
+    }
+    return true;
+#elif IS_USED(MODULE_GNRC_NETIF_PKTQ)
     assert(netif != NULL);
 
     return (netif->send_queue.queue == NULL);
@@ -23,6 +23,10 @@
  * @author  Martine S. Lenders <m.lenders@fu-berlin.de>
  */
 
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "modules.h"
 #include "net/gnrc/pktqueue.h"
 #include "xtimer.h"
 
@@ -30,11 +34,47 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Traffic classes of the send queue
+ *
+ * Only available with module `gnrc_netif_pktq_prio`. Without it all packets
+ * share one FIFO queue.
+ */
+typedef enum {
+    /**
+     * @brief   Network control traffic (e.g. NDP, RPL, DSCP CS6 and CS7)
+     *
+     * Always served before any other class.
+     */
+    GNRC_NETIF_PKTQ_CLASS_CONTROL = 0,
+    GNRC_NETIF_PKTQ_CLASS_DEFAULT,      /**< best effort traffic */
+    GNRC_NETIF_PKTQ_CLASS_BULK,         /**< lower effort traffic (DSCP CS1 and LE) */
+    GNRC_NETIF_PKTQ_CLASS_NUMOF,        /**< number of traffic classes */
+} gnrc_netif_pktq_class_t;
+
 /**
  * @brief   A packet queue for @ref net_gnrc_netif with a de-queue timer
  */
 typedef struct {
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_PRIO) || defined(DOXYGEN)
+    /**
+     * @brief   One packet queue per traffic class
+     *
+     * Replaces gnrc_netif_pktq_t::queue with module `gnrc_netif_pktq_prio`.
+     */
+    gnrc_pktqueue_t *queues[GNRC_NETIF_PKTQ_CLASS_NUMOF];
+    /**
+     * @brief   Deficit counters in bytes for deficit round robin between the
+     *          classes below @ref GNRC_NETIF_PKTQ_CLASS_CONTROL
+     */
+    uint16_t deficit[GNRC_NETIF_PKTQ_CLASS_NUMOF];
+    uint8_t depth[GNRC_NETIF_PKTQ_CLASS_NUMOF]; /**< number of queued packets per class */
+    uint8_t drr_class;          /**< class currently served by deficit round robin */
+    bool drr_credited;          /**< gnrc_netif_pktq_t::drr_class already got its
+                                 *   quantum in this round */
+#else
     gnrc_pktqueue_t *queue;     /**< the actual packet queue class */
+#endif
 #if CONFIG_GNRC_NETIF_PKTQ_TIMER_US >= 0
     msg_t dequeue_msg;          /**< message for gnrc_netif_pktq_t::dequeue_timer to send */
     xtimer_t dequeue_timer;     /**< timer to schedule next sending of
@@ -0,0 +1,85 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    net_gnrc_netif_rxbuf    Pre-posted receive buffers
+ * @ingroup     net_gnrc_netif
+ * @brief       Receives frames directly into a packet buffer snip that was
+ *              allocated ahead of time
+ *
+ * Without this module, a network interface asks the device for the size of a
+ * received frame, allocates a snip of that size and then asks the device
+ * again to copy the frame into it. With this module, every interface keeps
+ * a snip of the maximum frame size of its link layer posted. A frame is copied
+ * into it with a single call to @ref netdev_driver_t::recv(), the snip is
+ * trimmed to the frame size and a new buffer is posted after the packet was
+ * handed to the upper layers.
+ *
+ * This requires the device driver to accept a buffer larger than the frame
+ * without asking for the frame size first, as specified by the netdev API.
+ * This was verified for the native TAP device and @ref drivers_at86rf2xx.
+ *
+ * To activate, use `USEMODULE += gnrc_netif_rxbuf` in your applications
+ * Makefile. Currently supported are
+ *
+ * - Ethernet
+ * - IEEE 802.15.4
+ *
+ * @note    Every interface holds a buffer of its maximum frame size in the
+ *          packet buffer at all times, so make sure
+ *          @ref CONFIG_GNRC_PKTBUF_SIZE is large enough. That is
+ *          @ref ETHERNET_FRAME_LEN (1514 bytes) for Ethernet and
+ *          @ref IEEE802154_FRAME_LEN_MAX (127 bytes) for IEEE 802.15.4, plus
+ *          the snip's management data. If a SUN PHY (IEEE 802.15.4g,
+ *          `netdev_ieee802154_mr_*`) is used, every IEEE 802.15.4 interface
+ *          holds @ref IEEE802154G_FRAME_LEN_MAX (2047 bytes) instead.
+ *
+ * @{
+ *
+ * @file
+ * @brief   Definitions for pre-posted receive buffers
+ */
+
+#include <stddef.h>
+
+#include "net/gnrc/netif.h"
+#include "net/gnrc/pkt.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Receives a frame from the device of @p netif into the posted
+ *          receive buffer
+ *
+ * If no buffer is posted, e.g. because the packet buffer was full when
+ * trying to post it, a new one is allocated.
+ *
+ * @param[in] netif     The network interface.
+ * @param[in] max_len   Maximum frame size of the link layer.
+ * @param[out] info     Status information for the received frame, passed to
+ *                      @ref netdev_driver_t::recv(). May be NULL.
+ *
+ * @return  The received frame, trimmed to its size.
+ * @return  NULL, if no frame was received. The frame is dropped.
+ */
+gnrc_pktsnip_t *gnrc_netif_rxbuf_recv(gnrc_netif_t *netif, size_t max_len,
+                                      void *info);
+
+/**
+ * @brief   Posts a new receive buffer to @p netif, if it does not have one
+ *
+ * @param[in] netif     The network interface.
+ */
+void gnrc_netif_rxbuf_post(gnrc_netif_t *netif);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
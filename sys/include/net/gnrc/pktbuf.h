@@ -63,6 +63,74 @@ extern "C" {
 #ifndef CONFIG_GNRC_PKTBUF_SIZE
 #define CONFIG_GNRC_PKTBUF_SIZE    (6144)
 #endif
+
+/**
+ * @brief   Binary logarithm of the number of second-level size classes per
+ *          first-level size class of `gnrc_pktbuf_static_tlsf`
+ *
+ * @details A higher value reduces the memory wasted by rounding allocations
+ *          up to their size class at the cost of
+ *          `2 * 2^CONFIG_GNRC_PKTBUF_STATIC_TLSF_SL_LOG2` bytes of RAM for
+ *          each first-level size class. Must be between 1 and 5.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_STATIC_TLSF_SL_LOG2
+#define CONFIG_GNRC_PKTBUF_STATIC_TLSF_SL_LOG2  (3)
+#endif
+
+/**
+ * @brief   Number of packet snip descriptors in the slab of
+ *          `gnrc_pktbuf_static_snip_slab`
+ *
+ * @details The slab is allocated in addition to the
+ *          @ref CONFIG_GNRC_PKTBUF_SIZE bytes of the packet buffer. When it
+ *          is exhausted, descriptors are allocated from the packet buffer.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_STATIC_SNIP_SLAB_NUMOF
+#define CONFIG_GNRC_PKTBUF_STATIC_SNIP_SLAB_NUMOF   (32)
+#endif
+
+/**
+ * @brief   Number of threads that get a cache of `gnrc_pktbuf_static_magazine`
+ *
+ * @details Threads claim a cache on their first allocation and keep it. Any
+ *          further threads use the packet buffer without a cache.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_NUMOF
+#define CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_NUMOF    (4)
+#endif
+
+/**
+ * @brief   Number of chunks of one size a magazine of
+ *          `gnrc_pktbuf_static_magazine` holds
+ *
+ * @details Empty magazines are refilled and full magazines drained by half
+ *          of this number of chunks at once.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_SIZE
+#define CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_SIZE     (8)
+#endif
+
+/**
+ * @brief   Largest data chunk in bytes cached by `gnrc_pktbuf_static_magazine`
+ *
+ * @details Packet snips with more data are always allocated from the packet
+ *          buffer directly.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_CHUNK_MAX
+#define CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_CHUNK_MAX    (64)
+#endif
+
+/**
+ * @brief   Maximum number of bytes of the packet buffer cached per thread by
+ *          `gnrc_pktbuf_static_magazine`
+ *
+ * @details Up to @ref CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_NUMOF times this
+ *          many bytes are not available to other threads. The cached
+ *          chunks are returned when an allocation of the owning thread fails.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_BYTES
+#define CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_BYTES    (512)
+#endif
 /** @} */
 
 /**
@@ -296,13 +364,62 @@ gnrc_pktsnip_t *gnrc_pktbuf_reverse_snips(gnrc_pktsnip_t *pkt);
  */
 int gnrc_pktbuf_merge(gnrc_pktsnip_t *pkt);
 
-#ifdef DEVELHELP
+#if defined(DEVELHELP) || defined(DOXYGEN)
+/**
+ * @brief   Statistics on @ref gnrc_pktbuf_merge()
+ *
+ * @note    Only available with DEVELHELP defined.
+ */
+typedef struct {
+    unsigned merged;    /**< number of merges that copied data */
+    unsigned avoided;   /**< number of merges on already contiguous snips */
+    size_t bytes;       /**< number of bytes copied by merges */
+} gnrc_pktbuf_merge_stats_t;
+
+/**
+ * @brief   Get the statistics on @ref gnrc_pktbuf_merge()
+ *
+ * @note    Only available with DEVELHELP defined.
+ *
+ * @details Every merge on the send path of a network interface is a copy of
+ *          the complete frame. Use these counters to verify that a send path
+ *          is zero-copy.
+ *
+ * @return  The merge statistics since boot.
+ */
+const gnrc_pktbuf_merge_stats_t *gnrc_pktbuf_merge_stats(void);
+
+/**
+ * @brief   Statistics on the lock of the packet buffer
+ *
+ * @note    Only available with DEVELHELP defined.
+ */
+typedef struct {
+    unsigned locked;    /**< number of times the packet buffer was locked */
+    unsigned contended; /**< number of times a thread had to wait for the
+                         *   lock */
+} gnrc_pktbuf_lock_stats_t;
+
+/**
+ * @brief   Get the statistics on the lock of the packet buffer
+ *
+ * @note    Only available with DEVELHELP defined.
+ *
+ * @details All threads using the packet buffer serialize on a single lock.
+ *          Use these counters to assess the contention between them, e.g.
+ *          with and without `gnrc_pktbuf_static_magazine`.
+ *
+ * @return  The lock statistics since boot.
+ */
+const gnrc_pktbuf_lock_stats_t *gnrc_pktbuf_lock_stats(void);
+
 /**
  * @brief   Prints some statistics about the packet buffer to stdout.
  *
  * @note    Only available with DEVELHELP defined.
  *
- * @details Statistics include maximum number of reserved bytes.
+ * @details Statistics include maximum number of reserved bytes and the
+ *          number of merges.
  */
 void gnrc_pktbuf_stats(void);
 #endif
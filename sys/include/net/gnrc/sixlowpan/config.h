@@ -125,6 +125,23 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER              (0U)
 #endif
 
+/**
+ * @brief   Number of buckets of the reassembly buffer index as exponent of 2
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_rb_hashed](@ref net_gnrc_sixlowpan_frag_rb_hashed)
+ *          module
+ *
+ * The index maps the (source, destination, tag) tuple of a datagram to its
+ * reassembly buffer entry, so fragments of datagrams already in reassembly
+ * do not need to search all @ref CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE
+ * entries. Each bucket costs one pointer, so choose it in the order of
+ * @ref CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_BUCKETS_EXP
+#define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_BUCKETS_EXP       (3U)
+#endif
+
 /**
  * @brief   Registration lifetime in minutes for the address registration option
  *
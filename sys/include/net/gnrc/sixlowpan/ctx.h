@@ -79,6 +79,10 @@ typedef struct {
 /**
  * @brief   Gets a context matching the given IPv6 address best with its prefix.
  *
+ * @details Of all contexts whose prefix matches @p addr, the one with the
+ *          longest prefix is returned. If there are multiple, the one with the
+ *          lowest ID is returned.
+ *
  * @param[in] addr  An IPv6 address.
  *
  * @return  The context associated with the best prefix for @p addr.
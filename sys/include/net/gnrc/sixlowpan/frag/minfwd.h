@@ -59,6 +59,34 @@ int gnrc_sixlowpan_frag_minfwd_forward(gnrc_pktsnip_t *pkt,
                                        gnrc_sixlowpan_frag_vrb_t *vrbe,
                                        unsigned page);
 
+/**
+ * @brief   Forwards a fragment according to a VRB entry without copying it
+ *
+ * @details Only the datagram tag in the fragmentation header of @p pkt is
+ *          rewritten, the fragment itself is handed to the outgoing
+ *          interface as is. If @p pkt is shared with another user, it is
+ *          duplicated first (see @ref gnrc_pktbuf_start_write()).
+ *
+ * @param[in] pkt       The fragment to forward, starting with its
+ *                      fragmentation header, without
+ *                      @ref GNRC_NETTYPE_NETIF snip. Is consumed by this
+ *                      function.
+ * @param[in] vrbe      Virtual reassembly buffer containing the forwarding
+ *                      information. Removed when datagram was completely
+ *                      forwarded.
+ * @param[in] page      Current 6Lo dispatch parsing page.
+ *
+ * @pre `vrbe != NULL`
+ * @pre `(pkt != NULL) && sixlowpan_frag_is(pkt->data)`
+ *
+ * @return  0 on success.
+ * @return  -ENOMEM, when packet buffer is too full to prepare packet for
+ *          forwarding.
+ */
+int gnrc_sixlowpan_frag_minfwd_forward_inplace(gnrc_pktsnip_t *pkt,
+                                               gnrc_sixlowpan_frag_vrb_t *vrbe,
+                                               unsigned page);
+
 /**
  * @brief   Fragments a packet with just the IPHC (and padding payload to get
  *          to 8 byte) as the first fragment
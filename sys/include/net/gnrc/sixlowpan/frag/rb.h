@@ -25,6 +25,7 @@
 #include <stdalign.h>
 
 #include "architecture.h"
+#include "bitfield.h"
 #include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/pkt.h"
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
@@ -60,6 +61,23 @@ typedef struct gnrc_sixlowpan_frag_rb_int {
     uint16_t end;               /**< end byte of the fragment interval */
 } gnrc_sixlowpan_frag_rb_int_t;
 
+/**
+ * @brief   Granularity of gnrc_sixlowpan_frag_rb_base_t::covered in bytes
+ *
+ * All fragments but the last one of a datagram end at a multiple of 8 bytes
+ * ([RFC 4944, section 5.3](https://tools.ietf.org/html/rfc4944#section-5.3)),
+ * so different fragments never share a unit.
+ */
+#define GNRC_SIXLOWPAN_FRAG_RB_COVERED_UNIT    (8U)
+
+/**
+ * @brief   Number of units tracked in gnrc_sixlowpan_frag_rb_base_t::covered
+ *
+ * Covers datagrams up to the IPv6 minimum MTU of 1280 bytes.
+ */
+#define GNRC_SIXLOWPAN_FRAG_RB_COVERED_NUMOF   (1280U / \
+                                                 GNRC_SIXLOWPAN_FRAG_RB_COVERED_UNIT)
+
 /**
  * @brief   Base class for both reassembly buffer and virtual reassembly buffer
  *
@@ -87,6 +105,15 @@ typedef struct {
     uint16_t current_size;
     uint32_t arrival;                           /**< time in microseconds of arrival of
                                                  *   last received fragment */
+    /**
+     * @brief   Units of @ref GNRC_SIXLOWPAN_FRAG_RB_COVERED_UNIT bytes of the
+     *          datagram covered by gnrc_sixlowpan_frag_rb_base_t::ints
+     *
+     * Allows to check a fragment for overlaps without going through all
+     * intervals. Only if a unit of the fragment was received, or the fragment
+     * ends beyond the tracked units, the intervals are checked.
+     */
+    BITFIELD(covered, GNRC_SIXLOWPAN_FRAG_RB_COVERED_NUMOF);
 } gnrc_sixlowpan_frag_rb_base_t;
 
 /**
@@ -95,12 +122,21 @@ typedef struct {
  * A recipient of a fragment SHALL use
  *
  */
-typedef struct {
+typedef struct gnrc_sixlowpan_frag_rb {
     gnrc_sixlowpan_frag_rb_base_t super;        /**< base class */
     /**
      * @brief   The reassembled packet in the packet buffer
      */
     gnrc_pktsnip_t *pkt;
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASHED) || defined(DOXYGEN)
+    /**
+     * @brief   Next entry in the same bucket of the reassembly buffer index
+     *
+     * @note    Only available with module `gnrc_sixlowpan_frag_rb_hashed`
+     *          compiled in.
+     */
+    struct gnrc_sixlowpan_frag_rb *idx_next;
+#endif
 #if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) || defined(DOXYGEN)
     /**
      * @brief   Bitmap for received fragments
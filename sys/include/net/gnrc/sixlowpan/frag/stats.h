@@ -34,6 +34,9 @@ typedef struct {
                              *   reassembly buffer is full */
     unsigned frag_full;     /**< counts the number of events that there where
                              *   no @ref gnrc_sixlowpan_frag_fb_t available */
+    unsigned ints_full;     /**< counts the number of events where the pool of
+                             *   fragment intervals of the (virtual)
+                             *   reassembly buffer is exhausted */
     unsigned datagrams;     /**< reassembled datagrams */
     unsigned fragments;     /**< total fragments of reassembled fragments */
 #if defined(MODULE_GNRC_SIXLOWPAN_FRAG_VRB) || DOXYGEN
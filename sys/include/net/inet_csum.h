@@ -49,6 +49,28 @@ extern "C" {
  */
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len);
 
+/**
+ * @brief   Copies @p src to @p dst and calculates the unnormalized Internet
+ *          Checksum of the copied data in the same pass
+ *
+ * @details Behaves like @ref inet_csum_slice() on @p src, but touches the data
+ *          only once. Use this instead of `memcpy()` followed by
+ *          @ref inet_csum_slice() when data is moved into a packet buffer
+ *          anyway.
+ *
+ * @param[in] sum       An initial value for the checksum.
+ * @param[out] dst      Destination buffer, must hold at least @p len bytes
+ *                      and must not overlap with @p src.
+ * @param[in] src       Source buffer.
+ * @param[in] len       Length of @p src in byte.
+ * @param[in] accum_len Accumulated length of checksum domain that has already
+ *                      been checksummed.
+ *
+ * @return  The unnormalized Internet Checksum of @p src.
+ */
+uint16_t inet_csum_slice_copy(uint16_t sum, uint8_t *dst, const uint8_t *src,
+                              uint16_t len, size_t accum_len);
+
 /**
  * @brief   Calculates the unnormalized Internet Checksum of @p buf, where the
  *          buffer provides a standalone domain for the checksum.
@@ -46,6 +46,15 @@
  * For either API, the caller *must* write options in order by option number
  * (see "CoAP option numbers" in [CoAP defines](group__net__coap.html)).
  *
+ * coap_parse() records where the options of a message start, so the option
+ * getters like coap_opt_get_uint() or coap_get_uri_path() do not decode the
+ * options in front of the one they read. They still go through the recorded
+ * options until they find the one asked for. With the `nanocoap_option_index`
+ * module, coap_parse() also records which option numbers below 32 are present.
+ * These are all options of RFC 7252 except Proxy-Uri, Proxy-Scheme and Size1,
+ * as well as Observe and Block. The getters then find such an option, or know
+ * it is absent, without going through the others.
+ *
  * ## Server path matching
  *
  * By default the URI-path of an incoming request should match exactly one of
@@ -66,6 +75,11 @@
  * and exact matching should be register, and then a second one with the path
  * `/resource01/` and subtree matching.
  *
+ * The resources are searched linearly, so dispatching a request takes longer
+ * the more resources there are. For large resource trees, the
+ * @ref net_nanocoap_resource_trie "nanocoap_resource_trie" module finds the
+ * same resource in a time that depends on the length of the path instead.
+ *
  * @{
  *
  * @file
@@ -115,6 +129,9 @@ extern "C" {
 #define COAP_IPATCH             (0x40)
 #define COAP_IGNORE             (0xFF)   /**< For situations where the method
                                               is not important */
+#define COAP_OFFLOAD            (0x4000) /**< Handler may take long, gcoap
+                                              runs it in a worker thread
+                                              (`gcoap_workers` module) */
 #define COAP_MATCH_SUBTREE      (0x8000) /**< Path is considered as a prefix
                                               when matching */
 /** @} */
@@ -226,6 +243,10 @@ typedef struct {
     uint16_t options_len;                             /**< length of options array */
     coap_optpos_t options[CONFIG_NANOCOAP_NOPTS_MAX]; /**< option offset array     */
     BITFIELD(opt_crit, CONFIG_NANOCOAP_NOPTS_MAX);    /**< unhandled critical option */
+#if defined(MODULE_NANOCOAP_OPTION_INDEX) || DOXYGEN
+    uint32_t opt_mask;                                /**< option numbers below 32
+                                                           in the options array */
+#endif
 #ifdef MODULE_GCOAP
     uint32_t observe_value;                           /**< observe value           */
 #endif
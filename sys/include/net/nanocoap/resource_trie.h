@@ -0,0 +1,128 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    net_nanocoap_resource_trie nanoCoAP resource trie
+ * @ingroup     net_nanocoap
+ * @brief       Index of CoAP resources by path segment
+ *
+ * Without this module, a request is dispatched by comparing its Uri-Path with
+ * the path of every resource until one matches, so the dispatch time grows
+ * with the number of resources. With the `nanocoap_resource_trie` module, a
+ * trie over the path segments of a resource array is built once and a request
+ * is dispatched by walking down the trie along the segments of its Uri-Path.
+ *
+ * The trie gives the same result as the linear search: the first resource in
+ * the array whose path matches (see @ref coap_match_path()) and which allows
+ * the request method. Resources with @ref COAP_MATCH_SUBTREE keep matching
+ * any path their path is a prefix of.
+ *
+ * If the module is used, the following resource arrays are indexed:
+ *
+ * - the resources of every listener registered with
+ *   gcoap_register_listener() that uses the default request matcher
+ * - the resources defined with @ref NANOCOAP_RESOURCE for coap_handle_req()
+ *
+ * The nodes of all tries are taken from a common pool of
+ * @ref CONFIG_NANOCOAP_RESOURCE_TRIE_NODES nodes. A resource array whose trie
+ * does not fit into the pool is searched linearly.
+ *
+ * @{
+ *
+ * @file
+ * @brief       nanoCoAP resource trie API
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "net/nanocoap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of trie nodes shared by all resource tries
+ *
+ * @details Every distinct path segment, i.e. every distinct prefix of the
+ *          resource paths ending in front of a `/` or at the end of a path,
+ *          takes one node.
+ */
+#ifndef CONFIG_NANOCOAP_RESOURCE_TRIE_NODES
+#define CONFIG_NANOCOAP_RESOURCE_TRIE_NODES     (64)
+#endif
+
+/**
+ * @brief   Resource trie over an array of resources
+ */
+typedef struct {
+    const coap_resource_t *resources;   /**< indexed resources */
+    uint16_t resources_numof;           /**< number of indexed resources */
+    uint16_t root;                      /**< first node of the top level */
+} coap_resource_trie_t;
+
+/**
+ * @brief   Builds a trie over @p resources
+ *
+ * The trie refers to @p resources and the paths of the resources, so both
+ * must remain valid and unchanged while the trie is used.
+ *
+ * @param[out]  trie            trie to build
+ * @param[in]   resources       array of resources
+ * @param[in]   resources_numof number of resources in @p resources
+ *
+ * @retval  0       on success
+ * @retval  -ENOMEM if the nodes of the trie do not fit into the node pool
+ * @retval  -EINVAL if a path does not start with `/` or there are too many
+ *                  resources
+ */
+int coap_resource_trie_init(coap_resource_trie_t *trie,
+                            const coap_resource_t *resources,
+                            size_t resources_numof);
+
+/**
+ * @brief   Finds the resource for a request
+ *
+ * @param[in]   trie        trie to search
+ * @param[in]   uri         Uri-Path of the request, as written by
+ *                          coap_get_uri_path()
+ * @param[in]   method_flag method of the request, see coap_method2flag()
+ * @param[out]  resource    first resource matching @p uri and @p method_flag
+ *
+ * @retval  0           on success
+ * @retval  -ENOTSUP    if resources match @p uri, but none allows the method
+ * @retval  -ENOENT     if no resource matches @p uri
+ */
+int coap_resource_trie_find(const coap_resource_trie_t *trie, const char *uri,
+                            coap_method_flags_t method_flag,
+                            const coap_resource_t **resource);
+
+/**
+ * @brief   Generic coap resource handler using a resource trie
+ *
+ * Equivalent to coap_tree_handler() on the resources of @p trie.
+ *
+ * @param[in]   pkt             pointer to (parsed) CoAP packet
+ * @param[out]  resp_buf        buffer for response
+ * @param[in]   resp_buf_len    size of response buffer
+ * @param[in]   ctx             CoAP request context information
+ * @param[in]   trie            trie over the coap endpoint resources
+ *
+ * @returns     size of the reply packet on success
+ * @returns     <0 on error
+ */
+ssize_t coap_resource_trie_handler(coap_pkt_t *pkt, uint8_t *resp_buf,
+                                   unsigned resp_buf_len,
+                                   coap_request_ctx_t *ctx,
+                                   const coap_resource_trie_t *trie);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -43,6 +43,11 @@ extern "C" {
 #define NETSTATS_NB_QUEUE_SIZE  (4)
 #endif
 
+/**
+ * @brief   Number of send queues counted in netstats_t::tx_queue_drops
+ */
+#define NETSTATS_TX_QUEUE_NUMOF (3)
+
 /**
  * @name @ref net_netstats module names
  * @{
@@ -50,6 +55,7 @@ extern "C" {
 #define NETSTATS_LAYER2     (0x01)
 #define NETSTATS_IPV6       (0x02)
 #define NETSTATS_RPL        (0x03)
+#define NETSTATS_LATENCY    (0x04)  /**< see @ref net_netstats_latency */
 #define NETSTATS_ALL        (0xFF)
 /** @} */
 
@@ -67,6 +73,14 @@ typedef struct {
     uint32_t tx_bytes;          /**< sent bytes */
     uint32_t rx_count;          /**< received (data) packets */
     uint32_t rx_bytes;          /**< received bytes */
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_PRIO) || DOXYGEN
+    /**
+     * @brief   packets dropped per send queue class because the queue was full
+     *
+     * Indexed by @ref gnrc_netif_pktq_class_t.
+     */
+    uint32_t tx_queue_drops[NETSTATS_TX_QUEUE_NUMOF];
+#endif
 } netstats_t;
 
 /**
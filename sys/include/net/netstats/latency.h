@@ -0,0 +1,161 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    net_netstats_latency Latency histograms
+ * @ingroup     net_netstats
+ * @brief       Records where packet latency goes on a network interface
+ *
+ * With module `netstats_latency`, @ref net_gnrc_netif keeps four histograms
+ * per interface:
+ *
+ * - @ref NETSTATS_LATENCY_TX_QUEUE: from the interface thread taking a packet
+ *   for sending until it is handed to the driver, i.e. the time spent in the
+ *   @ref net_gnrc_netif_pktq "send queue"
+ * - @ref NETSTATS_LATENCY_TX_ACCESS: from the handover to the driver until
+ *   the driver signals @ref NETDEV_EVENT_TX_STARTED (CSMA/backoff). Drivers
+ *   that do channel access in hardware signal the start before it, so for
+ *   them this time is part of @ref NETSTATS_LATENCY_TX_AIR.
+ * - @ref NETSTATS_LATENCY_TX_AIR: from the start of the transmission until
+ *   the driver reports its completion
+ * - @ref NETSTATS_LATENCY_RX: from the interrupt of the device until the
+ *   received packet is handed to the upper layer
+ *
+ * Bucket `i` counts samples in [2^i, 2^(i + 1)) µs, bucket 0 also counts
+ * 0 µs and the last bucket is open ended.
+ *
+ * The histograms are only ever incremented, with atomic operations, so they
+ * can be read at any time without locking. To keep the overhead in check
+ * under load, only every @ref CONFIG_NETSTATS_LATENCY_SAMPLE_RATE th frame
+ * is timed.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Latency histogram definitions
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "atomic_utils.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of buckets per histogram
+ *
+ * The default covers up to 32.768 ms in the last closed bucket.
+ */
+#ifndef CONFIG_NETSTATS_LATENCY_BUCKETS
+#define CONFIG_NETSTATS_LATENCY_BUCKETS     (16U)
+#endif
+
+/**
+ * @brief   Time only every n-th frame
+ */
+#ifndef CONFIG_NETSTATS_LATENCY_SAMPLE_RATE
+#define CONFIG_NETSTATS_LATENCY_SAMPLE_RATE (1U)
+#endif
+
+/**
+ * @brief   Histograms recorded per network interface
+ */
+typedef enum {
+    NETSTATS_LATENCY_TX_QUEUE = 0,  /**< waiting for the driver */
+    NETSTATS_LATENCY_TX_ACCESS,     /**< channel access by the driver */
+    NETSTATS_LATENCY_TX_AIR,        /**< transmission */
+    NETSTATS_LATENCY_RX,            /**< interrupt to upper layer */
+    NETSTATS_LATENCY_NUMOF,         /**< number of histograms */
+} netstats_latency_kind_t;
+
+/**
+ * @brief   Latency histograms
+ *
+ * Retrieved with @ref NETOPT_STATS and context @ref NETSTATS_LATENCY.
+ */
+typedef struct {
+    /**
+     * @brief   Number of samples per bucket
+     */
+    uint32_t count[NETSTATS_LATENCY_NUMOF][CONFIG_NETSTATS_LATENCY_BUCKETS];
+} netstats_latency_t;
+
+/**
+ * @brief   State of the transmission currently timed
+ */
+typedef enum {
+    NETSTATS_LATENCY_TX_IDLE = 0,   /**< no timed transmission */
+    NETSTATS_LATENCY_TX_HANDOVER,   /**< handed to the driver */
+    NETSTATS_LATENCY_TX_STARTED,    /**< driver started the transmission */
+} netstats_latency_tx_state_t;
+
+/**
+ * @brief   Timestamps of the frames currently timed by a network interface
+ */
+typedef struct {
+    uint32_t rx_isr;        /**< time of the last device interrupt in µs,
+                             *   0 if already consumed (set from ISR) */
+    uint32_t tx_time;       /**< start of the current TX phase in µs */
+    uint16_t frames;        /**< frame counter for sampling */
+    uint8_t tx_state;       /**< a @ref netstats_latency_tx_state_t */
+    bool tx_events;         /**< driver reports TX completion by events */
+} netstats_latency_probe_t;
+
+/**
+ * @brief   Gets the bucket of a latency
+ *
+ * @param[in] usec  A latency in µs
+ *
+ * @return  Index of the bucket for @p usec
+ */
+static inline unsigned netstats_latency_bucket(uint32_t usec)
+{
+    unsigned bucket = 0;
+
+    while ((usec >>= 1) && (bucket < (CONFIG_NETSTATS_LATENCY_BUCKETS - 1))) {
+        bucket++;
+    }
+    return bucket;
+}
+
+/**
+ * @brief   Records a latency sample
+ *
+ * Can be called from interrupt context.
+ *
+ * @param[in,out] stats Histograms to record to
+ * @param[in] kind      Histogram to record to
+ * @param[in] usec      The latency in µs
+ */
+static inline void netstats_latency_record(netstats_latency_t *stats,
+                                           netstats_latency_kind_t kind,
+                                           uint32_t usec)
+{
+    atomic_fetch_add_u32(&stats->count[kind][netstats_latency_bucket(usec)],
+                         1);
+}
+
+/**
+ * @brief   Decides if the next frame is timed
+ *
+ * @param[in,out] probe The timestamps of the network interface
+ *
+ * @return  true, for every @ref CONFIG_NETSTATS_LATENCY_SAMPLE_RATE th call
+ */
+static inline bool netstats_latency_sample(netstats_latency_probe_t *probe)
+{
+    return (probe->frames++ % CONFIG_NETSTATS_LATENCY_SAMPLE_RATE) == 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -289,6 +289,11 @@ typedef struct ztimer_base ztimer_base_t;
  */
 typedef struct ztimer_clock ztimer_clock_t;
 
+/**
+ * @brief ztimer_wheel_t forward declaration
+ */
+typedef struct ztimer_wheel ztimer_wheel_t;
+
 /**
  * @brief Type of callbacks in @ref ztimer_t "timers"
  */
@@ -300,6 +305,10 @@ typedef void (*ztimer_callback_t)(void *arg);
 struct ztimer_base {
     ztimer_base_t *next;        /**< next timer in list */
     uint32_t offset;            /**< offset from last timer in list */
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+    ztimer_base_t **pprev;      /**< link pointing to this timer, if on a
+                                     timer wheel (NULL if not set) */
+#endif
 };
 
 /**
@@ -320,6 +329,10 @@ typedef struct {
     ztimer_base_t base;             /**< clock list entry */
     ztimer_callback_t callback;     /**< timer callback function pointer */
     void *arg;                      /**< timer callback argument */
+#if MODULE_ZTIMER_SLACK || DOXYGEN
+    bool coalesced;                 /**< target was moved within the slack
+                                         to expire with other timers    */
+#endif
 } ztimer_t;
 
 /**
@@ -371,6 +384,11 @@ struct ztimer_clock {
     ztimer_base_t list;             /**< list of active timers              */
     const ztimer_ops_t *ops;        /**< pointer to methods structure       */
     ztimer_base_t *last;            /**< last timer in queue, for _is_set() */
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+    ztimer_wheel_t *wheel;          /**< timer wheel storage, if not NULL
+                                         timers are kept on the wheel
+                                         instead of in @ref list         */
+#endif
     uint16_t adjust_set;            /**< will be subtracted on every set()  */
     uint16_t adjust_sleep;          /**< will be subtracted on every sleep(),
                                          in addition to adjust_set          */
@@ -386,6 +404,13 @@ struct ztimer_clock {
     uint32_t lower_last;            /**< timer value at last now() call     */
     ztimer_now_t checkpoint;        /**< cumulated time at last now() call  */
 #endif
+#if MODULE_ZTIMER_SLACK || DOXYGEN
+    uint32_t fired;                 /**< number of timers fired             */
+    uint32_t coalesced;             /**< number of timers that fired with
+                                         an earlier timer because their
+                                         target was moved within their
+                                         slack                              */
+#endif
 #if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND || DOXYGEN
     uint8_t block_pm_mode;          /**< min. pm mode to block for the clock to run
                                          don't use in combination with ztimer_ondemand! */
@@ -460,6 +485,35 @@ static inline bool ztimer_release(ztimer_clock_t *clock)
  */
 uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val);
 
+#if MODULE_ZTIMER_SLACK || DOXYGEN
+/**
+ * @brief   Set a timer with a tolerated delay on a clock
+ *
+ * Like @ref ztimer_set(), but @p timer may fire anywhere between @p val and
+ * @p val + @p slack ticks from now. This allows the clock to coalesce the
+ * expiration of @p timer with other timers into a single interrupt:
+ *
+ * - if the next interrupt of @p clock is due within the window, @p timer
+ *   is set to expire together with it
+ * - otherwise the target is rounded up to a multiple of the largest power of
+ *   two not exceeding @p slack, so that timers with a similar slack share
+ *   their expiration time
+ *
+ * Timers set with @ref ztimer_set() are not affected.
+ *
+ * @note    Only available with the `ztimer_slack` module.
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ * @param[in]   timer       timer entry to set
+ * @param[in]   val         earliest timer target (relative ticks from now)
+ * @param[in]   slack       ticks @p timer may fire later than @p val
+ *
+ * @return The value of @ref ztimer_now() that @p timer was set against
+ */
+uint32_t ztimer_set_slack(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val,
+                          uint32_t slack);
+#endif
+
 /**
  * @brief   Check if a timer is currently active
  *
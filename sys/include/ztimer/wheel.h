@@ -0,0 +1,211 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_ztimer_wheel  ztimer timer wheel
+ * @ingroup     sys_ztimer
+ * @brief       Hierarchical timer wheel storage for ztimer clocks
+ *
+ * By default, every ztimer clock keeps its armed timers in a sorted delta
+ * list, so setting or removing a timer is O(n) in the number of armed
+ * timers. For clocks that carry hundreds of timers (CoAP retransmissions,
+ * NIB reachability, TCP, ...) this shows up in interrupt latency.
+ *
+ * When the `ztimer_wheel` module is used, a clock can be given a
+ * @ref ztimer_wheel_t using @ref ztimer_wheel_init(). Such a clock stores its
+ * timers in a hierarchical timer wheel instead:
+ *
+ * - the 32 bit target time of a timer is split into
+ *   @ref ZTIMER_WHEEL_LEVELS digits of @ref CONFIG_ZTIMER_WHEEL_LEVEL_BITS bits
+ * - a timer lives on the level of the most significant digit in which its
+ *   target differs from the clock's base time, in the slot given by that digit
+ * - when the base time moves, only the slots that have been passed are
+ *   cascaded down to lower levels
+ *
+ * Inserting and removing a timer is O(1), apart from finding out whether the
+ * timer is set (see below). If the earliest non-empty slot holds more than
+ * one timer, the underlying timer is armed for the time that slot has to be
+ * cascaded instead of the exact target of the earliest timer, so finding the
+ * next event does not depend on the number of timers either.
+ * Each timer is cascaded at most @ref ZTIMER_WHEEL_LEVELS - 1 times during
+ * its lifetime, at the cost of an additional interrupt per cascaded slot.
+ *
+ * The ztimer API (@ref ztimer_set(), @ref ztimer_remove(), ...) stays the
+ * same, including clock extension and `ztimer_ondemand`, with these
+ * differences in behavior:
+ *
+ * - timers set to the very same target time are not guaranteed to fire in
+ *   the order they were set
+ * - whether a timer is set is decided by its position on the wheel. For a
+ *   timer that is the first in its slot or expired, this is a single
+ *   comparison. For any other timer, including a timer that has never been
+ *   set and was not zero-initialized, the timers in the slot it would be in
+ *   and the expired timers are searched, so @ref ztimer_set(),
+ *   @ref ztimer_remove() and @ref ztimer_is_set() are O(n) in the number of
+ *   timers sharing that slot
+ *
+ * If the `ztimer_init` module is used, @ref ZTIMER_USEC, @ref ZTIMER_MSEC and
+ * @ref ZTIMER_SEC automatically get a timer wheel.
+ *
+ * @{
+ *
+ * @file
+ * @brief       ztimer timer wheel API
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ztimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of bits of the target time covered by each wheel level
+ *
+ * Each level has 2^CONFIG_ZTIMER_WHEEL_LEVEL_BITS slots. Larger values mean
+ * fewer cascades, but more memory per clock. Must be in the range [1, 4].
+ */
+#ifndef CONFIG_ZTIMER_WHEEL_LEVEL_BITS
+#define CONFIG_ZTIMER_WHEEL_LEVEL_BITS      4
+#endif
+
+#if (CONFIG_ZTIMER_WHEEL_LEVEL_BITS < 1) || (CONFIG_ZTIMER_WHEEL_LEVEL_BITS > 4)
+#error "CONFIG_ZTIMER_WHEEL_LEVEL_BITS must be in the range [1, 4]"
+#endif
+
+/**
+ * @brief   Number of slots per wheel level
+ */
+#define ZTIMER_WHEEL_SLOTS      (1U << CONFIG_ZTIMER_WHEEL_LEVEL_BITS)
+
+/**
+ * @brief   Number of wheel levels needed to cover 32 bit target times
+ */
+#define ZTIMER_WHEEL_LEVELS     ((32 + CONFIG_ZTIMER_WHEEL_LEVEL_BITS - 1) / \
+                                 CONFIG_ZTIMER_WHEEL_LEVEL_BITS)
+
+/**
+ * @brief   Timer wheel storage of a ztimer clock
+ */
+struct ztimer_wheel {
+    /** per level and slot lists of timers */
+    ztimer_base_t *slot[ZTIMER_WHEEL_LEVELS][ZTIMER_WHEEL_SLOTS];
+    /** per level bitmap of non-empty slots */
+    uint16_t occupied[ZTIMER_WHEEL_LEVELS];
+    /** timers that are due, sorted by target time */
+    ztimer_base_t *expired;
+};
+
+/**
+ * @brief   Make @p clock store its timers in @p wheel
+ *
+ * Must be called after the clock has been initialized and before any timer
+ * is set on it.
+ *
+ * @param[in]   clock   ztimer clock to operate on
+ * @param[in]   wheel   wheel storage to use for @p clock
+ */
+void ztimer_wheel_init(ztimer_clock_t *clock, ztimer_wheel_t *wheel);
+
+/**
+ * @brief   Add a timer to the wheel of @p clock
+ *
+ * @internal    To be called by ztimer core only, with interrupts disabled.
+ *
+ * On entry, `entry->offset` holds the target relative to the clock's base
+ * time (`clock->list.offset`). While the timer is on the wheel, it holds the
+ * absolute target time.
+ *
+ * @param[in]   clock   ztimer clock to operate on
+ * @param[in]   entry   timer to add
+ */
+void _ztimer_wheel_add(ztimer_clock_t *clock, ztimer_base_t *entry);
+
+/**
+ * @brief   Check whether a timer is on the wheel of @p clock
+ *
+ * @internal    To be called by ztimer core only, with interrupts disabled.
+ *
+ * @p entry may be a timer that was never set and contains garbage: its links
+ * are only followed if they point into the wheel. Otherwise the slot the
+ * timer would be in and the expired timers are searched for it.
+ *
+ * @param[in]   clock   ztimer clock to operate on
+ * @param[in]   entry   timer to look for
+ *
+ * @return  true if @p entry is set on @p clock
+ */
+bool _ztimer_wheel_has(const ztimer_clock_t *clock, const ztimer_base_t *entry);
+
+/**
+ * @brief   Remove a timer from the wheel of @p clock
+ *
+ * @internal    To be called by ztimer core only, with interrupts disabled.
+ *
+ * @param[in]   clock   ztimer clock to operate on
+ * @param[in]   entry   timer to remove, must be set on @p clock
+ */
+void _ztimer_wheel_del(ztimer_clock_t *clock, ztimer_base_t *entry);
+
+/**
+ * @brief   Move the base time of @p clock to @p now
+ *
+ * @internal    To be called by ztimer core only, with interrupts disabled.
+ *
+ * Cascades all slots that have been passed and moves timers that are due to
+ * the expired list.
+ *
+ * @param[in]   clock   ztimer clock to operate on
+ * @param[in]   now     new base time
+ */
+void _ztimer_wheel_advance(ztimer_clock_t *clock, uint32_t now);
+
+/**
+ * @brief   Take the next expired timer off the wheel of @p clock
+ *
+ * @internal    To be called by ztimer core only, with interrupts disabled.
+ *
+ * @param[in]   clock   ztimer clock to operate on
+ *
+ * @return  the earliest expired timer, or NULL if none is due
+ */
+ztimer_base_t *_ztimer_wheel_pop(ztimer_clock_t *clock);
+
+/**
+ * @brief   Get the offset of the next event on the wheel of @p clock
+ *
+ * @internal    To be called by ztimer core only, with interrupts disabled.
+ *
+ * This is the number of ticks until either the earliest timer is due, or
+ * the slot holding the earliest timer needs to be cascaded. In both cases,
+ * the clock needs to be advanced to that time.
+ *
+ * @pre     `clock->list.next != NULL`
+ *
+ * @param[in]   clock   ztimer clock to operate on
+ *
+ * @return  ticks from `clock->list.offset` until the next event
+ */
+uint32_t _ztimer_wheel_head_offset(const ztimer_clock_t *clock);
+
+/**
+ * @brief   Print the timers on the wheel of @p clock
+ *
+ * @internal    Used by ztimer core for debugging.
+ *
+ * @param[in]   clock   ztimer clock to operate on
+ */
+void _ztimer_wheel_print(const ztimer_clock_t *clock);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -153,6 +153,10 @@ static ssize_t _forward_proxy_handler(coap_pkt_t *pdu, uint8_t *buf,
     else if (pdu_len == -EINVAL) {
         return gcoap_response(pdu, buf, len, COAP_CODE_BAD_OPTION);
     }
+    /* request does not fit into the proxy's buffer, reply with 4.13 */
+    else if (pdu_len == -EMSGSIZE) {
+        return gcoap_response(pdu, buf, len, COAP_CODE_REQUEST_ENTITY_TOO_LARGE);
+    }
     /* scheme not supported */
     else if (pdu_len == -EPERM) {
         return gcoap_response(pdu, buf, len, COAP_CODE_PROXYING_NOT_SUPPORTED);
@@ -314,7 +318,7 @@ static void _forward_resp_handler(const gcoap_request_memo_t *memo,
     else if (memo->state == GCOAP_MEMO_RESP_TRUNC) {
         /* the response was truncated, so there should be enough space
          * to allocate an empty error message instead (with a potential Observe option) if not,
-         * _listen_buf is _way_ too short ;-) */
+         * CONFIG_GCOAP_PDU_BUF_SIZE is _way_ too small ;-) */
         assert(buf_len >= (sizeof(*pdu->hdr) + 4U));
         gcoap_resp_init(pdu, (uint8_t *)pdu->hdr, buf_len, COAP_CODE_INTERNAL_SERVER_ERROR);
         coap_opt_finish(pdu, COAP_OPT_FINISH_NONE);
@@ -406,6 +410,11 @@ static int _gcoap_forward_proxy_copy_options(coap_pkt_t *pkt,
                                    COAP_OPT_FINISH_PAYLOAD :
                                    COAP_OPT_FINISH_NONE));
 
+    /* the payload must fit behind the rewritten options in proxy_req_buf */
+    if ((len < 0) || (client_pkt->payload_len > pkt->payload_len)) {
+        return -EMSGSIZE;
+    }
+
     /* copy payload from client_pkt to pkt */
     memcpy(pkt->payload, client_pkt->payload, client_pkt->payload_len);
     pkt->payload_len = client_pkt->payload_len;
@@ -471,7 +480,7 @@ static int _gcoap_forward_proxy_via_coap(coap_pkt_t *client_pkt,
 
     if (len < 0) {
         _free_client_ep(client_ep);
-        return -EINVAL;
+        return (len == -EMSGSIZE) ? -EMSGSIZE : -EINVAL;
     }
     if (IS_USED(MODULE_GCOAP_FORWARD_PROXY_THREAD)) {
         /* WORKAROUND: DTLS communication is blocking the gcoap thread,
@@ -529,7 +538,7 @@ int gcoap_forward_proxy_request_process(coap_pkt_t *pkt,
         /* client context ownership is passed to gcoap_forward_proxy_req_send() */
         int res = _gcoap_forward_proxy_via_coap(pkt, cep, &urip);
         if (res < 0) {
-            return -EINVAL;
+            return (res == -EMSGSIZE) ? -EMSGSIZE : -EINVAL;
         }
     }
     /* no other scheme supported for now */
@@ -26,12 +26,15 @@
 #include <string.h>
 
 #include "assert.h"
+#include "bitarithm.h"
+#include "container.h"
 #include "net/coap.h"
 #include "net/gcoap.h"
 #include "net/gcoap/forward_proxy.h"
 #include "net/ipv6/addr.h"
 #include "net/nanocoap.h"
 #include "net/nanocoap/cache.h"
+#include "net/nanocoap/resource_trie.h"
 #include "net/sock/async/event.h"
 #include "net/sock/udp.h"
 #include "net/sock/util.h"
@@ -55,11 +58,35 @@
 /* End of the range to pick a random timeout */
 #define TIMEOUT_RANGE_END ((uint32_t)CONFIG_COAP_ACK_TIMEOUT_MS * CONFIG_COAP_RANDOM_FACTOR_1000 / 1000)
 
+/* Marks the end of a chain of request memos */
+#define MEMO_NONE       UINT16_MAX
+
+/* Number of hash buckets of the request memo index, MIDs are assigned
+ * sequentially, so this spreads consecutive requests over all buckets */
+#define MEMO_BUCKETS    CONFIG_GCOAP_REQ_WAITING_MAX
+
+static_assert(CONFIG_GCOAP_REQ_WAITING_MAX < MEMO_NONE,
+              "CONFIG_GCOAP_REQ_WAITING_MAX too large");
+
+/* Bits of all response buffers in _resp_bufs_used */
+#define RESP_BUFS_ALL   ((uint32_t)(((uint64_t)1 << CONFIG_GCOAP_RESP_BUFS_MAX) - 1))
+
+static_assert((CONFIG_GCOAP_RESP_BUFS_MAX > 0) && (CONFIG_GCOAP_RESP_BUFS_MAX <= 32),
+              "CONFIG_GCOAP_RESP_BUFS_MAX must be between 1 and 32");
+#if IS_USED(MODULE_GCOAP_WORKERS)
+/* workers never take the last buffer, so with fewer buffers a worker would
+ * idle while the gcoap thread handles requests */
+static_assert(CONFIG_GCOAP_RESP_BUFS_MAX > CONFIG_GCOAP_WORKERS_NUMOF,
+              "CONFIG_GCOAP_RESP_BUFS_MAX must be larger than "
+              "CONFIG_GCOAP_WORKERS_NUMOF");
+#endif
+
 /* Internal functions */
 static void *_event_loop(void *arg);
 static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *arg);
-static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux,
-                              uint8_t *buf, size_t len, bool truncated);
+static bool _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux,
+                              uint8_t *buf, size_t len, bool truncated,
+                              uint8_t *resp_buf, void **buf_ctx);
 static int _tl_init_coap_socket(gcoap_socket_t *sock, gcoap_socket_type_t type);
 static ssize_t _tl_send(gcoap_socket_t *sock, const void *data, size_t len,
                         const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux);
@@ -69,8 +96,15 @@ static ssize_t _well_known_core_handler(coap_pkt_t* pdu, uint8_t *buf, size_t le
                                         coap_request_ctx_t *ctx);
 static void _cease_retransmission(gcoap_request_memo_t *memo);
 static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
-                          size_t len, sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux);
+                          size_t len, sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux,
+                          void **buf_ctx, bool *offloaded);
+static ssize_t _call_handler(const coap_resource_t *resource, coap_pkt_t *pdu,
+                             uint8_t *buf, size_t len, coap_request_ctx_t *ctx);
 static void _expire_request(gcoap_request_memo_t *memo);
+static gcoap_request_memo_t *_req_memo_alloc(void);
+static void _req_memo_free(gcoap_request_memo_t *memo);
+static void _req_memo_insert(gcoap_request_memo_t *memo);
+static void _req_memo_remove(gcoap_request_memo_t *memo);
 static gcoap_request_memo_t* _find_req_memo_by_mid(const sock_udp_ep_t *remote,
                                                    uint16_t mid);
 static gcoap_request_memo_t* _find_req_memo_by_token(const sock_udp_ep_t *remote,
@@ -102,6 +136,11 @@ static void _receive_from_cache_cb(void *arg);
 static int _request_matcher_default(gcoap_listener_t *listener,
                                     const coap_resource_t **resource,
                                     coap_pkt_t *pdu);
+#if IS_USED(MODULE_NANOCOAP_RESOURCE_TRIE)
+static int _request_matcher_trie(gcoap_listener_t *listener,
+                                 const coap_resource_t **resource,
+                                 coap_pkt_t *pdu);
+#endif
 
 #if IS_USED(MODULE_GCOAP_DTLS)
 static void _on_sock_dtls_evt(sock_dtls_t *sock, sock_async_flags_t type, void *arg);
@@ -110,6 +149,14 @@ static void _dtls_free_up_session(void *arg);
 
 static char _ipv6_addr_str[IPV6_ADDR_MAX_STR_LEN];
 
+#if IS_USED(MODULE_NANOCOAP_RESOURCE_TRIE)
+/* Resource tries of the listeners using _request_matcher_trie() */
+static struct {
+    const gcoap_listener_t *listener;
+    coap_resource_trie_t trie;
+} _listener_tries[CONFIG_GCOAP_RESOURCE_TRIE_NUMOF];
+#endif
+
 /* Internal variables */
 const coap_resource_t _default_resources[] = {
     { "/.well-known/core", COAP_GET, _well_known_core_handler, NULL },
@@ -132,6 +179,18 @@ typedef struct {
                                         /* Storage for open requests; if first
                                            byte of an entry is zero, the entry
                                            is available */
+    uint16_t free_reqs;                 /* First unused request memo */
+    uint16_t reqs_by_token[MEMO_BUCKETS];
+                                        /* First request memo of each bucket,
+                                           hashed by token */
+    uint16_t reqs_by_mid[MEMO_BUCKETS]; /* First request memo of each bucket,
+                                           hashed by message ID */
+    uint16_t next_by_token[CONFIG_GCOAP_REQ_WAITING_MAX];
+                                        /* Next request memo in the same token
+                                           bucket, or next unused memo */
+    uint16_t next_by_mid[CONFIG_GCOAP_REQ_WAITING_MAX];
+                                        /* Next request memo in the same
+                                           message ID bucket */
     atomic_uint next_message_id;        /* Next message ID to use */
     sock_udp_ep_t observers[CONFIG_GCOAP_OBS_CLIENTS_MAX];
                                         /* Observe clients; allows reuse for
@@ -155,7 +214,10 @@ static gcoap_state_t _coap_state = {
 static kernel_pid_t _pid = KERNEL_PID_UNDEF;
 static char _msg_stack[GCOAP_STACK_SIZE];
 static event_queue_t _queue;
-static uint8_t _listen_buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+/* Buffers for responses; a set bit in _resp_bufs_used marks a buffer in use */
+static uint8_t _resp_bufs[CONFIG_GCOAP_RESP_BUFS_MAX][CONFIG_GCOAP_PDU_BUF_SIZE];
+static uint32_t _resp_bufs_used;
+static mutex_t _resp_bufs_lock = MUTEX_INIT;
 static sock_udp_t _sock_udp;
 static event_callback_t _receive_from_cache;
 
@@ -170,6 +232,195 @@ static event_timeout_t _dtls_session_free_up_tmout;
 static event_callback_t _dtls_session_free_up_tmout_cb;
 #endif
 
+/* Takes a buffer from the pool of response buffers. Only the gcoap thread
+ * takes buffers and it holds at most one at a time, while requests passed to
+ * workers never hold the last one (see _jobs_full()), so there is always one
+ * free. The gcoap thread must not wait for a worker here, as an offloaded
+ * handler may in turn wait for the gcoap thread, e.g. for the response to a
+ * request it sent. */
+static uint8_t *_resp_buf_get(void)
+{
+    unsigned i;
+
+    mutex_lock(&_resp_bufs_lock);
+    assert(_resp_bufs_used != RESP_BUFS_ALL);
+    for (i = 0; _resp_bufs_used & (1UL << i); i++) {}
+    _resp_bufs_used |= 1UL << i;
+    mutex_unlock(&_resp_bufs_lock);
+    return _resp_bufs[i];
+}
+
+static unsigned _resp_buf_idx(const uint8_t *buf)
+{
+    unsigned i = (buf - _resp_bufs[0]) / CONFIG_GCOAP_PDU_BUF_SIZE;
+
+    assert((i < CONFIG_GCOAP_RESP_BUFS_MAX) && (buf == _resp_bufs[i]));
+    return i;
+}
+
+/* Returns a buffer taken with _resp_buf_get() to the pool. */
+static void _resp_buf_put(uint8_t *buf)
+{
+    unsigned i = _resp_buf_idx(buf);
+
+    mutex_lock(&_resp_bufs_lock);
+    _resp_bufs_used &= ~(1UL << i);
+    mutex_unlock(&_resp_bufs_lock);
+}
+
+#if IS_USED(MODULE_GCOAP_WORKERS)
+/* A request passed to a worker, it uses the response buffer with the same
+ * index */
+typedef struct {
+    event_t super;                  /* event posted to the worker */
+    coap_pkt_t pdu;                 /* the parsed request */
+    const coap_resource_t *resource;/* resource to handle the request */
+    gcoap_socket_t socket;          /* socket the request was received on */
+    sock_udp_ep_t remote;           /* sender of the request */
+    sock_udp_aux_tx_t aux;          /* local address of the request */
+    bool has_aux;                   /* false to send without aux */
+    void *buf_ctx;                  /* packet of a request parsed in place */
+    uint16_t mid;                   /* message ID of the request */
+    uint8_t worker;                 /* index of the worker */
+} _job_t;
+
+typedef struct {
+    event_queue_t queue;            /* queue of jobs of the worker */
+    atomic_uint pending;            /* number of jobs of the worker */
+} _worker_t;
+
+static _job_t _jobs[CONFIG_GCOAP_RESP_BUFS_MAX];
+/* a set bit marks a job a worker has not finished yet, i.e. a response buffer
+ * held by a worker, protected by _resp_bufs_lock */
+static uint32_t _jobs_active;
+static _worker_t _workers[CONFIG_GCOAP_WORKERS_NUMOF];
+static char _worker_stacks[CONFIG_GCOAP_WORKERS_NUMOF][GCOAP_WORKER_STACK_SIZE];
+
+/* Runs the handler of a job in a worker thread and sends the response */
+static void _on_job(event_t *event)
+{
+    _job_t *job = container_of(event, _job_t, super);
+    uint8_t *buf = _resp_bufs[job - _jobs];
+    sock_udp_aux_tx_t *aux = job->has_aux ? &job->aux : NULL;
+    coap_request_ctx_t ctx = {
+        .resource = job->resource,
+        .tl_type = (uint32_t)job->socket.type,
+        .remote = &job->remote,
+        .local = aux ? &aux->local : NULL,
+    };
+
+    ssize_t pdu_len = _call_handler(job->resource, &job->pdu, buf,
+                                    CONFIG_GCOAP_PDU_BUF_SIZE, &ctx);
+    if (pdu_len > 0) {
+        ssize_t bytes = _tl_send(&job->socket, buf, pdu_len, &job->remote, aux);
+        if (bytes <= 0) {
+            DEBUG("gcoap: send response failed: %" PRIdSIZE "\n", bytes);
+        }
+    }
+    if (job->buf_ctx != NULL) {
+        void *data;
+        /* release the request parsed in place */
+        sock_udp_recv_buf_aux(job->socket.socket.udp, &data, &job->buf_ctx,
+                              0, NULL, NULL);
+    }
+    atomic_fetch_sub(&_workers[job->worker].pending, 1);
+    /* release job and buffer at once, so _jobs_full() never counts a buffer
+     * as free that is still in use */
+    mutex_lock(&_resp_bufs_lock);
+    _jobs_active &= ~(1UL << (job - _jobs));
+    _resp_bufs_used &= ~(1UL << (job - _jobs));
+    mutex_unlock(&_resp_bufs_lock);
+}
+
+/* Checks if passing another request to a worker would take the last free
+ * response buffer, which is reserved for the gcoap thread */
+static bool _jobs_full(void)
+{
+    mutex_lock(&_resp_bufs_lock);
+    bool full = (bitarithm_bits_set_u32(_jobs_active) + 1 >=
+                 CONFIG_GCOAP_RESP_BUFS_MAX);
+    mutex_unlock(&_resp_bufs_lock);
+    return full;
+}
+
+/* Checks if a worker still handles a request with the message ID of pdu from
+ * remote, i.e. if pdu is a retransmission of it */
+static bool _job_active(const coap_pkt_t *pdu, const sock_udp_ep_t *remote)
+{
+    bool active = false;
+
+    /* only the gcoap thread writes the jobs */
+    mutex_lock(&_resp_bufs_lock);
+    for (unsigned i = 0; !active && (i < CONFIG_GCOAP_RESP_BUFS_MAX); i++) {
+        active = (_jobs_active & (1UL << i)) &&
+                 (_jobs[i].mid == coap_get_id(pdu)) &&
+                 sock_udp_ep_equal(&_jobs[i].remote, remote);
+    }
+    mutex_unlock(&_resp_bufs_lock);
+    return active;
+}
+
+/* Passes a request to the worker with the fewest jobs. The job takes over
+ * the response buffer and the packet of the request. */
+static void _offload(const coap_resource_t *resource, gcoap_socket_t *sock,
+                     coap_pkt_t *pdu, uint8_t *buf, sock_udp_ep_t *remote,
+                     sock_udp_aux_tx_t *aux, void **buf_ctx)
+{
+    _job_t *job = &_jobs[_resp_buf_idx(buf)];
+    unsigned worker = 0;
+
+    for (unsigned i = 1; i < CONFIG_GCOAP_WORKERS_NUMOF; i++) {
+        if (atomic_load(&_workers[i].pending) <
+            atomic_load(&_workers[worker].pending)) {
+            worker = i;
+        }
+    }
+
+    *job = (_job_t){
+        .super.handler = _on_job,
+        .pdu = *pdu,
+        .resource = resource,
+        .socket = *sock,
+        .remote = *remote,
+        .has_aux = (aux != NULL),
+        .buf_ctx = *buf_ctx,
+        .mid = coap_get_id(pdu),
+        .worker = worker,
+    };
+    if (aux) {
+        job->aux = *aux;
+    }
+    *buf_ctx = NULL;
+
+    mutex_lock(&_resp_bufs_lock);
+    _jobs_active |= 1UL << (job - _jobs);
+    mutex_unlock(&_resp_bufs_lock);
+
+    atomic_fetch_add(&_workers[worker].pending, 1);
+    event_post(&_workers[worker].queue, &job->super);
+}
+
+static void *_worker_loop(void *arg)
+{
+    event_queue_t *queue = arg;
+
+    event_queue_claim(queue);
+    event_loop(queue);
+    return NULL;
+}
+
+static void _workers_init(void)
+{
+    for (unsigned i = 0; i < CONFIG_GCOAP_WORKERS_NUMOF; i++) {
+        event_queue_init_detached(&_workers[i].queue);
+        atomic_init(&_workers[i].pending, 0);
+        thread_create(_worker_stacks[i], sizeof(_worker_stacks[i]),
+                      GCOAP_WORKER_PRIO, 0, _worker_loop, &_workers[i].queue,
+                      "gcoap worker");
+    }
+}
+#endif /* MODULE_GCOAP_WORKERS */
+
 /* Event loop for gcoap _pid thread. */
 static void *_event_loop(void *arg)
 {
@@ -229,9 +480,11 @@ static void _on_sock_dtls_evt(sock_dtls_t *sock, sock_async_flags_t type, void *
     gcoap_socket_t socket = { .type = GCOAP_SOCKET_TYPE_DTLS, .socket.dtls = sock};
 
     if (type & SOCK_ASYNC_CONN_RECV) {
+        uint8_t *buf = _resp_buf_get();
         ssize_t res = sock_dtls_recv(sock, &socket.ctx_dtls_session,
-                            _listen_buf, sizeof(_listen_buf),
+                            buf, CONFIG_GCOAP_PDU_BUF_SIZE,
                             CONFIG_GCOAP_DTLS_HANDSHAKE_TIMEOUT_MSEC);
+        _resp_buf_put(buf);
         if (res != -SOCK_DTLS_HANDSHAKE) {
             DEBUG("gcoap: could not establish DTLS session: %" PRIdSIZE "\n", res);
             sock_dtls_session_destroy(sock, &socket.ctx_dtls_session);
@@ -293,16 +546,19 @@ static void _on_sock_dtls_evt(sock_dtls_t *sock, sock_async_flags_t type, void *
     }
 
     if (type & SOCK_ASYNC_MSG_RECV) {
-        ssize_t res = sock_dtls_recv(sock, &socket.ctx_dtls_session, _listen_buf,
-                                    sizeof(_listen_buf), 0);
+        uint8_t *buf = _resp_buf_get();
+        ssize_t res = sock_dtls_recv(sock, &socket.ctx_dtls_session, buf,
+                                    CONFIG_GCOAP_PDU_BUF_SIZE, 0);
         if (res <= 0) {
             DEBUG("gcoap: DTLS recv failure: %" PRIdSIZE "\n", res);
+            _resp_buf_put(buf);
             return;
         }
         sock_udp_ep_t ep;
         sock_dtls_session_get_udp_ep(&socket.ctx_dtls_session, &ep);
         /* Truncated DTLS messages would already have gotten lost at verification */
-        _process_coap_pdu(&socket, &ep, NULL, _listen_buf, res, false);
+        _process_coap_pdu(&socket, &ep, NULL, buf, res, false, buf, NULL);
+        _resp_buf_put(buf);
     }
 }
 
@@ -331,37 +587,57 @@ static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *ar
     if (type & SOCK_ASYNC_MSG_RECV) {
         void *stackbuf;
         void *buf_ctx = NULL;
+        uint8_t *buf;
+        uint8_t *resp_buf;
         bool truncated = false;
         size_t cursor = 0;
         sock_udp_aux_rx_t aux_in = {
             .flags = SOCK_AUX_GET_LOCAL,
         };
 
-        /* The zero-copy _buf API is not used to its full potential here -- we
-         * still copy out data in what is a manual version of sock_udp_recv,
-         * but this gives the direly needed overflow information.
-         *
-         * A version that actually doesn't copy would vastly change the way
-         * gcoap passes the buffer to be read from and written into to the
-         * handler. Also, given that neither nanocoap nor the handler expects
-         * to gather scattered data, it'd need to rely on the data coming in a
-         * single slice (but that may be a realistic assumption).
-         */
-        while (true) {
-            ssize_t res = sock_udp_recv_buf_aux(sock, &stackbuf, &buf_ctx, 0, &remote, &aux_in);
+        ssize_t res = sock_udp_recv_buf_aux(sock, &stackbuf, &buf_ctx, 0, &remote, &aux_in);
+        if (res <= 0) {
+            DEBUG("gcoap: udp recv failure: %" PRIdSIZE "\n", res);
+            return;
+        }
+
+        resp_buf = _resp_buf_get();
+        /* GNRC always returns the whole datagram in a single slice, so a
+         * request is parsed in place in the packet buffer, which is kept until
+         * the response is sent. Responses are copied, as response handlers
+         * may rewrite the PDU they are given (e.g. the forward proxy).
+         * Handlers (and the forward proxy, which copies the request) expect a
+         * request to fit into CONFIG_GCOAP_PDU_BUF_SIZE, so larger ones are
+         * still treated as truncated and answered with 4.13. */
+        if (IS_USED(MODULE_GNRC_SOCK_UDP) &&
+            ((size_t)res >= sizeof(coap_hdr_t)) &&
+            ((((coap_hdr_t *)stackbuf)->code >> 5) == COAP_CLASS_REQ)) {
+            buf = stackbuf;
+            cursor = res;
+            if (cursor > CONFIG_GCOAP_PDU_BUF_SIZE) {
+                cursor = CONFIG_GCOAP_PDU_BUF_SIZE;
+                truncated = true;
+            }
+        }
+        else {
+            /* Other stacks may return the datagram in several slices, which
+             * neither nanocoap nor the handlers expect, so gather them in the
+             * response buffer, which also holds the response then. */
+            buf = resp_buf;
+            while (res > 0) {
+                if (cursor + res > CONFIG_GCOAP_PDU_BUF_SIZE) {
+                    res = CONFIG_GCOAP_PDU_BUF_SIZE - cursor;
+                    truncated = true;
+                }
+                memcpy(&buf[cursor], stackbuf, res);
+                cursor += res;
+                res = sock_udp_recv_buf_aux(sock, &stackbuf, &buf_ctx, 0, &remote, &aux_in);
+            }
             if (res < 0) {
                 DEBUG("gcoap: udp recv failure: %" PRIdSIZE "\n", res);
+                _resp_buf_put(resp_buf);
                 return;
             }
-            if (res == 0) {
-                break;
-            }
-            if (cursor + res > sizeof(_listen_buf)) {
-                res = sizeof(_listen_buf) - cursor;
-                truncated = true;
-            }
-            memcpy(&_listen_buf[cursor], stackbuf, res);
-            cursor += res;
         }
 
         /* make sure we reply with the same address that the request was
@@ -384,7 +660,15 @@ static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *ar
             .socket.udp = sock,
          };
 
-        _process_coap_pdu(&socket, &remote, aux_out_ptr, _listen_buf, cursor, truncated);
+        if (!_process_coap_pdu(&socket, &remote, aux_out_ptr, buf, cursor,
+                               truncated, resp_buf, &buf_ctx)) {
+            _resp_buf_put(resp_buf);
+        }
+
+        if (buf_ctx != NULL) {
+            /* release the datagram processed in place */
+            sock_udp_recv_buf_aux(sock, &stackbuf, &buf_ctx, 0, NULL, NULL);
+        }
     }
 }
 
@@ -404,11 +688,22 @@ static void _memo_clear_resend_buffer(gcoap_request_memo_t *memo)
     }
 }
 
-/* Processes and evaluates the coap pdu */
-static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux,
-                              uint8_t *buf, size_t len, bool truncated)
+/* Processes and evaluates the coap pdu
+ *
+ * The response to a request is built in resp_buf, which is either buf or a
+ * separate buffer of CONFIG_GCOAP_PDU_BUF_SIZE bytes. In the latter case, buf
+ * may be in the buffer of the network stack and is only read. A response must
+ * be in resp_buf (i.e. buf == resp_buf).
+ *
+ * buf_ctx points to the packet of the network stack buf is in, if any. Returns
+ * true if the request was passed to a worker, which then releases resp_buf and
+ * the packet, and sets *buf_ctx to NULL. */
+static bool _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux,
+                              uint8_t *buf, size_t len, bool truncated,
+                              uint8_t *resp_buf, void **buf_ctx)
 {
     coap_pkt_t pdu;
+    bool offloaded = false;
     gcoap_request_memo_t *memo = NULL;
     /* Code paths that necessitate a response on the message layer can set a
      * response type here (COAP_TYPE_RST or COAP_TYPE_ACK). If set, at the end
@@ -417,6 +712,9 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
      *   * token length cleared,
      *   * code set to EMPTY, and
      *   * the message is returned with the rest of its header intact.
+     *
+     * The empty message is built in a copy of the header, as buf may only be
+     * read.
      */
     int8_t messagelayer_emptyresponse_type = NO_IMMEDIATE_REPLY;
 
@@ -431,12 +729,14 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
          * with Bad Request), but these would likely require incompatible
          * changes to nanocoap.
          */
-        return;
+        return false;
     }
 
     if (coap_get_type(&pdu) == COAP_TYPE_RST) {
         DEBUG("gcoap: received RST, expiring potentially existing memo\n");
+        mutex_lock(&_coap_state.lock);
         memo = _find_req_memo_by_mid(remote, pdu.hdr->id);
+        mutex_unlock(&_coap_state.lock);
         if (memo) {
             event_timeout_clear(&memo->resp_evt_tmout);
             _expire_request(memo);
@@ -458,7 +758,9 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
                 messagelayer_emptyresponse_type = COAP_TYPE_RST;
                 DEBUG("gcoap: Answering empty CON request with RST\n");
             } else if (coap_get_type(&pdu) == COAP_TYPE_ACK) {
+                mutex_lock(&_coap_state.lock);
                 memo = _find_req_memo_by_mid(remote, pdu.hdr->id);
+                mutex_unlock(&_coap_state.lock);
                 if ((memo != NULL) && (memo->send_limit != GCOAP_SEND_LIMIT_NON)) {
                     DEBUG("gcoap: empty ACK processed, stopping retransmissions\n");
                     _cease_retransmission(memo);
@@ -476,15 +778,16 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
 
             if (truncated) {
                 /* TBD: Set a Size1 */
-                pdu_len = gcoap_response(&pdu, _listen_buf, sizeof(_listen_buf),
+                pdu_len = gcoap_response(&pdu, resp_buf, CONFIG_GCOAP_PDU_BUF_SIZE,
                                          COAP_CODE_REQUEST_ENTITY_TOO_LARGE);
             } else {
-                pdu_len = _handle_req(sock, &pdu, _listen_buf,
-                                      sizeof(_listen_buf), remote, aux);
+                pdu_len = _handle_req(sock, &pdu, resp_buf,
+                                      CONFIG_GCOAP_PDU_BUF_SIZE, remote, aux,
+                                      buf_ctx, &offloaded);
             }
 
             if (pdu_len > 0) {
-                ssize_t bytes = _tl_send(sock, _listen_buf, pdu_len, remote, aux);
+                ssize_t bytes = _tl_send(sock, resp_buf, pdu_len, remote, aux);
                 if (bytes <= 0) {
                     DEBUG("gcoap: send response failed: %" PRIdSIZE "\n", bytes);
                 }
@@ -499,7 +802,9 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
     case COAP_CLASS_SUCCESS:
     case COAP_CLASS_CLIENT_FAILURE:
     case COAP_CLASS_SERVER_FAILURE:
+        mutex_lock(&_coap_state.lock);
         memo = _find_req_memo_by_pdu_token(&pdu, remote);
+        mutex_unlock(&_coap_state.lock);
         if (memo) {
             switch (coap_get_type(&pdu)) {
             case COAP_TYPE_CON:
@@ -524,9 +829,9 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
                         ce->max_age = ztimer_now(ZTIMER_SEC) + max_age;
                         /* copy all options and possible payload from the cached response
                          * to the new response */
-                        assert((uint8_t *)pdu.hdr == &_listen_buf[0]);
-                        if (_cache_build_response(ce, &pdu, _listen_buf,
-                                                  sizeof(_listen_buf)) < 0) {
+                        assert((uint8_t *)pdu.hdr == resp_buf);
+                        if (_cache_build_response(ce, &pdu, resp_buf,
+                                                  CONFIG_GCOAP_PDU_BUF_SIZE) < 0) {
                             memo->state = GCOAP_MEMO_ERR;
                         }
                         if (ce->truncated) {
@@ -551,8 +856,9 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
                  * Non-2.xx notifications indicate that the associated observe entry
                  * was removed on the server side. Then also free the memo here. */
                 if (!observe_notification || (code_class != COAP_CLASS_SUCCESS)) {
-                    /* setting the state to unused frees (drops) the memo entry */
-                    memo->state = GCOAP_MEMO_UNUSED;
+                    mutex_lock(&_coap_state.lock);
+                    _req_memo_remove(memo);
+                    mutex_unlock(&_coap_state.lock);
                 }
 
                 break;
@@ -584,6 +890,9 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
     }
 
     if (messagelayer_emptyresponse_type != NO_IMMEDIATE_REPLY) {
+        coap_hdr_t hdr = *pdu.hdr;
+
+        pdu.hdr = &hdr;
         coap_hdr_set_type(pdu.hdr, (uint8_t)messagelayer_emptyresponse_type);
         coap_pkt_set_code(&pdu, COAP_CODE_EMPTY);
         /* Set the token length to 0, preserving the CoAP version as it was and
@@ -593,11 +902,27 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
          * */
         pdu.hdr->ver_t_tkl &= 0xf0;
 
-        ssize_t bytes = _tl_send(sock, buf, sizeof(coap_hdr_t), remote, aux);
+        ssize_t bytes = _tl_send(sock, &hdr, sizeof(hdr), remote, aux);
         if (bytes <= 0) {
             DEBUG("gcoap: empty response failed: %" PRIdSIZE "\n", bytes);
         }
     }
+
+    return offloaded;
+}
+
+/* Sets the response timeout of a request to expire between timeout and end.
+ * With ztimer_slack, the remainder of the range is slack, so the timer can
+ * share an interrupt with other timers. */
+static void _resp_timeout_set(gcoap_request_memo_t *memo, uint32_t timeout,
+                              uint32_t end)
+{
+#if IS_USED(MODULE_ZTIMER_SLACK)
+    event_timeout_set_slack(&memo->resp_evt_tmout, timeout, end - timeout);
+#else
+    (void)end;
+    event_timeout_set(&memo->resp_evt_tmout, timeout);
+#endif
 }
 
 /* Handles response timeout for a request; resend confirmable if needed. */
@@ -617,11 +942,12 @@ static void _on_resp_timeout(void *arg) {
         unsigned i        = CONFIG_COAP_MAX_RETRANSMIT - memo->send_limit;
 #endif
         uint32_t timeout  = (uint32_t)CONFIG_COAP_ACK_TIMEOUT_MS << i;
+        uint32_t end      = timeout;
 #if CONFIG_COAP_RANDOM_FACTOR_1000 > 1000
-        uint32_t end = (uint32_t)TIMEOUT_RANGE_END << i;
+        end = (uint32_t)TIMEOUT_RANGE_END << i;
         timeout = random_uint32_range(timeout, end);
 #endif
-        event_timeout_set(&memo->resp_evt_tmout, timeout);
+        _resp_timeout_set(memo, timeout, end);
 
         if (memo->state == GCOAP_MEMO_WAIT) {
             /* See _cease_retransmission: Still going through the timeouts and
@@ -677,7 +1003,8 @@ static void _cease_retransmission(gcoap_request_memo_t *memo) {
  * return length of response pdu, or < 0 if can't handle
  */
 static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
-                          size_t len, sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+                          size_t len, sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux,
+                          void **buf_ctx, bool *offloaded)
 {
     const coap_resource_t *resource     = NULL;
     gcoap_listener_t *listener          = NULL;
@@ -796,7 +1123,30 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
         return -1;
     }
 
-    ssize_t pdu_len;
+#if IS_USED(MODULE_GCOAP_WORKERS)
+    /* the DTLS sock must only be used by the gcoap thread */
+    if ((resource->methods & COAP_OFFLOAD) &&
+        (sock->type == GCOAP_SOCKET_TYPE_UDP)) {
+        if (_job_active(pdu, remote)) {
+            /* don't run the handler twice, the response to the original
+             * request also answers the retransmission */
+            DEBUG("gcoap: ignoring duplicate of offloaded request\n");
+            return 0;
+        }
+        if (_jobs_full()) {
+            /* don't wait for a worker, its handler may wait for us */
+            DEBUG("gcoap: all workers busy, rejecting request\n");
+            return gcoap_response(pdu, buf, len,
+                                  COAP_CODE_SERVICE_UNAVAILABLE);
+        }
+        _offload(resource, sock, pdu, buf, remote, aux, buf_ctx);
+        *offloaded = true;
+        return 0;
+    }
+#else
+    (void)buf_ctx;
+    (void)offloaded;
+#endif
 
     coap_request_ctx_t ctx = {
         .resource = resource,
@@ -805,7 +1155,19 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
         .local = aux ? &aux->local : NULL,
     };
 
-    pdu_len = resource->handler(pdu, buf, len, &ctx);
+    return _call_handler(resource, pdu, buf, len, &ctx);
+}
+
+/*
+ * Runs the handler of a resource, answers with 5.00 if the handler fails.
+ *
+ * return length of response pdu
+ */
+static ssize_t _call_handler(const coap_resource_t *resource, coap_pkt_t *pdu,
+                             uint8_t *buf, size_t len, coap_request_ctx_t *ctx)
+{
+    ssize_t pdu_len = resource->handler(pdu, buf, len, ctx);
+
     if (pdu_len < 0) {
         pdu_len = gcoap_response(pdu, buf, len,
                                  COAP_CODE_INTERNAL_SERVER_ERROR);
@@ -870,6 +1232,43 @@ static int _request_matcher_default(gcoap_listener_t *listener,
     return ret;
 }
 
+#if IS_USED(MODULE_NANOCOAP_RESOURCE_TRIE)
+/* Like _request_matcher_default(), but looks the path up in the resource trie
+ * of the listener */
+static int _request_matcher_trie(gcoap_listener_t *listener,
+                                 const coap_resource_t **resource,
+                                 coap_pkt_t *pdu)
+{
+    const coap_resource_trie_t *trie = NULL;
+    uint8_t uri[CONFIG_NANOCOAP_URI_MAX];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_listener_tries); i++) {
+        if (_listener_tries[i].listener == listener) {
+            trie = &_listener_tries[i].trie;
+            break;
+        }
+    }
+    assert(trie);
+
+    if (coap_get_uri_path(pdu, uri) <= 0) {
+        return GCOAP_RESOURCE_NO_PATH;
+    }
+
+    coap_method_flags_t method_flag = coap_method2flag(
+        coap_get_code_detail(pdu));
+
+    switch (coap_resource_trie_find(trie, (char *)uri, method_flag,
+                                    resource)) {
+    case 0:
+        return GCOAP_RESOURCE_FOUND;
+    case -ENOTSUP:
+        return GCOAP_RESOURCE_WRONG_METHOD;
+    default:
+        return GCOAP_RESOURCE_NO_PATH;
+    }
+}
+#endif
+
 /*
  * Searches listener registrations for the resource matching the path in a PDU.
  *
@@ -932,9 +1331,125 @@ static int _find_resource(gcoap_socket_type_t tl_type,
     return ret;
 }
 
+/*
+ * Index of the request memos in the _coap_state.open_reqs array
+ *
+ * Every memo awaiting a response is chained into a bucket by the hash of its
+ * token and into a bucket by its message ID, so a response or an empty
+ * message is matched without going through all open requests. The remote
+ * endpoint is not hashed, because the responses to a multicast request come
+ * from other endpoints than the request was sent to. Unused memos are chained
+ * into a free list via next_by_token.
+ *
+ * All of these functions require _coap_state.lock to be held.
+ */
+static unsigned _token_bucket(const uint8_t *token, size_t tkl)
+{
+    uint32_t hash = 0;
+
+    /* tokens are random, so a simple hash spreads them well */
+    for (size_t i = 0; i < tkl; i++) {
+        hash = (hash * 31) + token[i];
+    }
+    return hash % MEMO_BUCKETS;
+}
+
+static unsigned _mid_bucket(uint16_t mid)
+{
+    /* mid is in network byte order, as in the header */
+    return ntohs(mid) % MEMO_BUCKETS;
+}
+
+static void _req_memos_init(void)
+{
+    for (unsigned i = 0; i < MEMO_BUCKETS; i++) {
+        _coap_state.reqs_by_token[i] = MEMO_NONE;
+        _coap_state.reqs_by_mid[i] = MEMO_NONE;
+    }
+    for (unsigned i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
+        _coap_state.next_by_token[i] = i + 1;
+    }
+    _coap_state.next_by_token[CONFIG_GCOAP_REQ_WAITING_MAX - 1] = MEMO_NONE;
+    _coap_state.free_reqs = 0;
+}
+
+/* Takes an unused memo, or returns NULL if all are in use */
+static gcoap_request_memo_t *_req_memo_alloc(void)
+{
+    uint16_t idx = _coap_state.free_reqs;
+
+    if (idx == MEMO_NONE) {
+        return NULL;
+    }
+    _coap_state.free_reqs = _coap_state.next_by_token[idx];
+    _coap_state.open_reqs[idx].state = GCOAP_MEMO_WAIT;
+    return &_coap_state.open_reqs[idx];
+}
+
+/* Returns a memo that is not indexed to the unused memos */
+static void _req_memo_free(gcoap_request_memo_t *memo)
+{
+    uint16_t idx = memo - _coap_state.open_reqs;
+
+    memo->state = GCOAP_MEMO_UNUSED;
+    _coap_state.next_by_token[idx] = _coap_state.free_reqs;
+    _coap_state.free_reqs = idx;
+}
+
+/* Indexes a memo by the token and message ID of its request header */
+static void _req_memo_insert(gcoap_request_memo_t *memo)
+{
+    const coap_hdr_t *hdr = gcoap_request_memo_get_hdr(memo);
+    uint16_t idx = memo - _coap_state.open_reqs;
+    uint16_t *head;
+
+    head = &_coap_state.reqs_by_token[_token_bucket(coap_hdr_get_token(hdr),
+                                                    coap_hdr_get_token_len(hdr))];
+    _coap_state.next_by_token[idx] = *head;
+    *head = idx;
+
+    head = &_coap_state.reqs_by_mid[_mid_bucket(hdr->id)];
+    _coap_state.next_by_mid[idx] = *head;
+    *head = idx;
+}
+
+static void _req_memo_unlink(uint16_t *head, uint16_t *next, uint16_t idx)
+{
+    while (*head != idx) {
+        if (*head == MEMO_NONE) {
+            return;
+        }
+        head = &next[*head];
+    }
+    *head = next[idx];
+}
+
+/* Removes an indexed memo from the index and frees it
+ *
+ * The response path and _expire_request() (or the DTLS session cleanup) may
+ * both try to remove a memo, each having found it under a separate hold of
+ * _coap_state.lock, so removing a memo that is already unused does nothing. */
+static void _req_memo_remove(gcoap_request_memo_t *memo)
+{
+    const coap_hdr_t *hdr = gcoap_request_memo_get_hdr(memo);
+    uint16_t idx = memo - _coap_state.open_reqs;
+
+    if (memo->state == GCOAP_MEMO_UNUSED) {
+        return;
+    }
+    _req_memo_unlink(&_coap_state.reqs_by_token[
+                         _token_bucket(coap_hdr_get_token(hdr),
+                                       coap_hdr_get_token_len(hdr))],
+                     _coap_state.next_by_token, idx);
+    _req_memo_unlink(&_coap_state.reqs_by_mid[_mid_bucket(hdr->id)],
+                     _coap_state.next_by_mid, idx);
+    _req_memo_free(memo);
+}
+
 /*
  * Finds the memo for an outstanding request within the _coap_state.open_reqs
  * array. Matches on remote endpoint and token.
+ * Requires _coap_state.lock to be held.
  *
  * remote[in]     Remote endpoint to match
  * token[in]      Token to match
@@ -945,12 +1460,9 @@ static int _find_resource(gcoap_socket_type_t tl_type,
 static gcoap_request_memo_t* _find_req_memo_by_token(const sock_udp_ep_t *remote,
                                                      const uint8_t *token, size_t tkl)
 {
-    for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
-        if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED) {
-            continue;
-        }
-
-        gcoap_request_memo_t *memo = &_coap_state.open_reqs[i];
+    for (uint16_t idx = _coap_state.reqs_by_token[_token_bucket(token, tkl)];
+         idx != MEMO_NONE; idx = _coap_state.next_by_token[idx]) {
+        gcoap_request_memo_t *memo = &_coap_state.open_reqs[idx];
         coap_hdr_t *hdr = gcoap_request_memo_get_hdr(memo);
 
         /* verbose debug to catch bugs with request/response matching */
@@ -1024,6 +1536,7 @@ static gcoap_request_memo_t* _find_req_memo_by_pdu_token(
 /*
  * Finds the memo for an outstanding request within the _coap_state.open_reqs
  * array. Matches on remote endpoint and message ID.
+ * Requires _coap_state.lock to be held.
  *
  * remote[in]     Remote endpoint to match
  * mid[in]        Message ID to match
@@ -1032,12 +1545,9 @@ static gcoap_request_memo_t* _find_req_memo_by_pdu_token(
  */
 static gcoap_request_memo_t* _find_req_memo_by_mid(const sock_udp_ep_t *remote, uint16_t mid)
 {
-    for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
-        if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED) {
-            continue;
-        }
-
-        gcoap_request_memo_t *memo = &_coap_state.open_reqs[i];
+    for (uint16_t idx = _coap_state.reqs_by_mid[_mid_bucket(mid)];
+         idx != MEMO_NONE; idx = _coap_state.next_by_mid[idx]) {
+        gcoap_request_memo_t *memo = &_coap_state.open_reqs[idx];
 
         if ((mid == gcoap_request_memo_get_hdr(memo)->id) &&
             sock_udp_ep_equal(&memo->remote_ep, remote)) {
@@ -1063,7 +1573,9 @@ static void _expire_request(gcoap_request_memo_t *memo)
             memo->resp_handler(memo, &req, NULL);
         }
         _memo_clear_resend_buffer(memo);
-        memo->state = GCOAP_MEMO_UNUSED;
+        mutex_lock(&_coap_state.lock);
+        _req_memo_remove(memo);
+        mutex_unlock(&_coap_state.lock);
     }
     else {
         /* Response already handled; timeout must have fired while response */
@@ -1469,14 +1981,18 @@ static void _receive_from_cache_cb(void *ctx)
         if (memo->resp_handler) {
             /* copy header from request so gcoap_resp_init in _cache_build_response works correctly
              */
-            coap_pkt_t pdu = { .hdr = (coap_hdr_t *)_listen_buf };
+            uint8_t *buf = _resp_buf_get();
+            coap_pkt_t pdu = { .hdr = (coap_hdr_t *)buf };
             _copy_hdr_from_req_memo(&pdu, memo);
-            if (_cache_build_response(ce, &pdu, _listen_buf, sizeof(_listen_buf)) >= 0) {
+            if (_cache_build_response(ce, &pdu, buf, CONFIG_GCOAP_PDU_BUF_SIZE) >= 0) {
                 memo->state = (ce->truncated) ? GCOAP_MEMO_RESP_TRUNC : GCOAP_MEMO_RESP;
                 memo->resp_handler(memo, &pdu, &memo->remote_ep);
                 _memo_clear_resend_buffer(memo);
-                memo->state = GCOAP_MEMO_UNUSED;
+                mutex_lock(&_coap_state.lock);
+                _req_memo_remove(memo);
+                mutex_unlock(&_coap_state.lock);
             }
+            _resp_buf_put(buf);
         }
     }
     else {
@@ -1611,12 +2127,16 @@ kernel_pid_t gcoap_init(void)
     if (_pid != KERNEL_PID_UNDEF) {
         return -EEXIST;
     }
+#if IS_USED(MODULE_GCOAP_WORKERS)
+    _workers_init();
+#endif
     _pid = thread_create(_msg_stack, sizeof(_msg_stack), THREAD_PRIORITY_MAIN - 1,
                             0, _event_loop, NULL, "gcoap");
 
     mutex_init(&_coap_state.lock);
     /* Blank lists so we know if an entry is available. */
     memset(&_coap_state.open_reqs[0], 0, sizeof(_coap_state.open_reqs));
+    _req_memos_init();
     memset(&_coap_state.observers[0], 0, sizeof(_coap_state.observers));
     memset(&_coap_state.observe_memos[0], 0, sizeof(_coap_state.observe_memos));
     memset(&_coap_state.resend_bufs[0], 0, sizeof(_coap_state.resend_bufs));
@@ -1656,16 +2176,34 @@ void gcoap_register_listener(gcoap_listener_t *listener)
      * behavior will notice this. */
     assert(listener->next == NULL);
 
-    listener->next = _coap_state.listeners;
-    _coap_state.listeners = listener;
-
     if (!listener->link_encoder) {
         listener->link_encoder = gcoap_encode_link;
     }
 
     if (!listener->request_matcher) {
         listener->request_matcher = _request_matcher_default;
+#if IS_USED(MODULE_NANOCOAP_RESOURCE_TRIE)
+        /* fall back to the linear search if there is no trie left or the
+         * trie does not fit */
+        mutex_lock(&_coap_state.lock);
+        for (unsigned i = 0; i < ARRAY_SIZE(_listener_tries); i++) {
+            if (_listener_tries[i].listener != NULL) {
+                continue;
+            }
+            if (coap_resource_trie_init(&_listener_tries[i].trie,
+                                        listener->resources,
+                                        listener->resources_len) == 0) {
+                _listener_tries[i].listener = listener;
+                listener->request_matcher = _request_matcher_trie;
+            }
+            break;
+        }
+        mutex_unlock(&_coap_state.lock);
+#endif
     }
+
+    listener->next = _coap_state.listeners;
+    _coap_state.listeners = listener;
 }
 
 const coap_resource_t *gcoap_get_resource_by_path_iterator(const gcoap_listener_t **last_listener,
@@ -1738,7 +2276,7 @@ int gcoap_obs_req_forget(const sock_udp_ep_t *remote, const uint8_t *token,
     obs_req_memo = _find_req_memo_by_token(remote, token, tokenlen);
     if (obs_req_memo) {
         /* forget the existing observe memo. */
-        obs_req_memo->state = GCOAP_MEMO_UNUSED;
+        _req_memo_remove(obs_req_memo);
         res = 0;
     }
 
@@ -1755,6 +2293,7 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
     gcoap_request_memo_t *memo = NULL;
     unsigned msg_type  = (*buf & 0x30) >> 4;
     uint32_t timeout   = 0;
+    uint32_t timeout_end = 0;
     ssize_t res = 0;
     bool cache_hit = false;
 
@@ -1768,14 +2307,8 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
      * response or request is confirmable) */
     if ((resp_handler != NULL) || (msg_type == COAP_TYPE_CON)) {
         mutex_lock(&_coap_state.lock);
-        /* Find empty slot in list of open requests. */
-        for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
-            if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED) {
-                memo = &_coap_state.open_reqs[i];
-                memo->state = GCOAP_MEMO_WAIT;
-                break;
-            }
-        }
+        /* Take an empty slot in list of open requests. */
+        memo = _req_memo_alloc();
         if (!memo) {
             mutex_unlock(&_coap_state.lock);
             DEBUG("gcoap: dropping request; no space for response tracking\n");
@@ -1792,7 +2325,7 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
 
             if (res < 0) {
                 DEBUG("gcoap: Error from cache check");
-                memo->state = GCOAP_MEMO_UNUSED;
+                _req_memo_free(memo);
                 mutex_unlock(&_coap_state.lock);
                 return res;
             }
@@ -1805,7 +2338,7 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
              * the provided buffer once is possible */
             if (len > CONFIG_GCOAP_PDU_BUF_SIZE) {
                 DEBUG("gcoap: Request too large for retransmit buffer");
-                memo->state = GCOAP_MEMO_UNUSED;
+                _req_memo_free(memo);
                 mutex_unlock(&_coap_state.lock);
                 return -EINVAL;
             }
@@ -1824,14 +2357,18 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
             if (memo->msg.data.pdu_buf) {
                 memo->send_limit  = CONFIG_COAP_MAX_RETRANSMIT;
                 timeout           = (uint32_t)CONFIG_COAP_ACK_TIMEOUT_MS;
+                timeout_end       = timeout;
 #if CONFIG_COAP_RANDOM_FACTOR_1000 > 1000
-                timeout = random_uint32_range(timeout, TIMEOUT_RANGE_END);
+                timeout_end = TIMEOUT_RANGE_END;
+                timeout = random_uint32_range(timeout, timeout_end);
 #endif
                 memo->state = GCOAP_MEMO_RETRANSMIT;
             }
             else {
-                memo->state = GCOAP_MEMO_UNUSED;
                 DEBUG("gcoap: no space for PDU in resend bufs\n");
+                _req_memo_free(memo);
+                mutex_unlock(&_coap_state.lock);
+                return 0;
             }
             break;
 
@@ -1839,16 +2376,17 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
             memo->send_limit = GCOAP_SEND_LIMIT_NON;
             memcpy(&memo->msg.hdr_buf[0], buf, GCOAP_HEADER_MAXLEN);
             timeout = CONFIG_GCOAP_NON_TIMEOUT_MSEC;
+            timeout_end = timeout;
             break;
         default:
-            memo->state = GCOAP_MEMO_UNUSED;
             DEBUG("gcoap: illegal msg type %u\n", msg_type);
-            break;
-        }
-        mutex_unlock(&_coap_state.lock);
-        if (memo->state == GCOAP_MEMO_UNUSED) {
+            _req_memo_free(memo);
+            mutex_unlock(&_coap_state.lock);
             return 0;
         }
+        /* responses can be matched from now on */
+        _req_memo_insert(memo);
+        mutex_unlock(&_coap_state.lock);
         if (cache_hit) {
             /* post to receive cache entry */
             event_callback_init(&_receive_from_cache,
@@ -1881,7 +2419,7 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
             event_callback_init(&memo->resp_tmout_cb, _on_resp_timeout, memo);
             event_timeout_ztimer_init(&memo->resp_evt_tmout, ZTIMER_MSEC, &_queue,
                                &memo->resp_tmout_cb.super);
-            event_timeout_set(&memo->resp_evt_tmout, timeout);
+            _resp_timeout_set(memo, timeout, timeout_end);
         }
         else {
             memset(&memo->resp_evt_tmout, 0, sizeof(event_timeout_t));
@@ -1902,8 +2440,10 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
             if (timeout > 0) {
                 event_timeout_clear(&memo->resp_evt_tmout);
             }
-            memo->state = GCOAP_MEMO_UNUSED;
-    }
+            mutex_lock(&_coap_state.lock);
+            _req_memo_remove(memo);
+            mutex_unlock(&_coap_state.lock);
+        }
         DEBUG("gcoap: sock send failed: %" PRIdSIZE "\n", res);
     }
     return ((res > 0 || res == -ENOTCONN) ? res : 0);
@@ -1926,7 +2466,12 @@ int gcoap_resp_init(coap_pkt_t *pdu, uint8_t *buf, size_t len, unsigned code)
         return -1;
     }
 
+    /* the request may have been parsed in a different buffer */
+    pdu->hdr         = (coap_hdr_t *)buf;
     pdu->options_len = 0;
+#if IS_USED(MODULE_NANOCOAP_OPTION_INDEX)
+    pdu->opt_mask    = 0;
+#endif
     pdu->payload     = buf + header_len;
     pdu->payload_len = len - header_len;
 
@@ -2095,7 +2640,9 @@ void gcoap_forward_proxy_find_req_memo(gcoap_request_memo_t **memo_ptr,
                                        coap_pkt_t *src_pdu,
                                        const sock_udp_ep_t *remote)
 {
+    mutex_lock(&_coap_state.lock);
     *memo_ptr = _find_req_memo_by_pdu_token(src_pdu, remote);
+    mutex_unlock(&_coap_state.lock);
 }
 
 void gcoap_forward_proxy_post_event(void *arg)
@@ -120,7 +120,12 @@ static int _resp_init(coap_pkt_t *pdu, uint8_t *buf, size_t len, unsigned code)
         return -1;
     }
 
+    /* the request may have been parsed in a different buffer */
+    pdu->hdr         = (coap_hdr_t *)buf;
     pdu->options_len = 0;
+#if IS_USED(MODULE_NANOCOAP_OPTION_INDEX)
+    pdu->opt_mask    = 0;
+#endif
     pdu->payload     = buf + header_len;
     pdu->payload_len = len - header_len;
 
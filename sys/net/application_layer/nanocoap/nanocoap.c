@@ -27,7 +27,9 @@
 #include <string.h>
 
 #include "bitarithm.h"
+#include "mutex.h"
 #include "net/nanocoap.h"
+#include "net/nanocoap/resource_trie.h"
 #include "net/nanocoap_sock.h"
 
 #define ENABLE_DEBUG 0
@@ -61,8 +63,10 @@ NANOCOAP_RESOURCE(well_known_core) COAP_WELL_KNOWN_CORE_DEFAULT_HANDLER;
 #endif
 
 static int _decode_value(unsigned val, uint8_t **pkt_pos_ptr, uint8_t *pkt_end);
+static const coap_resource_trie_t *_resource_trie(void);
 static uint32_t _decode_uint(uint8_t *pkt_pos, unsigned nbytes);
 static size_t _encode_uint(uint32_t *val);
+static void _index_option(coap_pkt_t *pkt, unsigned opt_num);
 
 /* http://tools.ietf.org/html/rfc7252#section-3
  *  0                   1                   2                   3
@@ -89,6 +93,9 @@ int coap_parse(coap_pkt_t *pkt, uint8_t *buf, size_t len)
     pkt->payload_len = 0;
     memset(pkt->opt_crit, 0, sizeof(pkt->opt_crit));
     pkt->snips = NULL;
+#if IS_USED(MODULE_NANOCOAP_OPTION_INDEX)
+    pkt->opt_mask = 0;
+#endif
 
     if (len < sizeof(coap_hdr_t)) {
         DEBUG("msg too short\n");
@@ -152,6 +159,7 @@ int coap_parse(coap_pkt_t *pkt, uint8_t *buf, size_t len)
                 }
                 optpos->opt_num = option_nr;
                 optpos->offset = (uintptr_t)option_start - (uintptr_t)hdr;
+                _index_option(pkt, option_nr);
                 DEBUG("optpos option_nr=%u %u\n", (unsigned)option_nr, (unsigned)optpos->offset);
                 optpos++;
                 option_count++;
@@ -200,11 +208,42 @@ int coap_match_path(const coap_resource_t *resource, const uint8_t *uri)
     return res;
 }
 
+/* Records an option added to the options array in coap_pkt_t::opt_mask */
+static void _index_option(coap_pkt_t *pkt, unsigned opt_num)
+{
+#if IS_USED(MODULE_NANOCOAP_OPTION_INDEX)
+    if (opt_num < 32) {
+        pkt->opt_mask |= 1UL << opt_num;
+    }
+#else
+    (void)pkt;
+    (void)opt_num;
+#endif
+}
+
 uint8_t *coap_find_option(coap_pkt_t *pkt, unsigned opt_num)
 {
     const coap_optpos_t *optpos = pkt->options;
     unsigned opt_count = pkt->options_len;
 
+#if IS_USED(MODULE_NANOCOAP_OPTION_INDEX)
+    /* The options array is sorted by option number, so every option number
+     * below opt_num that is present takes at least one entry in front of the
+     * first entry for opt_num. In parsed packets, it takes exactly one. */
+    uint32_t below = pkt->opt_mask;
+
+    if (opt_num < 32) {
+        if (!(pkt->opt_mask & (1UL << opt_num))) {
+            return NULL;
+        }
+        below &= (1UL << opt_num) - 1;
+    }
+    unsigned skip = bitarithm_bits_set_u32(below);
+    assert(skip <= opt_count);
+    optpos += skip;
+    opt_count -= skip;
+#endif
+
     while (opt_count--) {
         if (optpos->opt_num == opt_num) {
             unsigned idx = index_of(pkt->options, optpos);
@@ -573,8 +612,20 @@ ssize_t coap_handle_req(coap_pkt_t *pkt, uint8_t *resp_buf, unsigned resp_buf_le
         }
     }
 
-    ssize_t retval = coap_tree_handler(pkt, resp_buf, resp_buf_len, ctx,
-                                       coap_resources, coap_resources_numof);
+    ssize_t retval;
+    const coap_resource_trie_t *trie = NULL;
+
+    if (IS_USED(MODULE_NANOCOAP_RESOURCE_TRIE)) {
+        trie = _resource_trie();
+    }
+    if (trie) {
+        retval = coap_resource_trie_handler(pkt, resp_buf, resp_buf_len, ctx,
+                                            trie);
+    }
+    else {
+        retval = coap_tree_handler(pkt, resp_buf, resp_buf_len, ctx,
+                                   coap_resources, coap_resources_numof);
+    }
 
     if (retval < 0) {
         if (retval == -ECANCELED) {
@@ -595,6 +646,22 @@ ssize_t coap_handle_req(coap_pkt_t *pkt, uint8_t *resp_buf, unsigned resp_buf_le
     return retval;
 }
 
+/* builds the trie over coap_resources on the first request */
+static const coap_resource_trie_t *_resource_trie(void)
+{
+    static coap_resource_trie_t trie;
+    static mutex_t lock = MUTEX_INIT;
+    static int res = 1;
+
+    mutex_lock(&lock);
+    if (res > 0) {
+        res = coap_resource_trie_init(&trie, coap_resources,
+                                      coap_resources_numof);
+    }
+    mutex_unlock(&lock);
+    return (res == 0) ? &trie : NULL;
+}
+
 ssize_t coap_subtree_handler(coap_pkt_t *pkt, uint8_t *buf, size_t len,
                              coap_request_ctx_t *context)
 {
@@ -1166,6 +1233,7 @@ static ssize_t _add_opt_pkt(coap_pkt_t *pkt, uint16_t optnum, const void *val,
     pkt->options[pkt->options_len].opt_num = optnum;
     pkt->options[pkt->options_len].offset = pkt->payload - (uint8_t *)pkt->hdr;
     pkt->options_len++;
+    _index_option(pkt, optnum);
     pkt->payload += optlen;
     pkt->payload_len -= optlen;
 
@@ -1360,6 +1428,13 @@ ssize_t coap_opt_remove(coap_pkt_t *pkt, uint16_t opt_num)
             memmove(start_new, start_old, move_size);
         }
         pkt->payload -= (start_old - start_new);
+#if IS_USED(MODULE_NANOCOAP_OPTION_INDEX)
+        /* other entries for opt_num may remain, so rebuild the mask */
+        pkt->opt_mask = 0;
+        for (unsigned i = 0; i < pkt->options_len; i++) {
+            _index_option(pkt, pkt->options[i].opt_num);
+        }
+#endif
     }
     return (pkt->payload - ((uint8_t *)pkt->hdr)) + pkt->payload_len;
 }
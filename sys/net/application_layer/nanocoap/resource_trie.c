@@ -0,0 +1,309 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     net_nanocoap_resource_trie
+ * @{
+ *
+ * @file
+ * @brief       nanoCoAP resource trie implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "mutex.h"
+#include "net/nanocoap/resource_trie.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define NONE        UINT16_MAX
+
+static_assert(CONFIG_NANOCOAP_RESOURCE_TRIE_NODES < NONE,
+              "CONFIG_NANOCOAP_RESOURCE_TRIE_NODES too large");
+
+/**
+ * @brief   Node of a resource trie
+ *
+ * A node stands for the path of its parent followed by `/` and its segment.
+ * It refers to the first resource with exactly that path and to the first
+ * resource with @ref COAP_MATCH_SUBTREE and that path.
+ */
+typedef struct {
+    const char *seg;                    /**< segment in a resource path */
+    uint16_t child;                     /**< first child node */
+    uint16_t sibling;                   /**< next node of the same parent */
+    uint16_t exact;                     /**< first resource with this path */
+    uint16_t subtree;                   /**< first subtree resource with this
+                                         *   path */
+    coap_method_flags_t exact_methods;  /**< methods of all resources with
+                                         *   this path */
+    coap_method_flags_t subtree_methods;/**< methods of all subtree resources
+                                         *   with this path */
+    uint8_t seg_len;                    /**< length of the segment */
+} _node_t;
+
+static _node_t _nodes[CONFIG_NANOCOAP_RESOURCE_TRIE_NODES];
+static uint16_t _nodes_numof;
+static mutex_t _lock = MUTEX_INIT;
+
+static size_t _seg_len(const char *seg)
+{
+    const char *end = seg;
+
+    while ((*end != '/') && (*end != '\0')) {
+        end++;
+    }
+    return end - seg;
+}
+
+/* orders segments like strcmp() orders the paths ending with them, so a
+ * segment sorts right after all of its prefixes */
+static int _seg_cmp(const _node_t *node, const char *seg, size_t seg_len)
+{
+    size_t len = (node->seg_len < seg_len) ? node->seg_len : seg_len;
+
+    /* segments are short, a loop beats calling memcmp() */
+    for (size_t i = 0; i < len; i++) {
+        if (node->seg[i] != seg[i]) {
+            return (uint8_t)node->seg[i] - (uint8_t)seg[i];
+        }
+    }
+    return (int)node->seg_len - (int)seg_len;
+}
+
+static uint16_t _node_get(uint16_t *head, const char *seg, size_t seg_len)
+{
+    uint16_t idx;
+    int cmp = 1;
+
+    /* keep the siblings sorted, so lookups can stop early */
+    while ((*head != NONE) &&
+           ((cmp = _seg_cmp(&_nodes[*head], seg, seg_len)) < 0)) {
+        head = &_nodes[*head].sibling;
+    }
+    if (cmp == 0) {
+        return *head;
+    }
+    if (_nodes_numof == CONFIG_NANOCOAP_RESOURCE_TRIE_NODES) {
+        return NONE;
+    }
+    idx = _nodes_numof++;
+    _nodes[idx] = (_node_t){
+        .seg = seg,
+        .seg_len = seg_len,
+        .child = NONE,
+        .sibling = *head,
+        .exact = NONE,
+        .subtree = NONE,
+    };
+    *head = idx;
+    return idx;
+}
+
+static int _insert(coap_resource_trie_t *trie, uint16_t res_idx)
+{
+    const coap_resource_t *resource = &trie->resources[res_idx];
+    const char *seg = resource->path;
+    uint16_t *head = &trie->root;
+    _node_t *node;
+
+    if (seg[0] != '/') {
+        return -EINVAL;
+    }
+    while (1) {
+        size_t seg_len = _seg_len(++seg);
+        uint16_t idx;
+
+        if (seg_len > UINT8_MAX) {
+            return -EINVAL;
+        }
+        idx = _node_get(head, seg, seg_len);
+        if (idx == NONE) {
+            return -ENOMEM;
+        }
+        node = &_nodes[idx];
+        seg += seg_len;
+        if (*seg == '\0') {
+            break;
+        }
+        head = &node->child;
+    }
+    if (resource->methods & COAP_MATCH_SUBTREE) {
+        if (node->subtree == NONE) {
+            node->subtree = res_idx;
+        }
+        node->subtree_methods |= resource->methods;
+    }
+    else {
+        if (node->exact == NONE) {
+            node->exact = res_idx;
+        }
+        node->exact_methods |= resource->methods;
+    }
+    return 0;
+}
+
+int coap_resource_trie_init(coap_resource_trie_t *trie,
+                            const coap_resource_t *resources,
+                            size_t resources_numof)
+{
+    int res = 0;
+
+    trie->resources = resources;
+    trie->resources_numof = 0;
+    trie->root = NONE;
+    if (resources_numof >= NONE) {
+        return -EINVAL;
+    }
+    trie->resources_numof = resources_numof;
+
+    mutex_lock(&_lock);
+    uint16_t nodes_numof = _nodes_numof;
+    for (uint16_t i = 0; (res == 0) && (i < resources_numof); i++) {
+        res = _insert(trie, i);
+    }
+    if (res < 0) {
+        /* no other trie took nodes in the meantime, so give ours back */
+        DEBUG("nanocoap: resource trie needs more than %u nodes\n",
+              CONFIG_NANOCOAP_RESOURCE_TRIE_NODES - nodes_numof);
+        _nodes_numof = nodes_numof;
+        trie->resources_numof = 0;
+        trie->root = NONE;
+    }
+    mutex_unlock(&_lock);
+    return res;
+}
+
+/* returns the first resource from res_idx on with the path and kind of the
+ * resource at res_idx that allows method_flag, resources with the same path
+ * are rare, so they are searched linearly */
+static uint16_t _first_with_method(const coap_resource_trie_t *trie,
+                                   uint16_t res_idx,
+                                   coap_method_flags_t method_flag)
+{
+    const coap_resource_t *first = &trie->resources[res_idx];
+    coap_method_flags_t subtree = first->methods & COAP_MATCH_SUBTREE;
+
+    if (first->methods & method_flag) {
+        return res_idx;
+    }
+    for (uint16_t i = res_idx + 1; i < trie->resources_numof; i++) {
+        const coap_resource_t *resource = &trie->resources[i];
+
+        if ((resource->methods & method_flag) &&
+            ((resource->methods & COAP_MATCH_SUBTREE) == subtree) &&
+            (strcmp(resource->path, first->path) == 0)) {
+            return i;
+        }
+    }
+    return NONE;
+}
+
+/* records the resource at res_idx as candidate for the request, if any
+ * resource with its path and kind allows method_flag */
+static void _candidate(const coap_resource_trie_t *trie, uint16_t res_idx,
+                       coap_method_flags_t methods,
+                       coap_method_flags_t method_flag,
+                       uint16_t *found, bool *wrong_method)
+{
+    if (res_idx == NONE) {
+        return;
+    }
+    if (methods & method_flag) {
+        uint16_t idx = _first_with_method(trie, res_idx, method_flag);
+
+        if (idx < *found) {
+            *found = idx;
+        }
+    }
+    else {
+        *wrong_method = true;
+    }
+}
+
+int coap_resource_trie_find(const coap_resource_trie_t *trie, const char *uri,
+                            coap_method_flags_t method_flag,
+                            const coap_resource_t **resource)
+{
+    uint16_t found = NONE;
+    bool wrong_method = false;
+    uint16_t head = trie->root;
+
+    if (uri[0] != '/') {
+        return -ENOENT;
+    }
+    while (head != NONE) {
+        size_t seg_len = _seg_len(++uri);
+        bool last = (uri[seg_len] == '\0');
+        uint16_t next = NONE;
+
+        for (uint16_t idx = head; idx != NONE; idx = _nodes[idx].sibling) {
+            const _node_t *node = &_nodes[idx];
+            int cmp = _seg_cmp(node, uri, seg_len);
+
+            if (cmp > 0) {
+                /* neither this nor any further sibling is a prefix of the
+                 * segment */
+                break;
+            }
+            if ((cmp < 0) && ((node->seg_len >= seg_len) ||
+                              (memcmp(node->seg, uri, node->seg_len) != 0))) {
+                continue;
+            }
+            /* the path of a subtree resource only needs to be a prefix of
+             * the request path, so its last segment may be a prefix of the
+             * segment of the request */
+            _candidate(trie, node->subtree, node->subtree_methods, method_flag,
+                       &found, &wrong_method);
+            if (cmp == 0) {
+                next = idx;
+                if (last) {
+                    _candidate(trie, node->exact, node->exact_methods,
+                               method_flag, &found, &wrong_method);
+                }
+                break;
+            }
+        }
+        if (last || (next == NONE)) {
+            break;
+        }
+        head = _nodes[next].child;
+        uri += seg_len;
+    }
+
+    if (found != NONE) {
+        *resource = &trie->resources[found];
+        return 0;
+    }
+    return wrong_method ? -ENOTSUP : -ENOENT;
+}
+
+ssize_t coap_resource_trie_handler(coap_pkt_t *pkt, uint8_t *resp_buf,
+                                   unsigned resp_buf_len,
+                                   coap_request_ctx_t *ctx,
+                                   const coap_resource_trie_t *trie)
+{
+    coap_method_flags_t method_flag = coap_method2flag(coap_get_code_detail(pkt));
+    const coap_resource_t *resource;
+
+    uint8_t uri[CONFIG_NANOCOAP_URI_MAX];
+    if (coap_get_uri_path(pkt, uri) <= 0) {
+        return -EBADMSG;
+    }
+    DEBUG("nanocoap: URI path: \"%s\"\n", uri);
+
+    if (coap_resource_trie_find(trie, (char *)uri, method_flag, &resource) == 0) {
+        ctx->resource = resource;
+        return resource->handler(pkt, resp_buf, resp_buf_len, ctx);
+    }
+
+    return coap_build_reply(pkt, COAP_CODE_404, resp_buf, resp_buf_len, 0);
+}
@@ -13,7 +13,9 @@
  */
 
 #include <inttypes.h>
+#include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "modules.h"
 #include "od.h"
@@ -22,10 +24,155 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
-uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
+/* The sum is built from words loaded in host byte order, which is the same as
+ * summing up 16 bit words in network byte order and swapping the bytes of the
+ * result (RFC 1071, section 2(B)). Words are loaded at aligned addresses only;
+ * starting at an odd address shifts the pairing of the bytes by one, which
+ * again just swaps the bytes of the result. */
+#if UINTPTR_MAX > UINT32_MAX
+typedef uint64_t _word_t;
+
+/* adds with end-around carry, so the sum stays congruent modulo 2^64 - 1 */
+static inline uint64_t _add(uint64_t acc, uint64_t v)
+{
+    acc += v;
+    return acc + (acc < v);
+}
+#else
+typedef uint32_t _word_t;
+
+/* a 64 bit accumulator does not overflow for less than 2^32 words */
+static inline uint64_t _add(uint64_t acc, uint32_t v)
+{
+    return acc + v;
+}
+#endif
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define _HOST_IS_BE         (1)
+#else
+#define _HOST_IS_BE         (0)
+#endif
+
+static inline uint16_t _swap(uint16_t v)
+{
+    return (v << 8) | (v >> 8);
+}
+
+static inline uint16_t _load16(const uint8_t *src)
+{
+    uint16_t w;
+
+    memcpy(&w, __builtin_assume_aligned(src, sizeof(w)), sizeof(w));
+    return w;
+}
+
+static inline _word_t _load_word(const uint8_t *src)
+{
+    _word_t w;
+
+    memcpy(&w, __builtin_assume_aligned(src, sizeof(w)), sizeof(w));
+    return w;
+}
+
+static inline uint16_t _fold(uint64_t acc)
+{
+    acc = (acc & 0xffffffff) + (acc >> 32);
+    acc = (acc & 0xffffffff) + (acc >> 32);
+    acc = (acc & 0xffff) + (acc >> 16);
+    acc = (acc & 0xffff) + (acc >> 16);
+    return acc;
+}
+
+/* sum of the bytes at the odd (second) position of a host order 16 bit word */
+static inline uint16_t _lo_byte(uint8_t b)
+{
+    return (_HOST_IS_BE) ? b : (uint16_t)(b << 8);
+}
+
+/* sum of the bytes at the even (first) position of a host order 16 bit word */
+static inline uint16_t _hi_byte(uint8_t b)
+{
+    return (_HOST_IS_BE) ? (uint16_t)(b << 8) : b;
+}
+
+/* Returns the folded sum of @p src in network byte order, pairing bytes
+ * starting with the first one. If @p dst is not NULL, @p src is copied to it
+ * along the way. */
+static inline __attribute__((always_inline))
+uint16_t _csum(uint8_t *dst, const uint8_t *src, size_t len)
+{
+    uint64_t acc = 0;
+    bool odd = ((uintptr_t)src & 1);
+
+    if (odd) {
+        acc = _lo_byte(*src);
+        if (dst) {
+            *dst++ = *src;
+        }
+        src++;
+        len--;
+    }
+    while (((uintptr_t)src & (sizeof(_word_t) - 1)) && (len >= 2)) {
+        uint16_t w = _load16(src);
+        if (dst) {
+            memcpy(dst, &w, sizeof(w));
+            dst += sizeof(w);
+        }
+        acc = _add(acc, w);
+        src += sizeof(w);
+        len -= sizeof(w);
+    }
+    while (len >= 4 * sizeof(_word_t)) {
+        _word_t w0 = _load_word(src);
+        _word_t w1 = _load_word(src + sizeof(_word_t));
+        _word_t w2 = _load_word(src + 2 * sizeof(_word_t));
+        _word_t w3 = _load_word(src + 3 * sizeof(_word_t));
+        if (dst) {
+            memcpy(dst, src, 4 * sizeof(_word_t));
+            dst += 4 * sizeof(_word_t);
+        }
+        acc = _add(acc, w0);
+        acc = _add(acc, w1);
+        acc = _add(acc, w2);
+        acc = _add(acc, w3);
+        src += 4 * sizeof(_word_t);
+        len -= 4 * sizeof(_word_t);
+    }
+    while (len >= 2) {
+        uint16_t w = _load16(src);
+        if (dst) {
+            memcpy(dst, &w, sizeof(w));
+            dst += sizeof(w);
+        }
+        acc = _add(acc, w);
+        src += sizeof(w);
+        len -= sizeof(w);
+    }
+    if (len) {
+        acc = _add(acc, _hi_byte(*src));
+        if (dst) {
+            *dst = *src;
+        }
+    }
+
+    uint16_t res = _fold(acc);
+    return (odd != _HOST_IS_BE) ? res : _swap(res);
+}
+
+static uint16_t _add_slice(uint16_t sum, uint16_t slice, size_t accum_len)
 {
-    uint32_t csum = sum;
+    /* if the accumulated length is odd, the first byte is the bottom half of
+     * a 16 bit word, so all bytes of this slice are paired the other way */
+    uint32_t csum = (uint32_t)sum + ((accum_len & 1) ? _swap(slice) : slice);
 
+    csum = (csum & 0xffff) + (csum >> 16);
+    DEBUG("inet_sum: new sum = 0x%04" PRIx32 "\n", csum);
+    return csum;
+}
+
+static void _debug_buf(uint16_t sum, const uint8_t *buf, uint16_t len)
+{
     DEBUG("inet_sum: sum = 0x%04" PRIx16 ", len = %" PRIu16, sum, len);
 
     if (IS_ACTIVE(ENABLE_DEBUG)) {
@@ -36,33 +183,27 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
             DEBUG(", buf output only with od module\n");
         }
     }
+}
 
-    if (len == 0)
-        return csum;
-
-    if (accum_len & 1) {      /* if accumulated length is odd */
-        csum += *buf;         /* add first byte as bottom half of 16-byte word */
-        buf++;
-        len--;
-        accum_len++;
-    }
+uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
+{
+    _debug_buf(sum, buf, len);
 
-    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
-        csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
-                                                    /* and add them */
+    if (len == 0) {
+        return sum;
     }
+    return _add_slice(sum, _csum(NULL, buf, len), accum_len);
+}
 
-    if ((accum_len + len) & 1)          /* if accumulated length is odd */
-        csum += (uint16_t)(*buf << 8);  /* add last byte as top half of 16-byte word */
+uint16_t inet_csum_slice_copy(uint16_t sum, uint8_t *dst, const uint8_t *src,
+                              uint16_t len, size_t accum_len)
+{
+    _debug_buf(sum, src, len);
 
-    while (csum >> 16) {
-        uint16_t carry = csum >> 16;
-        csum = (csum & 0xffff) + carry;
+    if (len == 0) {
+        return sum;
     }
-
-    DEBUG("inet_sum: new sum = 0x%04" PRIx32 "\n", csum);
-
-    return csum;
+    return _add_slice(sum, _csum(dst, src, len), accum_len);
 }
 
 /** @} */
@@ -30,6 +30,9 @@
 #if IS_USED(MODULE_GNRC_NETIF_PKTQ)
 #include "net/gnrc/netif/pktq.h"
 #endif /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
+#if IS_USED(MODULE_GNRC_NETIF_RXBUF)
+#include "net/gnrc/netif/rxbuf.h"
+#endif /* IS_USED(MODULE_GNRC_NETIF_RXBUF) */
 #include "net/gnrc/sixlowpan/ctx.h"
 #if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR)
 #include "net/gnrc/sixlowpan/frag/sfr.h"
@@ -209,6 +212,13 @@ int gnrc_netif_get_from_netdev(gnrc_netif_t *netif, gnrc_netapi_opt_t *opt)
                        sizeof(netif->stats));
                 res = sizeof(netif->stats);
                 break;
+#endif
+#if IS_USED(MODULE_NETSTATS_LATENCY)
+            case NETSTATS_LATENCY:
+                assert(opt->data_len == sizeof(netstats_latency_t));
+                memcpy(opt->data, &netif->latency, sizeof(netif->latency));
+                res = sizeof(netif->latency);
+                break;
 #endif
             default:
                 /* take from device */
@@ -443,6 +453,12 @@ int gnrc_netif_set_from_netdev(gnrc_netif_t *netif,
                 memset(&netif->stats, 0, sizeof(netif->stats));
                 res = 0;
                 break;
+#endif
+#if IS_USED(MODULE_NETSTATS_LATENCY)
+            case NETSTATS_LATENCY:
+                memset(&netif->latency, 0, sizeof(netif->latency));
+                res = 0;
+                break;
 #endif
             default:
                 /* take from device */
@@ -1692,6 +1708,10 @@ static void _event_handler_isr(event_t *evp)
 {
     gnrc_netif_t *netif = container_of(evp, gnrc_netif_t, event_isr);
     netif->dev->driver->isr(netif->dev);
+#if IS_USED(MODULE_NETSTATS_LATENCY)
+    /* the interrupt did not signal a received frame */
+    atomic_store_u32(&netif->latency_probe.rx_isr, 0);
+#endif
 }
 
 static void _process_receive_stats(gnrc_netif_t *netdev, gnrc_pktsnip_t *pkt)
@@ -1715,6 +1735,96 @@ static void _process_receive_stats(gnrc_netif_t *netdev, gnrc_pktsnip_t *pkt)
     netstats_nb_update_rx(&netdev->netif, src, src_len, hdr->rssi, hdr->lqi);
 }
 
+#if IS_USED(MODULE_NETSTATS_LATENCY)
+static void _latency_tx_enter(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    gnrc_netif_hdr_t *hdr = pkt->data;
+
+    hdr->tx_time = 0;
+    if (netstats_latency_sample(&netif->latency_probe)) {
+        /* 0 marks untimed packets */
+        hdr->tx_time = ztimer_now(ZTIMER_USEC) | 1;
+    }
+}
+
+static void _latency_tx_handover(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    netstats_latency_probe_t *probe = &netif->latency_probe;
+    gnrc_netif_hdr_t *hdr = pkt->data;
+
+    probe->tx_state = NETSTATS_LATENCY_TX_IDLE;
+    if (hdr->tx_time != 0) {
+        uint32_t now = ztimer_now(ZTIMER_USEC);
+
+        netstats_latency_record(&netif->latency, NETSTATS_LATENCY_TX_QUEUE,
+                                now - hdr->tx_time);
+        /* retries of this packet are not timed again */
+        hdr->tx_time = 0;
+        probe->tx_time = now;
+        probe->tx_state = NETSTATS_LATENCY_TX_HANDOVER;
+    }
+}
+
+static void _latency_tx_done(gnrc_netif_t *netif, netstats_latency_kind_t kind)
+{
+    netstats_latency_probe_t *probe = &netif->latency_probe;
+
+    if (probe->tx_state != NETSTATS_LATENCY_TX_IDLE) {
+        netstats_latency_record(&netif->latency, kind,
+                                ztimer_now(ZTIMER_USEC) - probe->tx_time);
+        probe->tx_state = NETSTATS_LATENCY_TX_IDLE;
+    }
+}
+
+static void _latency_tx_event(gnrc_netif_t *netif, netdev_event_t event)
+{
+    netstats_latency_probe_t *probe = &netif->latency_probe;
+    netstats_latency_kind_t kind = NETSTATS_LATENCY_TX_AIR;
+
+    switch (event) {
+    case NETDEV_EVENT_TX_STARTED:
+        if (probe->tx_state == NETSTATS_LATENCY_TX_HANDOVER) {
+            uint32_t now = ztimer_now(ZTIMER_USEC);
+
+            netstats_latency_record(&netif->latency,
+                                    NETSTATS_LATENCY_TX_ACCESS,
+                                    now - probe->tx_time);
+            probe->tx_time = now;
+            probe->tx_state = NETSTATS_LATENCY_TX_STARTED;
+        }
+        return;
+    case NETDEV_EVENT_TX_COMPLETE:
+        break;
+#if IS_USED(MODULE_NETDEV_LEGACY_API)
+    case NETDEV_EVENT_TX_MEDIUM_BUSY:
+        /* the frame never went on air */
+        kind = NETSTATS_LATENCY_TX_ACCESS;
+        break;
+    case NETDEV_EVENT_TX_COMPLETE_DATA_PENDING:
+    case NETDEV_EVENT_TX_NOACK:
+        break;
+#endif
+    default:
+        return;
+    }
+    probe->tx_events = true;
+    _latency_tx_done(netif, kind);
+}
+
+static void _latency_rx(gnrc_netif_t *netif)
+{
+    netstats_latency_probe_t *probe = &netif->latency_probe;
+    uint32_t isr = atomic_load_u32(&probe->rx_isr);
+
+    /* only the first frame after an interrupt is timed */
+    atomic_store_u32(&probe->rx_isr, 0);
+    if ((isr != 0) && netstats_latency_sample(probe)) {
+        netstats_latency_record(&netif->latency, NETSTATS_LATENCY_RX,
+                                ztimer_now(ZTIMER_USEC) - isr);
+    }
+}
+#endif
+
 static event_t *_gnrc_netif_fetch_event(gnrc_netif_t *netif)
 {
     event_t *ev;
@@ -1734,9 +1844,13 @@ static event_t *_gnrc_netif_fetch_event(gnrc_netif_t *netif)
  * the event queue will be processed while waiting for messages.
  *
  * @param[in]   netif   gnrc_netif instance to operate on
- * @param[out]  msg     pointer to message buffer to write the first received message
+ * @param[out]  msgs    message buffer to write the received messages to
+ * @param[in]   max     maximum number of messages to write to @p msgs
+ *
+ * @return  number of messages received, at least 1
  */
-static void _process_events_await_msg(gnrc_netif_t *netif, msg_t *msg)
+static int _process_events_await_msgs(gnrc_netif_t *netif, msg_t *msgs,
+                                      unsigned max)
 {
     while (1) {
         /* Using messages for external IPC, and events for internal events */
@@ -1754,9 +1868,9 @@ static void _process_events_await_msg(gnrc_netif_t *netif, msg_t *msg)
             }
         }
         /* non-blocking msg check */
-        int msg_waiting = msg_try_receive(msg);
+        int msg_waiting = msg_try_receive_many(msgs, max);
         if (msg_waiting > 0) {
-            return;
+            return msg_waiting;
         }
         DEBUG("gnrc_netif: waiting for events\n");
         /* Block the thread until something interesting happens */
@@ -1847,6 +1961,9 @@ static void _tx_done(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
         }
         else {
             LOG_ERROR("gnrc_netif: can't queue packet for sending, drop it\n");
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_PRIO) && defined(MODULE_NETSTATS_L2)
+            netif->stats.tx_queue_drops[gnrc_netif_pktq_class(pkt)]++;
+#endif
             /* If we got here, it means the device was busy and the pkt queue
              * was full. The packet should be dropped here anyway */
             gnrc_pktbuf_release_error(pkt, ENOMEM);
@@ -1881,6 +1998,10 @@ static void _event_handler_tx_done(event_t *evp)
      * frame. So clear netif->tx_pkt to signal readiness */
     gnrc_pktsnip_t *pkt = netif->tx_pkt;
     netif->tx_pkt = NULL;
+#if IS_USED(MODULE_NETSTATS_LATENCY)
+    _latency_tx_done(netif, (res == -EBUSY) ? NETSTATS_LATENCY_TX_ACCESS
+                                            : NETSTATS_LATENCY_TX_AIR);
+#endif
     bool push_back = netif->flags & GNRC_NETIF_FLAGS_TX_FROM_PKTQUEUE;
     netif->flags &= ~GNRC_NETIF_FLAGS_TX_FROM_PKTQUEUE;
     _tx_done(netif, pkt, NULL, res, push_back);
@@ -1889,6 +2010,11 @@ static void _event_handler_tx_done(event_t *evp)
 
 static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
 {
+#if IS_USED(MODULE_NETSTATS_LATENCY)
+    if (!push_back) {
+        _latency_tx_enter(netif, pkt);
+    }
+#endif
 #if IS_USED(MODULE_NETDEV_NEW_API)
     if (netif->tx_pkt != NULL) {
         /* Upper layer is handing out frames faster than hardware can transmit.
@@ -1909,15 +2035,32 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
     if (!push_back && !gnrc_netif_pktq_empty(netif)) {
         int put_res;
 
-        /* try to send pkt from queue first. At least with the legacy blocking
-         * API, this may make room in the pktqueue */
-        _send_queued_pkt(netif);
-
-        put_res = gnrc_netif_pktq_put(netif, pkt);
+        if (IS_USED(MODULE_GNRC_NETIF_PKTQ_PRIO)) {
+            /* queue first, so pkt competes with the queued packets of lower
+             * priority for the device */
+            put_res = gnrc_netif_pktq_put(netif, pkt);
+            _send_queued_pkt(netif);
+        }
+        else {
+            /* try to send pkt from queue first. At least with the legacy
+             * blocking API, this may make room in the pktqueue */
+            _send_queued_pkt(netif);
+            put_res = gnrc_netif_pktq_put(netif, pkt);
+        }
         if (put_res == 0) {
             DEBUG("gnrc_netif: (re-)queued pkt %p\n", (void *)pkt);
             return;
         }
+        else if (IS_USED(MODULE_GNRC_NETIF_PKTQ_PRIO)) {
+            /* sending pkt now would let it overtake the queued packets and
+             * defeat the depth limit of its class */
+            LOG_WARNING("gnrc_netif: can't queue packet for sending, drop it\n");
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_PRIO) && defined(MODULE_NETSTATS_L2)
+            netif->stats.tx_queue_drops[gnrc_netif_pktq_class(pkt)]++;
+#endif
+            gnrc_pktbuf_release_error(pkt, ENOMEM);
+            return;
+        }
         else {
             LOG_WARNING("gnrc_netif: can't queue packet for sending, try sending\n");
             /* try to send anyway */
@@ -1948,8 +2091,24 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
     /* Split off the TX sync snip */
     gnrc_pktsnip_t *tx_sync = IS_USED(MODULE_GNRC_TX_SYNC)
                             ? gnrc_tx_sync_split(pkt) : NULL;
+#if IS_USED(MODULE_NETSTATS_LATENCY)
+    _latency_tx_handover(netif, pkt);
+#endif
     int res = netif->ops->send(netif, pkt);
 
+#if IS_USED(MODULE_NETSTATS_LATENCY)
+    if (res < 0) {
+        /* nothing was sent */
+        netif->latency_probe.tx_state = NETSTATS_LATENCY_TX_IDLE;
+    }
+    else if (gnrc_netif_netdev_legacy_api(netif) &&
+             !netif->latency_probe.tx_events) {
+        /* driver does not report TX completion, so send() blocked until the
+         * frame was sent */
+        _latency_tx_done(netif, NETSTATS_LATENCY_TX_AIR);
+    }
+#endif
+
     /* For legacy netdevs (no confirm_send) TX is blocking, thus it is always
      * completed. For new netdevs (with confirm_send), TX is async. It is only
      * done if TX failed right away (res < 0).
@@ -1971,13 +2130,73 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
 #endif
 }
 
+static void _process_msg(gnrc_netif_t *netif, msg_t *msg)
+{
+    msg_t reply = { .type = GNRC_NETAPI_MSG_TYPE_ACK };
+    gnrc_netapi_opt_t *opt;
+    int res;
+
+    /* dispatch netdev, MAC and gnrc_netapi messages */
+    DEBUG("gnrc_netif: message %u\n", (unsigned)msg->type);
+    switch (msg->type) {
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ)
+        case GNRC_NETIF_PKTQ_DEQUEUE_MSG:
+            DEBUG("gnrc_netif: send from packet send queue\n");
+            _send_queued_pkt(netif);
+            break;
+#endif  /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
+        case GNRC_NETAPI_MSG_TYPE_SND:
+            DEBUG("gnrc_netif: GNRC_NETDEV_MSG_TYPE_SND received\n");
+            _send(netif, msg->content.ptr, false);
+            break;
+        case GNRC_NETAPI_MSG_TYPE_SET:
+            opt = msg->content.ptr;
+#ifdef MODULE_NETOPT
+            DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_SET received. opt=%s\n",
+                  netopt2str(opt->opt));
+#else
+            DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_SET received. opt=%d\n",
+                  opt->opt);
+#endif
+            /* set option for device driver */
+            res = netif->ops->set(netif, opt);
+            DEBUG("gnrc_netif: response of netif->ops->set(): %i\n", res);
+            reply.content.value = (uint32_t)res;
+            msg_reply(msg, &reply);
+            break;
+        case GNRC_NETAPI_MSG_TYPE_GET:
+            opt = msg->content.ptr;
+#ifdef MODULE_NETOPT
+            DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_GET received. opt=%s\n",
+                  netopt2str(opt->opt));
+#else
+            DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_GET received. opt=%d\n",
+                  opt->opt);
+#endif
+            /* get option from device driver */
+            res = netif->ops->get(netif, opt);
+            DEBUG("gnrc_netif: response of netif->ops->get(): %i\n", res);
+            reply.content.value = (uint32_t)res;
+            msg_reply(msg, &reply);
+            break;
+        default:
+            if (netif->ops->msg_handler) {
+                DEBUG("gnrc_netif: delegate message of type 0x%04x to "
+                      "netif->ops->msg_handler()\n", msg->type);
+                netif->ops->msg_handler(netif, msg);
+            }
+            else {
+                DEBUG("gnrc_netif: unknown message type 0x%04x"
+                      "(no message handler defined)\n", msg->type);
+            }
+            break;
+    }
+}
+
 static void *_gnrc_netif_thread(void *args)
 {
     _netif_ctx_t *ctx = args;
-    gnrc_netapi_opt_t *opt;
     gnrc_netif_t *netif;
-    int res;
-    msg_t reply = { .type = GNRC_NETAPI_MSG_TYPE_ACK };
 
     DEBUG("gnrc_netif: starting thread %i\n", thread_getpid());
     netif = ctx->netif;
@@ -2011,24 +2230,17 @@ static void *_gnrc_netif_thread(void *args)
 #endif
 
     while (1) {
-        msg_t msg;
-        /* msg will be filled by _process_events_await_msg.
+        msg_t msgs[CONFIG_GNRC_NETIF_MSG_BATCH_SIZE];
+        /* msgs will be filled by _process_events_await_msgs.
          * The function will not return until a message has been received. */
-        _process_events_await_msg(netif, &msg);
+        int num = _process_events_await_msgs(netif, msgs, ARRAY_SIZE(msgs));
 
-        /* dispatch netdev, MAC and gnrc_netapi messages */
-        DEBUG("gnrc_netif: message %u\n", (unsigned)msg.type);
-        switch (msg.type) {
-#if IS_USED(MODULE_GNRC_NETIF_PKTQ)
-            case GNRC_NETIF_PKTQ_DEQUEUE_MSG:
-                DEBUG("gnrc_netif: send from packet send queue\n");
-                _send_queued_pkt(netif);
-                break;
-#endif  /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
-            case GNRC_NETAPI_MSG_TYPE_SND:
-                DEBUG("gnrc_netif: GNRC_NETDEV_MSG_TYPE_SND received\n");
-                _send(netif, msg.content.ptr, false);
+        for (int i = 0; i < num; i++) {
+            uint16_t type = msgs[i].type;
+
+            _process_msg(netif, &msgs[i]);
 #if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
+            if (type == GNRC_NETAPI_MSG_TYPE_SND) {
                 ztimer_periodic_wakeup(
                         ZTIMER_USEC,
                         &last_wakeup,
@@ -2037,55 +2249,62 @@ static void *_gnrc_netif_thread(void *args)
                 /* override last_wakeup in case last_wakeup +
                  * CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US was in the past */
                 last_wakeup = ztimer_now(ZTIMER_USEC);
-#endif
-                break;
-            case GNRC_NETAPI_MSG_TYPE_SET:
-                opt = msg.content.ptr;
-#ifdef MODULE_NETOPT
-                DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_SET received. opt=%s\n",
-                      netopt2str(opt->opt));
-#else
-                DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_SET received. opt=%d\n",
-                      opt->opt);
-#endif
-                /* set option for device driver */
-                res = netif->ops->set(netif, opt);
-                DEBUG("gnrc_netif: response of netif->ops->set(): %i\n", res);
-                reply.content.value = (uint32_t)res;
-                msg_reply(&msg, &reply);
-                break;
-            case GNRC_NETAPI_MSG_TYPE_GET:
-                opt = msg.content.ptr;
-#ifdef MODULE_NETOPT
-                DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_GET received. opt=%s\n",
-                      netopt2str(opt->opt));
+            }
 #else
-                DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_GET received. opt=%d\n",
-                      opt->opt);
+            (void)type;
 #endif
-                /* get option from device driver */
-                res = netif->ops->get(netif, opt);
-                DEBUG("gnrc_netif: response of netif->ops->get(): %i\n", res);
-                reply.content.value = (uint32_t)res;
-                msg_reply(&msg, &reply);
-                break;
-            default:
-                if (netif->ops->msg_handler) {
-                    DEBUG("gnrc_netif: delegate message of type 0x%04x to "
-                          "netif->ops->msg_handler()\n", msg.type);
-                    netif->ops->msg_handler(netif, &msg);
-                }
-                else {
-                    DEBUG("gnrc_netif: unknown message type 0x%04x"
-                          "(no message handler defined)\n", msg.type);
-                }
-                break;
         }
     }
     /* never reached */
     return NULL;
 }
 
+#if IS_USED(MODULE_GNRC_NETIF_RXBUF)
+void gnrc_netif_rxbuf_post(gnrc_netif_t *netif)
+{
+    if ((netif->rx_buf == NULL) && (netif->rx_buf_len > 0)) {
+        /* on failure, the buffer is allocated on reception */
+        netif->rx_buf = gnrc_pktbuf_add(NULL, NULL, netif->rx_buf_len,
+                                        GNRC_NETTYPE_UNDEF);
+    }
+}
+
+gnrc_pktsnip_t *gnrc_netif_rxbuf_recv(gnrc_netif_t *netif, size_t max_len,
+                                      void *info)
+{
+    netdev_t *dev = netif->dev;
+    gnrc_pktsnip_t *pkt;
+    int nread;
+
+    assert((max_len > 0) && (max_len <= UINT16_MAX));
+    if (netif->rx_buf_len != max_len) {
+        if (netif->rx_buf != NULL) {
+            gnrc_pktbuf_release(netif->rx_buf);
+            netif->rx_buf = NULL;
+        }
+        netif->rx_buf_len = max_len;
+    }
+    gnrc_netif_rxbuf_post(netif);
+    pkt = netif->rx_buf;
+    if (pkt == NULL) {
+        DEBUG("gnrc_netif: cannot allocate receive buffer\n");
+        /* drop the frame */
+        dev->driver->recv(dev, NULL, max_len, NULL);
+        return NULL;
+    }
+    nread = dev->driver->recv(dev, pkt->data, pkt->size, info);
+    if (nread <= 0) {
+        DEBUG("gnrc_netif: read error %d\n", nread);
+        /* keep the buffer posted for the next frame */
+        return NULL;
+    }
+    netif->rx_buf = NULL;
+    /* shrinking is done in place */
+    gnrc_pktbuf_realloc_data(pkt, nread);
+    return pkt;
+}
+#endif
+
 static void _pass_on_packet(gnrc_pktsnip_t *pkt)
 {
     /* throw away packet if no one is interested */
@@ -2102,6 +2321,10 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
     gnrc_netif_t *netif = (gnrc_netif_t *)dev->context;
 
     if (event == NETDEV_EVENT_ISR) {
+#if IS_USED(MODULE_NETSTATS_LATENCY)
+        atomic_store_u32(&netif->latency_probe.rx_isr,
+                         ztimer_now(ZTIMER_USEC) | 1);
+#endif
         event_post(&netif->evq[GNRC_NETIF_EVQ_INDEX_PRIO_LOW], &netif->event_isr);
     }
 #if IS_USED(MODULE_NETDEV_NEW_API)
@@ -2114,6 +2337,9 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
     else {
         DEBUG("gnrc_netif: event triggered -> %i\n", event);
         gnrc_pktsnip_t *pkt = NULL;
+#if IS_USED(MODULE_NETSTATS_LATENCY)
+        _latency_tx_event(netif, event);
+#endif
         switch (event) {
             case NETDEV_EVENT_LINK_UP:
                 if (IS_USED(MODULE_GNRC_IPV6)) {
@@ -2138,7 +2364,15 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                 if (pkt) {
                     _process_receive_stats(netif, pkt);
                     _pass_on_packet(pkt);
+#if IS_USED(MODULE_NETSTATS_LATENCY)
+                    _latency_rx(netif);
+#endif
                 }
+#if IS_USED(MODULE_GNRC_NETIF_RXBUF)
+                /* post the buffer for the next frame now, rather than when it
+                 * is already waiting in the device */
+                gnrc_netif_rxbuf_post(netif);
+#endif
                 break;
 #if IS_USED(MODULE_NETDEV_LEGACY_API)
 #  if IS_USED(MODULE_NETSTATS_L2) || IS_USED(MODULE_GNRC_NETIF_PKTQ)
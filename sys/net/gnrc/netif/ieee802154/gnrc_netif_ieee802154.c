@@ -15,6 +15,9 @@
 
 #include "net/gnrc.h"
 #include "net/gnrc/netif/ieee802154.h"
+#if IS_USED(MODULE_GNRC_NETIF_RXBUF)
+#include "net/gnrc/netif/rxbuf.h"
+#endif
 #include "net/netdev/ieee802154.h"
 
 #ifdef MODULE_GNRC_IPV6
@@ -26,6 +29,18 @@
 
 #include "od.h"
 
+#if IS_USED(MODULE_GNRC_NETIF_RXBUF)
+/* frames of the SUN PHYs (IEEE 802.15.4g) are longer than those of the legacy
+ * PHYs, and the PHY of a device may be changed at run time */
+#if IS_USED(MODULE_NETDEV_IEEE802154_MR_OQPSK) || \
+    IS_USED(MODULE_NETDEV_IEEE802154_MR_OFDM) || \
+    IS_USED(MODULE_NETDEV_IEEE802154_MR_FSK)
+#define RXBUF_FRAME_LEN_MAX     IEEE802154G_FRAME_LEN_MAX
+#else
+#define RXBUF_FRAME_LEN_MAX     IEEE802154_FRAME_LEN_MAX
+#endif
+#endif
+
 static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt);
 static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif);
 
@@ -90,28 +105,58 @@ static inline bool _already_received(gnrc_netif_t *netif,
 }
 #endif /* MODULE_GNRC_NETIF_DEDUP */
 
-static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
+static gnrc_pktsnip_t *_recv_frame(gnrc_netif_t *netif,
+                                   netdev_ieee802154_rx_info_t *rx_info)
 {
+    gnrc_pktsnip_t *pkt;
+
+#if IS_USED(MODULE_GNRC_NETIF_RXBUF)
+    pkt = gnrc_netif_rxbuf_recv(netif, RXBUF_FRAME_LEN_MAX, rx_info);
+    if ((pkt != NULL) && (pkt->size < IEEE802154_MIN_FRAME_LEN)) {
+        DEBUG("_recv_ieee802154: received frame is too short\n");
+        gnrc_pktbuf_release(pkt);
+        return NULL;
+    }
+#else
     netdev_t *dev = netif->dev;
-    netdev_ieee802154_rx_info_t rx_info;
-    gnrc_pktsnip_t *pkt = NULL;
     int bytes_expected = dev->driver->recv(dev, NULL, 0, NULL);
+    int nread;
 
-    if (bytes_expected >= (int)IEEE802154_MIN_FRAME_LEN) {
-        int nread;
-
-        pkt = gnrc_pktbuf_add(NULL, NULL, bytes_expected, GNRC_NETTYPE_UNDEF);
-        if (pkt == NULL) {
-            DEBUG("_recv_ieee802154: cannot allocate pktsnip.\n");
-            /* Discard packet on netdev device */
+    if (bytes_expected < (int)IEEE802154_MIN_FRAME_LEN) {
+        if (bytes_expected > 0) {
+            DEBUG("_recv_ieee802154: received frame is too short\n");
             dev->driver->recv(dev, NULL, bytes_expected, NULL);
-            return NULL;
-        }
-        nread = dev->driver->recv(dev, pkt->data, bytes_expected, &rx_info);
-        if (nread <= 0) {
-            gnrc_pktbuf_release(pkt);
-            return NULL;
         }
+        return NULL;
+    }
+    pkt = gnrc_pktbuf_add(NULL, NULL, bytes_expected, GNRC_NETTYPE_UNDEF);
+    if (pkt == NULL) {
+        DEBUG("_recv_ieee802154: cannot allocate pktsnip.\n");
+        /* Discard packet on netdev device */
+        dev->driver->recv(dev, NULL, bytes_expected, NULL);
+        return NULL;
+    }
+    nread = dev->driver->recv(dev, pkt->data, bytes_expected, rx_info);
+    if (nread <= 0) {
+        gnrc_pktbuf_release(pkt);
+        return NULL;
+    }
+    if (nread < bytes_expected) {
+        gnrc_pktbuf_realloc_data(pkt, nread);
+    }
+#endif
+    return pkt;
+}
+
+static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
+{
+    netdev_t *dev = netif->dev;
+    netdev_ieee802154_rx_info_t rx_info;
+    gnrc_pktsnip_t *pkt = _recv_frame(netif, &rx_info);
+
+    if (pkt != NULL) {
+        int nread = pkt->size;
+
 #ifdef MODULE_NETSTATS_L2
         netif->stats.rx_count++;
         netif->stats.rx_bytes += nread;
@@ -240,9 +285,6 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
 
         DEBUG("_recv_ieee802154: reallocating MAC payload for upper layer.\n");
         gnrc_pktbuf_realloc_data(pkt, nread);
-    } else if (bytes_expected > 0) {
-        DEBUG("_recv_ieee802154: received frame is too short\n");
-        dev->driver->recv(dev, NULL, bytes_expected, NULL);
     }
 
     return pkt;
@@ -323,7 +365,9 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     };
 
 #if IS_USED(MODULE_IEEE802154_SECURITY)
-    {
+    /* only encryption needs the L2 payload in one buffer, unsecured frames
+     * are handed to the device as they are */
+    if (flags & NETDEV_IEEE802154_SECURITY_EN) {
         /* write protect `pkt` to set `pkt->next` */
         gnrc_pktsnip_t *tmp = gnrc_pktbuf_start_write(pkt);
         if (!tmp) {
@@ -352,17 +396,15 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
         uint8_t mic[IEEE802154_SEC_MAX_MAC_SIZE];
         uint8_t mic_size = 0;
 
-        if (flags & NETDEV_IEEE802154_SECURITY_EN) {
-            res = ieee802154_sec_encrypt_frame(&state->sec_ctx,
-                                               mhr, &mhr_len,
-                                               pkt->next->data, pkt->next->size,
-                                               mic, &mic_size,
-                                               state->long_addr);
-            if (res != 0) {
-                DEBUG("_send_ieee802154: encryption failedf\n");
-                gnrc_pktbuf_release(pkt);
-                return res;
-            }
+        res = ieee802154_sec_encrypt_frame(&state->sec_ctx,
+                                           mhr, &mhr_len,
+                                           pkt->next->data, pkt->next->size,
+                                           mic, &mic_size,
+                                           state->long_addr);
+        if (res != 0) {
+            DEBUG("_send_ieee802154: encryption failedf\n");
+            gnrc_pktbuf_release(pkt);
+            return res;
         }
         if (mic_size) {
             gnrc_pktsnip_t *pktmic = gnrc_pktbuf_add(pkt->next->next,
@@ -17,8 +17,13 @@
 
 #include "net/gnrc/pktqueue.h"
 #include "net/gnrc/netif/conf.h"
+#include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/netif/internal.h"
 #include "net/gnrc/netif/pktq.h"
+#include "net/icmpv6.h"
+#include "net/ipv6/hdr.h"
+#include "net/netstats.h"
+#include "net/protnum.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -26,6 +31,28 @@
 static mutex_t _pool_lock = MUTEX_INIT;
 static gnrc_pktqueue_t _pool[CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE];
 
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_PRIO)
+/* DSCP code points (RFC 2474, RFC 8622) */
+#define DSCP_LE     (0x01)
+#define DSCP_CS1    (0x08)
+#define DSCP_CS6    (0x30)
+#define DSCP_CS7    (0x38)
+
+static_assert(GNRC_NETIF_PKTQ_CLASS_NUMOF == NETSTATS_TX_QUEUE_NUMOF,
+              "netstats_t::tx_queue_drops does not match the send queue classes");
+
+static const uint8_t _depth_max[GNRC_NETIF_PKTQ_CLASS_NUMOF] = {
+    [GNRC_NETIF_PKTQ_CLASS_CONTROL] = CONFIG_GNRC_NETIF_PKTQ_DEPTH_CONTROL,
+    [GNRC_NETIF_PKTQ_CLASS_DEFAULT] = CONFIG_GNRC_NETIF_PKTQ_DEPTH_DEFAULT,
+    [GNRC_NETIF_PKTQ_CLASS_BULK] = CONFIG_GNRC_NETIF_PKTQ_DEPTH_BULK,
+};
+
+static const uint16_t _quantum[GNRC_NETIF_PKTQ_CLASS_NUMOF] = {
+    [GNRC_NETIF_PKTQ_CLASS_DEFAULT] = CONFIG_GNRC_NETIF_PKTQ_QUANTUM_DEFAULT,
+    [GNRC_NETIF_PKTQ_CLASS_BULK] = CONFIG_GNRC_NETIF_PKTQ_QUANTUM_BULK,
+};
+#endif
+
 static gnrc_pktqueue_t *_get_free_entry(gnrc_pktsnip_t *pkt)
 {
     gnrc_pktqueue_t *entry = NULL;
@@ -55,17 +82,150 @@ unsigned gnrc_netif_pktq_usage(void)
     return res;
 }
 
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_PRIO)
+#if IS_USED(MODULE_GNRC_NETTYPE_IPV6)
+static gnrc_netif_pktq_class_t _ipv6_class(const gnrc_pktsnip_t *ipv6)
+{
+    const ipv6_hdr_t *hdr = ipv6->data;
+    /* DSCP are the upper 6 bit of the traffic class on the wire
+     * (RFC 3168, section 5) */
+    uint8_t dscp = ipv6_hdr_get_tc(hdr) >> 2;
+
+    if ((dscp == DSCP_CS6) || (dscp == DSCP_CS7)) {
+        return GNRC_NETIF_PKTQ_CLASS_CONTROL;
+    }
+    if ((dscp == DSCP_CS1) || (dscp == DSCP_LE)) {
+        return GNRC_NETIF_PKTQ_CLASS_BULK;
+    }
+    if ((hdr->nh == PROTNUM_ICMPV6) && (ipv6->next != NULL) &&
+        (ipv6->next->size > 0)) {
+        uint8_t type = *((uint8_t *)ipv6->next->data);
+
+        switch (type) {
+        case ICMPV6_RTR_SOL:
+        case ICMPV6_RTR_ADV:
+        case ICMPV6_NBR_SOL:
+        case ICMPV6_NBR_ADV:
+        case ICMPV6_REDIRECT:
+        case ICMPV6_RPL_CTRL:
+        case ICMPV6_DAR:
+        case ICMPV6_DAC:
+            return GNRC_NETIF_PKTQ_CLASS_CONTROL;
+        default:
+            break;
+        }
+    }
+    return GNRC_NETIF_PKTQ_CLASS_DEFAULT;
+}
+#endif
+
+gnrc_netif_pktq_class_t gnrc_netif_pktq_class(const gnrc_pktsnip_t *pkt)
+{
+    assert(pkt != NULL);
+
+    if (pkt->type != GNRC_NETTYPE_NETIF) {
+        return GNRC_NETIF_PKTQ_CLASS_DEFAULT;
+    }
+
+    int qclass = gnrc_netif_hdr_get_qclass(pkt->data);
+
+    if (qclass >= 0) {
+        return (gnrc_netif_pktq_class_t)qclass;
+    }
+#if IS_USED(MODULE_GNRC_NETTYPE_IPV6)
+    if ((pkt->next != NULL) && (pkt->next->type == GNRC_NETTYPE_IPV6) &&
+        (pkt->next->size >= sizeof(ipv6_hdr_t))) {
+        return _ipv6_class(pkt->next);
+    }
+#endif
+    return GNRC_NETIF_PKTQ_CLASS_DEFAULT;
+}
+
+gnrc_pktsnip_t *gnrc_netif_pktq_sched(gnrc_netif_t *netif)
+{
+    assert(netif != NULL);
+
+    gnrc_netif_pktq_t *q = &netif->send_queue;
+    gnrc_pktqueue_t *entry;
+    unsigned qclass;
+
+    if (q->queues[GNRC_NETIF_PKTQ_CLASS_CONTROL] != NULL) {
+        qclass = GNRC_NETIF_PKTQ_CLASS_CONTROL;
+    }
+    else {
+        unsigned idle = 0;
+
+        /* deficit round robin (Shreedhar and Varghese, 1996) over the other
+         * classes: every class gets its quantum once per round and may send
+         * as long as its deficit covers the head of its queue */
+        qclass = q->drr_class;
+        while (1) {
+            if ((qclass == GNRC_NETIF_PKTQ_CLASS_CONTROL) ||
+                (q->queues[qclass] == NULL)) {
+                /* idle classes do not save up credit */
+                q->deficit[qclass] = 0;
+                if (++idle >= GNRC_NETIF_PKTQ_CLASS_NUMOF) {
+                    /* start the next busy period with a fresh round */
+                    q->drr_class = GNRC_NETIF_PKTQ_CLASS_DEFAULT;
+                    q->drr_credited = false;
+                    return NULL;
+                }
+            }
+            else {
+                size_t len = gnrc_pkt_len(q->queues[qclass]->pkt);
+
+                idle = 0;
+                if (!q->drr_credited) {
+                    q->deficit[qclass] += _quantum[qclass];
+                    q->drr_credited = true;
+                }
+                if (len <= q->deficit[qclass]) {
+                    q->deficit[qclass] -= len;
+                    break;
+                }
+            }
+            qclass = (qclass + 1) % GNRC_NETIF_PKTQ_CLASS_NUMOF;
+            q->drr_credited = false;
+        }
+        q->drr_class = qclass;
+    }
+    entry = gnrc_pktqueue_remove_head(&q->queues[qclass]);
+    q->depth[qclass]--;
+    if ((qclass != GNRC_NETIF_PKTQ_CLASS_CONTROL) && (q->queues[qclass] == NULL)) {
+        q->deficit[qclass] = 0;
+    }
+
+    gnrc_pktsnip_t *pkt = entry->pkt;
+    entry->pkt = NULL;
+    return pkt;
+}
+#endif
+
 int gnrc_netif_pktq_put(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 {
     assert(netif != NULL);
     assert(pkt != NULL);
 
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_PRIO)
+    gnrc_netif_pktq_class_t qclass = gnrc_netif_pktq_class(pkt);
+
+    if (netif->send_queue.depth[qclass] >= _depth_max[qclass]) {
+        DEBUG("gnrc_netif_pktq: queue of class %u is full\n", qclass);
+        return -1;
+    }
+#endif
+
     gnrc_pktqueue_t *entry = _get_free_entry(pkt);
 
     if (entry == NULL) {
         return -1;
     }
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_PRIO)
+    gnrc_pktqueue_add(&netif->send_queue.queues[qclass], entry);
+    netif->send_queue.depth[qclass]++;
+#else
     gnrc_pktqueue_add(&netif->send_queue.queue, entry);
+#endif
     return 0;
 }
 
@@ -106,7 +266,18 @@ int gnrc_netif_pktq_push_back(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     if (entry == NULL) {
         return -1;
     }
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_PRIO)
+    gnrc_netif_pktq_class_t qclass = gnrc_netif_pktq_class(pkt);
+
+    LL_PREPEND(netif->send_queue.queues[qclass], entry);
+    netif->send_queue.depth[qclass]++;
+    if (qclass != GNRC_NETIF_PKTQ_CLASS_CONTROL) {
+        /* the packet was not sent, so give its share back */
+        netif->send_queue.deficit[qclass] += gnrc_pkt_len(pkt);
+    }
+#else
     LL_PREPEND(netif->send_queue.queue, entry);
+#endif
     return 0;
 }
 
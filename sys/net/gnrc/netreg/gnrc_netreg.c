@@ -31,9 +31,48 @@
 
 #define _INVALID_TYPE(type) (((type) < GNRC_NETTYPE_UNDEF) || ((type) >= GNRC_NETTYPE_NUMOF))
 
+#if IS_USED(MODULE_GNRC_NETREG_HASHED)
+#define _BUCKETS_NUMOF      (1U << CONFIG_GNRC_NETREG_HASH_BUCKETS_EXP)
+
+/* The registry as hash table by gnrc_nettype_t and demux context */
+static gnrc_netreg_entry_t *netreg[_BUCKETS_NUMOF];
+
+static inline gnrc_netreg_entry_t **_head(gnrc_nettype_t type,
+                                          uint32_t demux_ctx)
+{
+    /* Fibonacci hashing: the upper bits of the product depend on all bits of
+     * the key, so consecutive ports spread over all buckets */
+    uint32_t key = demux_ctx ^ ((uint32_t)type << 24);
+    uint32_t hash = (key * UINT32_C(2654435769)) >>
+                    (32 - CONFIG_GNRC_NETREG_HASH_BUCKETS_EXP);
+
+    return &netreg[hash];
+}
+
+static inline bool _matches(const gnrc_netreg_entry_t *entry,
+                            gnrc_nettype_t type, uint32_t demux_ctx)
+{
+    return (entry->demux_ctx == demux_ctx) && (entry->nettype == type);
+}
+#else
 /* The registry as lookup table by gnrc_nettype_t */
 static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF];
 
+static inline gnrc_netreg_entry_t **_head(gnrc_nettype_t type,
+                                          uint32_t demux_ctx)
+{
+    (void)demux_ctx;
+    return &netreg[type];
+}
+
+static inline bool _matches(const gnrc_netreg_entry_t *entry,
+                            gnrc_nettype_t type, uint32_t demux_ctx)
+{
+    (void)type;
+    return entry->demux_ctx == demux_ctx;
+}
+#endif
+
 /** Held while accessing _lock_counter, and also while the exclusive lock is held */
 static mutex_t _lock_for_counter = MUTEX_INIT;
 /** Number of shared locks on netreg. Saturating arithmetic is used; if this
@@ -63,7 +102,7 @@ static mutex_t _lock_wait_exclusive = MUTEX_INIT;
 void gnrc_netreg_init(void)
 {
     /* set all pointers in registry to NULL */
-    memset(netreg, 0, GNRC_NETTYPE_NUMOF * sizeof(gnrc_netreg_entry_t *));
+    memset(netreg, 0, sizeof(netreg));
 }
 
 void gnrc_netreg_acquire_shared(void) {
@@ -151,15 +190,20 @@ int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return -EINVAL;
     }
 
+#if IS_USED(MODULE_GNRC_NETREG_HASHED)
+    entry->nettype = type;
+#endif
+    gnrc_netreg_entry_t **head = _head(type, entry->demux_ctx);
+
     _gnrc_netreg_acquire_exclusive();
 
     /* don't add the same entry twice */
     gnrc_netreg_entry_t *e;
-    LL_FOREACH(netreg[type], e) {
+    LL_FOREACH(*head, e) {
         assert(entry != e);
     }
 
-    LL_PREPEND(netreg[type], entry);
+    LL_PREPEND(*head, entry);
     _gnrc_netreg_release_exclusive();
 
     return 0;
@@ -171,8 +215,17 @@ void gnrc_netreg_unregister(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return;
     }
 
+    gnrc_netreg_entry_t **pos = _head(type, entry->demux_ctx);
+
     _gnrc_netreg_acquire_exclusive();
-    LL_DELETE(netreg[type], entry);
+    /* entries that were never registered (e.g. of a socket that was never
+     * bound) may be unregistered, so an empty list is fine, too */
+    while (*pos && (*pos != entry)) {
+        pos = &(*pos)->next;
+    }
+    if (*pos) {
+        *pos = entry->next;
+    }
     /* We can release now already: No new references to this entry can be made
      * any more, and the caller is only allowed to reuse the entry and the mbox
      * target referenced by it after *this* function returned, not when the
@@ -214,8 +267,10 @@ static gnrc_netreg_entry_t *_netreg_lookup(gnrc_netreg_entry_t *from,
     gnrc_netreg_entry_t *res = NULL;
 
     if (from || !_INVALID_TYPE(type)) {
-        gnrc_netreg_entry_t *head = (from) ? from->next : netreg[type];
-        LL_SEARCH_SCALAR(head, res, demux_ctx, demux_ctx);
+        res = (from) ? from->next : *_head(type, demux_ctx);
+        while (res && !_matches(res, type, demux_ctx)) {
+            res = res->next;
+        }
     }
 
     return res;
@@ -244,7 +299,14 @@ int gnrc_netreg_num(gnrc_nettype_t type, uint32_t demux_ctx)
 
 gnrc_netreg_entry_t *gnrc_netreg_getnext(gnrc_netreg_entry_t *entry)
 {
-    return (entry ? _netreg_lookup(entry, 0, entry->demux_ctx) : NULL);
+    if (entry == NULL) {
+        return NULL;
+    }
+#if IS_USED(MODULE_GNRC_NETREG_HASHED)
+    return _netreg_lookup(entry, entry->nettype, entry->demux_ctx);
+#else
+    return _netreg_lookup(entry, 0, entry->demux_ctx);
+#endif
 }
 
 int gnrc_netreg_calc_csum(gnrc_pktsnip_t *hdr, gnrc_pktsnip_t *pseudo_hdr)
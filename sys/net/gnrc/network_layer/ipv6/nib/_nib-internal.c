@@ -39,12 +39,28 @@ _nib_dr_entry_t *_prime_def_router = NULL;
 static clist_node_t _next_removable = { NULL };
 
 static _nib_onl_entry_t _nodes[CONFIG_GNRC_IPV6_NIB_NUMOF];
+#if IS_USED(MODULE_GNRC_IPV6_NIB_NC_HASHED)
+#define _NODES_IDX_NUMOF    (1U << CONFIG_GNRC_IPV6_NIB_NC_HASH_BUCKETS_EXP)
+/* index over _nodes by IPv6 address, chained via _nib_onl_entry_t::idx_next */
+static _nib_onl_entry_t *_nodes_idx[_NODES_IDX_NUMOF];
+#endif  /* MODULE_GNRC_IPV6_NIB_NC_HASHED */
 static _nib_offl_entry_t _dsts[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
 static _nib_dr_entry_t _def_routers[CONFIG_GNRC_IPV6_NIB_DEFAULT_ROUTER_NUMOF];
 
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
 static _nib_abr_entry_t _abrs[CONFIG_GNRC_IPV6_NIB_ABR_NUMOF];
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
+#if IS_USED(MODULE_GNRC_IPV6_NIB_ROUTE_CACHE)
+typedef struct {
+    ipv6_addr_t dst;            /* destination of the cached lookup */
+    _nib_offl_entry_t *offl;    /* best match for dst, may be NULL */
+    uint32_t hash;              /* to skip most non-matching entries fast */
+    bool valid;
+} _route_cache_entry_t;
+
+static _route_cache_entry_t _route_cache[CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_SIZE];
+static gnrc_ipv6_nib_ft_cache_stats_t _route_cache_stats;
+#endif  /* MODULE_GNRC_IPV6_NIB_ROUTE_CACHE */
 static rmutex_t _nib_mutex = RMUTEX_INIT;
 
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
@@ -54,6 +70,7 @@ evtimer_msg_t _nib_evtimer;
 static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node);
 static inline bool _node_unreachable(_nib_onl_entry_t *node);
+static inline void _route_cache_flush(void);
 
 void _nib_init(void)
 {
@@ -61,13 +78,23 @@ void _nib_init(void)
     _prime_def_router = NULL;
     _next_removable.next = NULL;
     memset(_nodes, 0, sizeof(_nodes));
+#if IS_USED(MODULE_GNRC_IPV6_NIB_NC_HASHED)
+    memset(_nodes_idx, 0, sizeof(_nodes_idx));
+#endif  /* MODULE_GNRC_IPV6_NIB_NC_HASHED */
     memset(_def_routers, 0, sizeof(_def_routers));
     memset(_dsts, 0, sizeof(_dsts));
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
+    _route_cache_flush();
+#if IS_USED(MODULE_GNRC_IPV6_NIB_ROUTE_CACHE)
+    memset(&_route_cache_stats, 0, sizeof(_route_cache_stats));
+#endif  /* MODULE_GNRC_IPV6_NIB_ROUTE_CACHE */
 #endif  /* TEST_SUITES */
     evtimer_init_msg(&_nib_evtimer);
+#if IS_USED(MODULE_ZTIMER_SLACK)
+    evtimer_set_slack(&_nib_evtimer, CONFIG_GNRC_IPV6_NIB_TIMER_SLACK_MS);
+#endif
     /* TODO: load ABR information from persistent memory */
 }
 
@@ -91,6 +118,44 @@ static inline bool _addr_equals(const ipv6_addr_t *addr,
     }
 }
 
+#if IS_USED(MODULE_GNRC_IPV6_NIB_NC_HASHED)
+/* The index is keyed by the address only: _nib_onl_get() also accepts
+ * entries on any interface, so the interface is compared within a bucket */
+static inline _nib_onl_entry_t **_nib_onl_idx_bucket(const ipv6_addr_t *addr)
+{
+    uint32_t key = addr->u32[0].u32 ^ addr->u32[1].u32 ^
+                   addr->u32[2].u32 ^ addr->u32[3].u32;
+
+    return &_nodes_idx[(key * 2654435769U) >>
+                       (32U - CONFIG_GNRC_IPV6_NIB_NC_HASH_BUCKETS_EXP)];
+}
+
+static inline void _nib_onl_idx_add(_nib_onl_entry_t *node)
+{
+    _nib_onl_entry_t **bucket = _nib_onl_idx_bucket(&node->ipv6);
+
+    node->idx_next = *bucket;
+    *bucket = node;
+}
+
+void _nib_onl_idx_remove(_nib_onl_entry_t *node)
+{
+    for (_nib_onl_entry_t **ptr = _nib_onl_idx_bucket(&node->ipv6); *ptr;
+         ptr = &(*ptr)->idx_next) {
+        if (*ptr == node) {
+            *ptr = node->idx_next;
+            node->idx_next = NULL;
+            return;
+        }
+    }
+}
+#else   /* MODULE_GNRC_IPV6_NIB_NC_HASHED */
+static inline void _nib_onl_idx_add(_nib_onl_entry_t *node)
+{
+    (void)node;
+}
+#endif  /* MODULE_GNRC_IPV6_NIB_NC_HASHED */
+
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
 {
     _nib_onl_entry_t *node = NULL;
@@ -98,6 +163,28 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
     DEBUG("nib: Allocating on-link node entry (addr = %s, iface = %u)\n",
           (addr == NULL) ? "NULL" : ipv6_addr_to_str(addr_str, addr,
                                                      sizeof(addr_str)), iface);
+#if IS_USED(MODULE_GNRC_IPV6_NIB_NC_HASHED)
+    _nib_onl_entry_t *tmp = *_nib_onl_idx_bucket((addr) ? addr
+                                                        : &ipv6_addr_unspecified);
+
+    for (; tmp != NULL; tmp = tmp->idx_next) {
+        /* take the first match in _nodes, as the linear search does */
+        if ((_nib_onl_get_if(tmp) == iface) && _addr_equals(addr, tmp) &&
+            ((node == NULL) || (tmp < node))) {
+            node = tmp;
+        }
+    }
+    if (node != NULL) {
+        DEBUG("  %p is an exact match\n", (void *)node);
+    }
+    /* entries not in the index are empty */
+    for (unsigned i = 0; (node == NULL) && (i < CONFIG_GNRC_IPV6_NIB_NUMOF); i++) {
+        if (_nodes[i].mode == _EMPTY) {
+            node = &_nodes[i];
+            DEBUG("  using %p\n", (void *)node);
+        }
+    }
+#else   /* MODULE_GNRC_IPV6_NIB_NC_HASHED */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *tmp = &_nodes[i];
 
@@ -112,6 +199,7 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
             node = tmp;
         }
     }
+#endif  /* MODULE_GNRC_IPV6_NIB_NC_HASHED */
     if (node != NULL) {
         _override_node(addr, iface, node);
     }
@@ -223,6 +311,25 @@ _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
     assert(addr != NULL);
     DEBUG("nib: Getting on-link node entry (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
+#if IS_USED(MODULE_GNRC_IPV6_NIB_NC_HASHED)
+    _nib_onl_entry_t *res = NULL;
+
+    for (_nib_onl_entry_t *node = *_nib_onl_idx_bucket(addr); node != NULL;
+         node = node->idx_next) {
+        /* take the first match in _nodes, as the linear search does */
+        if ((node->mode != _EMPTY) &&
+            ((_nib_onl_get_if(node) == 0) || (iface == 0) ||
+             (_nib_onl_get_if(node) == iface)) &&
+            ipv6_addr_equal(&node->ipv6, addr) &&
+            ((res == NULL) || (node < res))) {
+            res = node;
+        }
+    }
+    if (res != NULL) {
+        DEBUG("  Found %p\n", (void *)res);
+        return res;
+    }
+#else   /* MODULE_GNRC_IPV6_NIB_NC_HASHED */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *node = &_nodes[i];
 
@@ -236,6 +343,7 @@ _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
             return node;
         }
     }
+#endif  /* MODULE_GNRC_IPV6_NIB_NC_HASHED */
     DEBUG("  No suitable entry found\n");
     return NULL;
 }
@@ -510,7 +618,9 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
                 DEBUG("  %p is an exact match\n", (void *)tmp);
                 if (next_hop != NULL) {
                     /* sets next_hop if it was previously unspecified */
+                    _nib_onl_idx_remove(tmp_node);
                     memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
+                    _nib_onl_idx_add(tmp_node);
                 }
                 /*mark that this NCE is used by an offl_entry*/
                 tmp->next_hop->mode |= _DST;
@@ -528,6 +638,8 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         dst->next_hop->mode |= _DST;
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+        /* the new entry may be a better match for cached destinations */
+        _route_cache_flush();
     }
     return dst;
 }
@@ -567,6 +679,7 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
             }
         }
         memset(dst, 0, sizeof(_nib_offl_entry_t));
+        _route_cache_flush();
     }
     else {
         DEBUG("nib: offlink entry %s/%u with mode %u not cleared\n",
@@ -623,6 +736,55 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
     return res;
 }
 
+#if IS_USED(MODULE_GNRC_IPV6_NIB_ROUTE_CACHE)
+static inline void _route_cache_flush(void)
+{
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_SIZE; i++) {
+        _route_cache[i].valid = false;
+    }
+}
+
+static _nib_offl_entry_t *_route_cache_get_match(const ipv6_addr_t *dst)
+{
+    static unsigned next;
+    /* the interface identifier differs most between destinations */
+    uint32_t hash = dst->u32[2].u32 ^ dst->u32[3].u32;
+    _route_cache_entry_t *entry;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_SIZE; i++) {
+        entry = &_route_cache[i];
+        if (entry->valid && (entry->hash == hash) &&
+            ipv6_addr_equal(&entry->dst, dst)) {
+            _route_cache_stats.hits++;
+            return entry->offl;
+        }
+    }
+    _route_cache_stats.misses++;
+    /* replace entries round-robin */
+    entry = &_route_cache[next];
+    next = (next + 1) % CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_SIZE;
+    entry->offl = _nib_offl_get_match(dst);
+    entry->dst = *dst;
+    entry->hash = hash;
+    entry->valid = true;
+    return entry->offl;
+}
+
+void _nib_route_cache_get_stats(gnrc_ipv6_nib_ft_cache_stats_t *stats)
+{
+    *stats = _route_cache_stats;
+}
+#else   /* MODULE_GNRC_IPV6_NIB_ROUTE_CACHE */
+static inline void _route_cache_flush(void)
+{
+}
+
+static inline _nib_offl_entry_t *_route_cache_get_match(const ipv6_addr_t *dst)
+{
+    return _nib_offl_get_match(dst);
+}
+#endif  /* MODULE_GNRC_IPV6_NIB_ROUTE_CACHE */
+
 void _nib_ft_get(const _nib_offl_entry_t *dst, gnrc_ipv6_nib_ft_t *fte)
 {
     assert((dst != NULL) && (dst->next_hop != NULL) && (fte != NULL));
@@ -645,7 +807,7 @@ int _nib_get_route(const ipv6_addr_t *dst, gnrc_pktsnip_t *pkt,
     DEBUG("nib: get route %s for packet %p\n",
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)),
           (void *)pkt);
-    _nib_offl_entry_t *offl = _nib_offl_get_match(dst);
+    _nib_offl_entry_t *offl = _route_cache_get_match(dst);
 
     if ((offl == NULL) ||
         /* give default route precedence over off-link PLEs */
@@ -879,10 +1041,12 @@ static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node)
 {
     _nib_onl_clear(node);
+    _nib_onl_idx_remove(node);
     if (addr != NULL) {
         memcpy(&node->ipv6, addr, sizeof(node->ipv6));
     }
     _nib_onl_set_if(node, iface);
+    _nib_onl_idx_add(node);
 }
 
 static inline bool _node_unreachable(_nib_onl_entry_t *node)
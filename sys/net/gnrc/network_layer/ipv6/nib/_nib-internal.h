@@ -93,6 +93,14 @@ extern "C" {
  */
 typedef struct _nib_onl_entry {
     struct _nib_onl_entry *next;        /**< next removable entry */
+#if IS_USED(MODULE_GNRC_IPV6_NIB_NC_HASHED) || defined(DOXYGEN)
+    /**
+     * @brief   next entry in the same bucket of the address index
+     *
+     * @note    Only available with module `gnrc_ipv6_nib_nc_hashed`.
+     */
+    struct _nib_onl_entry *idx_next;
+#endif
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_QUEUE_PKT) || defined(DOXYGEN)
     /**
      * @brief   queue for packets currently in address resolution
@@ -359,6 +367,24 @@ static inline void _nib_onl_set_if(_nib_onl_entry_t *node, unsigned iface)
  */
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 
+#if IS_USED(MODULE_GNRC_IPV6_NIB_NC_HASHED) || DOXYGEN
+/**
+ * @brief   Removes an on-link entry from the address index
+ *
+ * Must be called before _nib_onl_entry_t::ipv6 of an entry is changed.
+ *
+ * @note    Only available with module `gnrc_ipv6_nib_nc_hashed`.
+ *
+ * @param[in,out] node  An entry. May not be in the index.
+ */
+void _nib_onl_idx_remove(_nib_onl_entry_t *node);
+#else   /* MODULE_GNRC_IPV6_NIB_NC_HASHED */
+static inline void _nib_onl_idx_remove(_nib_onl_entry_t *node)
+{
+    (void)node;
+}
+#endif  /* MODULE_GNRC_IPV6_NIB_NC_HASHED */
+
 /**
  * @brief   Clears out a NIB entry (on-link version)
  *
@@ -370,6 +396,7 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 static inline bool _nib_onl_clear(_nib_onl_entry_t *node)
 {
     if (node->mode == _EMPTY) {
+        _nib_onl_idx_remove(node);
         memset(node, 0, sizeof(_nib_onl_entry_t));
         return true;
     }
@@ -875,6 +902,17 @@ void _nib_ft_get(const _nib_offl_entry_t *dst, gnrc_ipv6_nib_ft_t *fte);
 int _nib_get_route(const ipv6_addr_t *dst, gnrc_pktsnip_t *pkt,
                    gnrc_ipv6_nib_ft_t *fte);
 
+#if IS_USED(MODULE_GNRC_IPV6_NIB_ROUTE_CACHE) || DOXYGEN
+/**
+ * @brief   Gets the hit and miss counters of the route lookup cache
+ *
+ * @note    Only available with module `gnrc_ipv6_nib_route_cache`.
+ *
+ * @param[out] stats    The counters of the route lookup cache.
+ */
+void _nib_route_cache_get_stats(gnrc_ipv6_nib_ft_cache_stats_t *stats);
+#endif  /* MODULE_GNRC_IPV6_NIB_ROUTE_CACHE */
+
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_QUEUE_PKT) || DOXYGEN
 /**
  * @brief Flush the packet queue of a on-link neighbor.
@@ -187,4 +187,14 @@ void gnrc_ipv6_nib_ft_print(const gnrc_ipv6_nib_ft_t *fte)
     printf("dev #%u\n", fte->iface);
 }
 
+#if IS_USED(MODULE_GNRC_IPV6_NIB_ROUTE_CACHE)
+void gnrc_ipv6_nib_ft_cache_stats(gnrc_ipv6_nib_ft_cache_stats_t *stats)
+{
+    assert(stats != NULL);
+    _nib_acquire();
+    _nib_route_cache_get_stats(stats);
+    _nib_release();
+}
+#endif  /* MODULE_GNRC_IPV6_NIB_ROUTE_CACHE */
+
 /** @} */
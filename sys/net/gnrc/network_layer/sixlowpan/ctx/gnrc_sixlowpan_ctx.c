@@ -30,6 +30,11 @@
 static gnrc_sixlowpan_ctx_t _ctxs[GNRC_SIXLOWPAN_CTX_SIZE];
 static uint32_t _ctx_inval_times[GNRC_SIXLOWPAN_CTX_SIZE];
 static mutex_t _ctx_mutex = MUTEX_INIT;
+/* IDs of the contexts in use, ordered by descending prefix length (and
+ * ascending ID for equal prefix lengths), so the first match for an address is
+ * the best one. Only rebuilt when a context is updated. */
+static uint8_t _ctx_idx[GNRC_SIXLOWPAN_CTX_SIZE];
+static uint8_t _ctx_idx_numof;
 
 static uint32_t _current_minute(void);
 static void _update_lifetime(uint8_t id);
@@ -42,21 +47,46 @@ static inline bool _valid(uint8_t id)
     return (_ctxs[id].prefix_len > 0);
 }
 
+static void _idx_rebuild(void)
+{
+    _ctx_idx_numof = 0;
+    for (uint8_t id = 0; id < GNRC_SIXLOWPAN_CTX_SIZE; id++) {
+        unsigned pos;
+
+        if (_ctxs[id].prefix_len == 0) {
+            continue;
+        }
+        /* insertion sort, there are at most 16 entries */
+        for (pos = _ctx_idx_numof; pos > 0; pos--) {
+            if (_ctxs[_ctx_idx[pos - 1]].prefix_len >= _ctxs[id].prefix_len) {
+                break;
+            }
+            _ctx_idx[pos] = _ctx_idx[pos - 1];
+        }
+        _ctx_idx[pos] = id;
+        _ctx_idx_numof++;
+    }
+}
+
 gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_lookup_addr(const ipv6_addr_t *addr)
 {
-    uint8_t best = 0;
     gnrc_sixlowpan_ctx_t *res = NULL;
 
     mutex_lock(&_ctx_mutex);
 
-    for (unsigned int id = 0; id < GNRC_SIXLOWPAN_CTX_SIZE; id++) {
-        if (_valid(id)) {
-            uint8_t match = ipv6_addr_match_prefix(&_ctxs[id].prefix, addr);
-
-            if ((_ctxs[id].prefix_len <= match) && (match > best)) {
-                best = match;
-                res = &(_ctxs[id]);
-            }
+    for (unsigned i = 0; i < _ctx_idx_numof; i++) {
+        uint8_t id = _ctx_idx[i];
+
+        /* gnrc_sixlowpan_ctx_remove() clears prefix_len without
+         * rebuilding the index */
+        if ((_ctxs[id].prefix_len > 0) &&
+            (ipv6_addr_match_prefix(&_ctxs[id].prefix, addr) >=
+             _ctxs[id].prefix_len)) {
+            /* lifetime only affects the compression flag, so only the
+             * result needs to be brought up-to-date */
+            _update_lifetime(id);
+            res = &(_ctxs[id]);
+            break;
         }
     }
 
@@ -129,6 +159,7 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
           id, ipv6_addr_to_str(ipv6str, &_ctxs[id].prefix, sizeof(ipv6str)),
           _ctxs[id].prefix_len, _ctxs[id].ltime);
     _ctx_inval_times[id] = ltime + _current_minute();
+    _idx_rebuild();
 
     mutex_unlock(&_ctx_mutex);
     return &(_ctxs[id]);
@@ -170,6 +201,7 @@ static void _update_lifetime(uint8_t id)
 void gnrc_sixlowpan_ctx_reset(void)
 {
     memset(_ctxs, 0, sizeof(_ctxs));
+    _ctx_idx_numof = 0;
 }
 #endif
 
@@ -43,6 +43,30 @@ static inline bool _is_last_frag(const gnrc_sixlowpan_frag_vrb_t *vrbe)
     return (vrbe->super.current_size >= vrbe->super.datagram_size);
 }
 
+static int _send(gnrc_pktsnip_t *pkt, gnrc_sixlowpan_frag_vrb_t *vrbe,
+                 unsigned page)
+{
+    gnrc_pktsnip_t *netif = _netif_hdr_from_vrbe(vrbe);
+
+    if (netif == NULL) {
+        gnrc_pktbuf_release(pkt);
+        return -ENOMEM;
+    }
+    if (_is_last_frag(vrbe)) {
+        DEBUG("6lo minfwd: current_size (%u) >= datagram_size (%u)\n",
+              vrbe->super.current_size, vrbe->super.datagram_size);
+        gnrc_sixlowpan_frag_vrb_rm(vrbe);
+    }
+    else {
+        gnrc_netif_hdr_t *netif_hdr = netif->data;
+
+        netif_hdr->flags |= GNRC_NETIF_HDR_FLAGS_MORE_DATA;
+    }
+    pkt = gnrc_pkt_prepend(pkt, netif);
+    gnrc_sixlowpan_dispatch_send(pkt, NULL, page);
+    return 0;
+}
+
 int gnrc_sixlowpan_frag_minfwd_forward(gnrc_pktsnip_t *pkt,
                                        const sixlowpan_frag_n_t *frag,
                                        gnrc_sixlowpan_frag_vrb_t *vrbe,
@@ -66,24 +90,30 @@ int gnrc_sixlowpan_frag_minfwd_forward(gnrc_pktsnip_t *pkt,
     pkt = tmp;
     new = pkt->data;
     new->tag = byteorder_htons(vrbe->out_tag);
-    tmp = _netif_hdr_from_vrbe(vrbe);
-    if (tmp == NULL) {
+    return _send(pkt, vrbe, page);
+}
+
+int gnrc_sixlowpan_frag_minfwd_forward_inplace(gnrc_pktsnip_t *pkt,
+                                               gnrc_sixlowpan_frag_vrb_t *vrbe,
+                                               unsigned page)
+{
+    gnrc_pktsnip_t *tmp;
+    sixlowpan_frag_t *frag;
+
+    assert(vrbe != NULL);
+    assert(pkt != NULL);
+    assert(pkt->size >= sizeof(sixlowpan_frag_t));
+    assert(sixlowpan_frag_is(pkt->data));
+    /* only duplicates pkt if someone else still holds it */
+    if ((tmp = gnrc_pktbuf_start_write(pkt)) == NULL) {
+        DEBUG("6lo minfwd: unable to get write access to fragment.\n");
         gnrc_pktbuf_release(pkt);
         return -ENOMEM;
     }
-    if (_is_last_frag(vrbe)) {
-        DEBUG("6lo minfwd: current_size (%u) >= datagram_size (%u)\n",
-              vrbe->super.current_size, vrbe->super.datagram_size);
-        gnrc_sixlowpan_frag_vrb_rm(vrbe);
-    }
-    else {
-        gnrc_netif_hdr_t *netif_hdr = tmp->data;
-
-        netif_hdr->flags |= GNRC_NETIF_HDR_FLAGS_MORE_DATA;
-    }
-    pkt = gnrc_pkt_prepend(pkt, tmp);
-    gnrc_sixlowpan_dispatch_send(pkt, NULL, page);
-    return 0;
+    pkt = tmp;
+    frag = pkt->data;
+    frag->tag = byteorder_htons(vrbe->out_tag);
+    return _send(pkt, vrbe, page);
 }
 
 int gnrc_sixlowpan_frag_minfwd_frag_iphc(gnrc_pktsnip_t *pkt,
@@ -17,6 +17,7 @@
 #include <inttypes.h>
 #include <stdbool.h>
 
+#include "container.h"
 #include "net/ieee802154.h"
 #include "net/ipv6.h"
 #include "net/ipv6/hdr.h"
@@ -60,9 +61,19 @@
 #endif
 
 static gnrc_sixlowpan_frag_rb_int_t rbuf_int[RBUF_INT_SIZE];
+/* where to start searching for a free interval, so that the search does not
+ * pass all intervals in use each time */
+static unsigned _rbuf_int_next;
 
 static gnrc_sixlowpan_frag_rb_t rbuf[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASHED)
+#define RBUF_IDX_BUCKETS    (1U << CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_BUCKETS_EXP)
+
+/* index of the entries in use, by (source, destination, tag) */
+static gnrc_sixlowpan_frag_rb_t *_rbuf_idx[RBUF_IDX_BUCKETS];
+#endif
+
 static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
 
 static xtimer_t _gc_timer;
@@ -102,19 +113,170 @@ enum {
 
 static bool _check_hdr(gnrc_pktsnip_t *hdr, unsigned page);
 static void _adapt_hdr(gnrc_pktsnip_t *hdr, unsigned page);
-static int _forward_frag(gnrc_pktsnip_t *pkt, size_t frag_hdr_size,
-                         gnrc_sixlowpan_frag_vrb_t *vrbe, unsigned page);
+static int _forward_frag(gnrc_pktsnip_t *pkt, gnrc_sixlowpan_frag_vrb_t *vrbe,
+                         unsigned page);
 static int _forward_uncomp(gnrc_pktsnip_t *pkt,
                            gnrc_sixlowpan_frag_rb_t *rbuf,
                            gnrc_sixlowpan_frag_vrb_t *vrbe,
                            unsigned page);
 static int _rbuf_resize_for_reassembly(gnrc_sixlowpan_frag_rb_t *rbuf);
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASHED)
+static gnrc_sixlowpan_frag_rb_t **_rbuf_idx_bucket(const uint8_t *src,
+                                                   size_t src_len,
+                                                   const uint8_t *dst,
+                                                   size_t dst_len,
+                                                   uint16_t tag)
+{
+    /* FNV-1a over the addresses, seeded with the tag */
+    uint32_t hash = 2166136261U ^ tag;
+
+    for (unsigned i = 0; i < src_len; i++) {
+        hash = (hash ^ src[i]) * 16777619U;
+    }
+    for (unsigned i = 0; i < dst_len; i++) {
+        hash = (hash ^ dst[i]) * 16777619U;
+    }
+    hash ^= hash >> 16;
+    return &_rbuf_idx[hash & (RBUF_IDX_BUCKETS - 1)];
+}
+
+static void _rbuf_idx_add(gnrc_sixlowpan_frag_rb_t *e)
+{
+    gnrc_sixlowpan_frag_rb_t **bucket = _rbuf_idx_bucket(e->super.src,
+                                                         e->super.src_len,
+                                                         e->super.dst,
+                                                         e->super.dst_len,
+                                                         e->super.tag);
+
+    e->idx_next = *bucket;
+    *bucket = e;
+}
+
+static void _rbuf_idx_remove(gnrc_sixlowpan_frag_rb_t *e)
+{
+    gnrc_sixlowpan_frag_rb_t **ptr = _rbuf_idx_bucket(e->super.src,
+                                                      e->super.src_len,
+                                                      e->super.dst,
+                                                      e->super.dst_len,
+                                                      e->super.tag);
+
+    /* entries that were never completely set up are not in the index */
+    for (; *ptr != NULL; ptr = &(*ptr)->idx_next) {
+        if (*ptr == e) {
+            *ptr = e->idx_next;
+            e->idx_next = NULL;
+            return;
+        }
+    }
+}
+#else
+static inline void _rbuf_idx_add(gnrc_sixlowpan_frag_rb_t *e)
+{
+    (void)e;
+}
+
+static inline void _rbuf_idx_remove(gnrc_sixlowpan_frag_rb_t *e)
+{
+    (void)e;
+}
+#endif
+
+static inline bool _rbuf_match(const gnrc_sixlowpan_frag_rb_t *e,
+                               const void *src, size_t src_len,
+                               const void *dst, size_t dst_len,
+                               uint16_t tag)
+{
+    return (e->pkt != NULL) && (e->super.tag == tag) &&
+           (e->super.src_len == src_len) &&
+           (e->super.dst_len == dst_len) &&
+           (memcmp(e->super.src, src, src_len) == 0) &&
+           (memcmp(e->super.dst, dst, dst_len) == 0);
+}
+
+static inline bool _rbuf_match_size(const gnrc_sixlowpan_frag_rb_t *e,
+                                    size_t size)
+{
+    if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR)) {
+        /* not all SFR fragments carry the datagram size, so make 0 a legal
+         * value to not compare datagram size */
+        return (size == 0) || (e->super.datagram_size == size);
+    }
+    return e->super.datagram_size == size;
+}
+
+/* finds the entry for a datagram, with `size == SIZE_MAX` matching any
+ * datagram size */
+static gnrc_sixlowpan_frag_rb_t *_rbuf_find(const void *src, size_t src_len,
+                                            const void *dst, size_t dst_len,
+                                            size_t size, uint16_t tag)
+{
+    gnrc_sixlowpan_frag_rb_t *res = NULL;
+
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASHED)
+    gnrc_sixlowpan_frag_rb_t *e = *_rbuf_idx_bucket(src, src_len, dst, dst_len,
+                                                    tag);
+
+    /* pick the first match in the array, as the linear search would */
+    for (; e != NULL; e = e->idx_next) {
+        if (((res == NULL) || (e < res)) &&
+            _rbuf_match(e, src, src_len, dst, dst_len, tag) &&
+            ((size == SIZE_MAX) || _rbuf_match_size(e, size))) {
+            res = e;
+        }
+    }
+#else
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        gnrc_sixlowpan_frag_rb_t *e = &rbuf[i];
+
+        if (_rbuf_match(e, src, src_len, dst, dst_len, tag) &&
+            ((size == SIZE_MAX) || _rbuf_match_size(e, size))) {
+            res = e;
+            break;
+        }
+    }
+#endif
+    return res;
+}
+
+/* true if any byte from offset to end may have been received already */
+static bool _rbuf_covered_any(const gnrc_sixlowpan_frag_rb_base_t *entry,
+                               size_t offset, size_t end)
+{
+    if ((end / GNRC_SIXLOWPAN_FRAG_RB_COVERED_UNIT) >=
+        GNRC_SIXLOWPAN_FRAG_RB_COVERED_NUMOF) {
+        /* datagram larger than tracked: the intervals have to tell */
+        return entry->ints != NULL;
+    }
+    for (size_t i = offset / GNRC_SIXLOWPAN_FRAG_RB_COVERED_UNIT;
+         i <= end / GNRC_SIXLOWPAN_FRAG_RB_COVERED_UNIT; i++) {
+        if (bf_isset(entry->covered, i)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void _rbuf_covered_mark(gnrc_sixlowpan_frag_rb_base_t *entry,
+                                size_t offset, size_t end)
+{
+    for (size_t i = offset / GNRC_SIXLOWPAN_FRAG_RB_COVERED_UNIT;
+         (i <= end / GNRC_SIXLOWPAN_FRAG_RB_COVERED_UNIT) &&
+         (i < GNRC_SIXLOWPAN_FRAG_RB_COVERED_NUMOF); i++) {
+        bf_set(entry->covered, i);
+    }
+}
+
 static int _check_fragments(gnrc_sixlowpan_frag_rb_base_t *entry,
                             size_t frag_size, size_t offset)
 {
     gnrc_sixlowpan_frag_rb_int_t *ptr = entry->ints;
 
+    /* a fragment that covers no byte received before neither overlaps nor
+     * duplicates one, which is the case for most fragments */
+    if (!_rbuf_covered_any(entry, offset, offset + frag_size - 1)) {
+        return RBUF_ADD_SUCCESS;
+    }
     /* If the fragment overlaps another fragment and differs in either the size
      * or the offset of the overlapped fragment, discards the datagram
      * https://tools.ietf.org/html/rfc4944#section-5.3 */
@@ -186,21 +348,9 @@ static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_
     assert(netif_hdr != NULL);
     const uint8_t *src = gnrc_netif_hdr_get_src_addr(netif_hdr);
     const uint8_t *dst = gnrc_netif_hdr_get_dst_addr(netif_hdr);
-    const uint8_t src_len = netif_hdr->src_l2addr_len;
-    const uint8_t dst_len = netif_hdr->dst_l2addr_len;
 
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        gnrc_sixlowpan_frag_rb_t *e = &rbuf[i];
-
-        if ((e->pkt != NULL) && (e->super.tag == tag) &&
-            (e->super.src_len == src_len) &&
-            (e->super.dst_len == dst_len) &&
-            (memcmp(e->super.src, src, src_len) == 0) &&
-            (memcmp(e->super.dst, dst, dst_len) == 0)) {
-            return e;
-        }
-    }
-    return NULL;
+    return _rbuf_find(src, netif_hdr->src_l2addr_len,
+                      dst, netif_hdr->dst_l2addr_len, SIZE_MAX, tag);
 }
 
 #ifndef NDEBUG
@@ -365,8 +515,7 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
         if (_rbuf_update_ints(entry.super, offset, frag_size)) {
             DEBUG("6lo rbuf minfwd: trying to forward fragment\n");
             entry.super->current_size += (uint16_t)frag_size;
-            if (_forward_frag(pkt, sizeof(sixlowpan_frag_n_t), entry.vrb,
-                              page) < 0) {
+            if (_forward_frag(pkt, entry.vrb, page) < 0) {
                 DEBUG("6lo rbuf minfwd: unable to forward fragment\n");
                 return RBUF_ADD_ERROR;
             }
@@ -514,10 +663,17 @@ static inline bool _rbuf_int_overlap_partially(gnrc_sixlowpan_frag_rb_int_t *i,
 
 static gnrc_sixlowpan_frag_rb_int_t *_rbuf_int_get_free(void)
 {
-    for (unsigned int i = 0; i < RBUF_INT_SIZE; i++) {
+    unsigned int i = _rbuf_int_next;
+
+    /* intervals are freed in several places by just resetting them, so there
+     * is no free list. Searching on after the interval allocated last finds a
+     * free one right away, unless the pool is almost exhausted. */
+    for (unsigned int n = 0; n < RBUF_INT_SIZE; n++) {
         if (rbuf_int[i].end == 0) { /* start must be smaller than end anyways*/
+            _rbuf_int_next = (i + 1) % RBUF_INT_SIZE;
             return rbuf_int + i;
         }
+        i = (i + 1) % RBUF_INT_SIZE;
     }
 
     return NULL;
@@ -545,6 +701,9 @@ static bool _rbuf_update_ints(gnrc_sixlowpan_frag_rb_base_t *entry,
 
     if (new == NULL) {
         DEBUG("6lo rfrag: no space left in rbuf interval buffer.\n");
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
+        gnrc_sixlowpan_frag_stats_get()->ints_full++;
+#endif
         return false;
     }
 
@@ -561,6 +720,7 @@ static bool _rbuf_update_ints(gnrc_sixlowpan_frag_rb_base_t *entry,
           entry->datagram_size, entry->tag);
 
     LL_PREPEND(entry->ints, new);
+    _rbuf_covered_mark(entry, offset, end);
 
     return true;
 }
@@ -620,41 +780,30 @@ static int _rbuf_get(const void *src, size_t src_len,
     gnrc_sixlowpan_frag_rb_t *res = NULL, *oldest = NULL;
     uint32_t now_usec = xtimer_now_usec();
 
-    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        /* check first if entry already available */
-        if ((rbuf[i].pkt != NULL) && (rbuf[i].super.tag == tag) &&
-            ((IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-              /* not all SFR fragments carry the datagram size, so make 0 a
-               * legal value to not compare datagram size */
-              ((size == 0) || (rbuf[i].super.datagram_size == size))) ||
-             (!IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-              (rbuf[i].super.datagram_size == size))) &&
-            (rbuf[i].super.src_len == src_len) &&
-            (rbuf[i].super.dst_len == dst_len) &&
-            (memcmp(rbuf[i].super.src, src, src_len) == 0) &&
-            (memcmp(rbuf[i].super.dst, dst, dst_len) == 0)) {
-            DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
-                                         l2addr_str));
-            DEBUG("%s, %u, %u) found\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
-                                         l2addr_str),
-                  (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
+    /* check first if entry already available */
+    res = _rbuf_find(src, src_len, dst, dst_len, size, tag);
+    if (res != NULL) {
+        DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
+              gnrc_netif_addr_to_str(res->super.src, res->super.src_len,
+                                     l2addr_str));
+        DEBUG("%s, %u, %u) found\n",
+              gnrc_netif_addr_to_str(res->super.dst, res->super.dst_len,
+                                     l2addr_str),
+              (unsigned)res->super.datagram_size, res->super.tag);
 #if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0
-            if (rbuf[i].super.current_size == 0) {
-                /* ensure that only empty reassembly buffer entries and entries
-                 * scheduled for deletion have `current_size == 0` */
-                DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
-                return -1;
-            }
-#endif
-            rbuf[i].super.arrival = now_usec;
-            _set_rbuf_timeout();
-            return i;
+        if (res->super.current_size == 0) {
+            /* ensure that only empty reassembly buffer entries and entries
+             * scheduled for deletion have `current_size == 0` */
+            DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
+            return -1;
         }
+#endif
+        res->super.arrival = now_usec;
+        _set_rbuf_timeout();
+        return res - &(rbuf[0]);
+    }
 
+    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         /* if there is a free spot: remember it */
         if ((res == NULL) && gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i])) {
             res = &(rbuf[i]);
@@ -742,10 +891,12 @@ static int _rbuf_get(const void *src, size_t src_len,
     res->super.dst_len = dst_len;
     res->super.tag = tag;
     res->super.current_size = 0;
+    memset(res->super.covered, 0, sizeof(res->super.covered));
 #if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR)
     res->offset_diff = 0U;
     memset(res->received, 0U, sizeof(res->received));
 #endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) */
+    _rbuf_idx_add(res);
 
     DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
           gnrc_netif_addr_to_str(res->super.src, res->super.src_len,
@@ -765,6 +916,10 @@ void gnrc_sixlowpan_frag_rb_reset(void)
 {
     xtimer_remove(&_gc_timer);
     memset(rbuf_int, 0, sizeof(rbuf_int));
+    _rbuf_int_next = 0;
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASHED)
+    memset(_rbuf_idx, 0, sizeof(_rbuf_idx));
+#endif
     for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         if ((rbuf[i].pkt != NULL) &&
             (rbuf[i].pkt->users > 0)) {
@@ -782,6 +937,12 @@ const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void)
 
 void gnrc_sixlowpan_frag_rb_base_rm(gnrc_sixlowpan_frag_rb_base_t *entry)
 {
+    /* entries of the virtual reassembly buffer share this function */
+    if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASHED) &&
+        (entry >= &rbuf[0].super) &&
+        (entry <= &rbuf[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE - 1].super)) {
+        _rbuf_idx_remove(container_of(entry, gnrc_sixlowpan_frag_rb_t, super));
+    }
     while (entry->ints != NULL) {
         gnrc_sixlowpan_frag_rb_int_t *next = entry->ints->next;
 
@@ -790,6 +951,7 @@ void gnrc_sixlowpan_frag_rb_base_rm(gnrc_sixlowpan_frag_rb_base_t *entry)
         entry->ints->next = NULL;
         entry->ints = next;
     }
+    memset(entry->covered, 0, sizeof(entry->covered));
     entry->datagram_size = 0;
 }
 
@@ -905,27 +1067,18 @@ static void _adapt_hdr(gnrc_pktsnip_t *hdr, unsigned page)
     }
 }
 
-static int _forward_frag(gnrc_pktsnip_t *pkt, size_t frag_hdr_size,
-                         gnrc_sixlowpan_frag_vrb_t *vrbe, unsigned page)
+static int _forward_frag(gnrc_pktsnip_t *pkt, gnrc_sixlowpan_frag_vrb_t *vrbe,
+                         unsigned page)
 {
     int res = -ENOTSUP;
 
     if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD)) {
-        gnrc_pktsnip_t *frag = gnrc_pktbuf_mark(pkt, frag_hdr_size,
-                                                GNRC_NETTYPE_SIXLOWPAN);
-        if (frag == NULL) {
-            gnrc_pktbuf_release(pkt);
-            res = -ENOMEM;
-        }
-        else {
-            pkt = gnrc_pkt_delete(pkt, frag);
-            frag->next = NULL;
-            /* remove netif header */
-            gnrc_pktbuf_remove_snip(pkt, pkt->next);
-            res = gnrc_sixlowpan_frag_minfwd_forward(pkt, frag->data, vrbe,
-                                                     page);
-            gnrc_pktbuf_release(frag);
-        }
+        /* remove netif header */
+        gnrc_pktbuf_remove_snip(pkt, pkt->next);
+        /* marking the fragmentation header would copy the whole payload, as
+         * the header is smaller than a packet buffer chunk, so just rewrite
+         * the header in place */
+        res = gnrc_sixlowpan_frag_minfwd_forward_inplace(pkt, vrbe, page);
     }
     return res;
 }
@@ -936,8 +1089,7 @@ static int _forward_uncomp(gnrc_pktsnip_t *pkt,
                            unsigned page)
 {
     DEBUG("6lo rbuf minfwd: found route, trying to forward\n");
-    int res = _forward_frag(pkt, sizeof(sixlowpan_frag_t),
-                            vrbe, page);
+    int res = _forward_frag(pkt, vrbe, page);
 
     /* prevent intervals from being deleted (they are in the
      * VRB now) */
@@ -88,6 +88,8 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_add(
             else if (base->ints != NULL) {
                 gnrc_sixlowpan_frag_rb_int_t *tmp = vrbe->super.ints;
 
+                bf_or(vrbe->super.covered, vrbe->super.covered,
+                      base->covered, GNRC_SIXLOWPAN_FRAG_RB_COVERED_NUMOF);
                 if (tmp != base->ints) {
                     /* base->ints is not already vrbe->super.ints */
                     if (tmp != NULL) {
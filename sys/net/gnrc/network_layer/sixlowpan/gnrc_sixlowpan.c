@@ -28,6 +28,7 @@
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
 #include "net/gnrc/sixlowpan/iphc.h"
 #include "net/gnrc/netif.h"
+#include "net/gnrc/netif/pktq.h"
 #include "net/sixlowpan.h"
 
 #define ENABLE_DEBUG 0
@@ -315,6 +316,12 @@ static void _send(gnrc_pktsnip_t *pkt)
         return;
     }
 
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_PRIO)
+    /* classify while the IPv6 header is still readable; all fragments
+     * inherit the class with the netif header */
+    gnrc_netif_hdr_set_qclass(pkt->data, gnrc_netif_pktq_class(pkt));
+#endif
+
     if (IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC) &&
         netif->flags & GNRC_NETIF_FLAGS_6LO_HC) {
         gnrc_sixlowpan_frag_fb_t *fbuf;
@@ -1095,8 +1095,10 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
     iphc_hdr[IPHC1_IDX] = SIXLOWPAN_IPHC1_DISP;
     iphc_hdr[IPHC2_IDX] = 0;
 
-    /* check for available contexts */
-    if (!ipv6_addr_is_unspecified(&(ipv6_hdr->src))) {
+    /* check for available contexts, link-local addresses are always
+     * compressed without context */
+    if (!ipv6_addr_is_unspecified(&(ipv6_hdr->src)) &&
+        !ipv6_addr_is_link_local(&(ipv6_hdr->src))) {
         src_ctx = gnrc_sixlowpan_ctx_lookup_addr(&(ipv6_hdr->src));
         /* do not use source context for compression if */
         /* GNRC_SIXLOWPAN_CTX_FLAGS_COMP is not set */
@@ -1110,7 +1112,8 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
         }
     }
 
-    if (!ipv6_addr_is_multicast(&ipv6_hdr->dst)) {
+    if (!ipv6_addr_is_multicast(&ipv6_hdr->dst) &&
+        !ipv6_addr_is_link_local(&ipv6_hdr->dst)) {
         dst_ctx = gnrc_sixlowpan_ctx_lookup_addr(&(ipv6_hdr->dst));
         /* do not use destination context for compression if */
         /* GNRC_SIXLOWPAN_CTX_FLAGS_COMP is not set */
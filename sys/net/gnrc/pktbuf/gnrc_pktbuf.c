@@ -24,6 +24,34 @@
 
 mutex_t gnrc_pktbuf_mutex = MUTEX_INIT;
 
+#ifdef DEVELHELP
+static gnrc_pktbuf_merge_stats_t _merge_stats;
+static gnrc_pktbuf_lock_stats_t _lock_stats;
+
+const gnrc_pktbuf_merge_stats_t *gnrc_pktbuf_merge_stats(void)
+{
+    return &_merge_stats;
+}
+
+const gnrc_pktbuf_lock_stats_t *gnrc_pktbuf_lock_stats(void)
+{
+    return &_lock_stats;
+}
+#endif
+
+void gnrc_pktbuf_lock(void)
+{
+#ifdef DEVELHELP
+    if (!mutex_trylock(&gnrc_pktbuf_mutex)) {
+        mutex_lock(&gnrc_pktbuf_mutex);
+        _lock_stats.contended++;
+    }
+    _lock_stats.locked++;
+#else
+    mutex_lock(&gnrc_pktbuf_mutex);
+#endif
+}
+
 gnrc_pktsnip_t *gnrc_pktbuf_remove_snip(gnrc_pktsnip_t *pkt,
                                         gnrc_pktsnip_t *snip)
 {
@@ -64,6 +92,9 @@ int gnrc_pktbuf_merge(gnrc_pktsnip_t *pkt)
     int res = 0;
 
     if (pkt->size == size) {
+#ifdef DEVELHELP
+        _merge_stats.avoided++;
+#endif
         return res;
     }
 
@@ -72,6 +103,10 @@ int gnrc_pktbuf_merge(gnrc_pktsnip_t *pkt)
     if (res != 0) {
         return res;
     }
+#ifdef DEVELHELP
+    _merge_stats.merged++;
+    _merge_stats.bytes += size - offset;
+#endif
 
     /* Copy data to new buffer */
     for (gnrc_pktsnip_t *ptr = pkt->next; ptr != NULL; ptr = ptr->next) {
@@ -87,7 +122,25 @@ int gnrc_pktbuf_merge(gnrc_pktsnip_t *pkt)
 
 void gnrc_pktbuf_release_error(gnrc_pktsnip_t *pkt, uint32_t err)
 {
-    mutex_lock(&gnrc_pktbuf_mutex);
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_MAGAZINE)
+    /* no other thread can access a snip only the caller holds, so those can
+     * be released without locking */
+    while ((pkt != NULL) && (pkt->users == 1) &&
+           (!IS_USED(MODULE_GNRC_TX_SYNC) ||
+            (pkt->type != GNRC_NETTYPE_TX_SYNC))) {
+        gnrc_pktsnip_t *tmp = pkt->next;
+
+        assert(gnrc_pktbuf_contains(pkt));
+        if (!gnrc_pktbuf_magazine_release(pkt, err)) {
+            break;
+        }
+        pkt = tmp;
+    }
+    if (pkt == NULL) {
+        return;
+    }
+#endif
+    gnrc_pktbuf_lock();
     while (pkt) {
         gnrc_pktsnip_t *tmp;
         assert(gnrc_pktbuf_contains(pkt));
@@ -119,7 +172,7 @@ void gnrc_pktbuf_release_error(gnrc_pktsnip_t *pkt, uint32_t err)
         gnrc_neterr_report(pkt, err);
         pkt = tmp;
     }
-    mutex_unlock(&gnrc_pktbuf_mutex);
+    gnrc_pktbuf_unlock();
 }
 
 /** @} */
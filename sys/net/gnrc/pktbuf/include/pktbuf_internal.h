@@ -24,9 +24,12 @@
  */
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 
+#include "modules.h"
 #include "mutex.h"
+#include "net/gnrc/pkt.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -41,6 +44,27 @@ extern "C" {
  */
 extern mutex_t gnrc_pktbuf_mutex;
 
+/**
+ * @brief   Locks @ref gnrc_pktbuf_mutex
+ *
+ * With DEVELHELP defined, this also counts for
+ * @ref gnrc_pktbuf_lock_stats() how often the packet buffer was locked and
+ * how often a thread had to wait for it.
+ *
+ * @warning This function is ***internal***.
+ */
+void gnrc_pktbuf_lock(void);
+
+/**
+ * @brief   Unlocks @ref gnrc_pktbuf_mutex
+ *
+ * @warning This function is ***internal***.
+ */
+static inline void gnrc_pktbuf_unlock(void)
+{
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+
 /**
  * @brief   Check if the given pointer is indeed part of the packet buffer
  *
@@ -65,6 +89,26 @@ bool gnrc_pktbuf_contains(void *ptr);
  */
 void gnrc_pktbuf_free_internal(void *data, size_t size);
 
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_MAGAZINE) || defined(DOXYGEN)
+/**
+ * @brief   Releases a packet snip into the cache of the calling thread
+ *
+ * @warning This function is ***internal***. It must be called without
+ *          @ref gnrc_pktbuf_mutex locked.
+ *
+ * @pre     @p pkt is only referenced by the caller, i.e. `pkt->users == 1`
+ *
+ * @param   pkt     the packet snip to release, gnrc_pktsnip_t::next is
+ *                  not released
+ * @param   err     status code reported to the packet's error subscriber
+ *
+ * @return  true, if @p pkt was released
+ * @return  false, if @p pkt must be released with @ref gnrc_pktbuf_mutex
+ *          locked, e.g. because its data is too large for the cache
+ */
+bool gnrc_pktbuf_magazine_release(gnrc_pktsnip_t *pkt, uint32_t err);
+#endif
+
 /* for testing */
 #ifdef TEST_SUITES
 /**
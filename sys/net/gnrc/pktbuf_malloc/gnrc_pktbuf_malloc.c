@@ -25,6 +25,7 @@
 #include <sys/types.h>
 #include <sys/uio.h>
 
+#include "architecture.h"
 #include "log.h"
 #include "mutex.h"
 #include "od.h"
@@ -106,9 +107,9 @@ gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t s
               (unsigned)size, CONFIG_GNRC_PKTBUF_SIZE);
         return NULL;
     }
-    mutex_lock(&gnrc_pktbuf_mutex);
+    gnrc_pktbuf_lock();
     pkt = _create_snip(next, data, size, type);
-    mutex_unlock(&gnrc_pktbuf_mutex);
+    gnrc_pktbuf_unlock();
     return pkt;
 }
 
@@ -162,9 +163,9 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
 {
     gnrc_pktsnip_t *new;
 
-    mutex_lock(&gnrc_pktbuf_mutex);
+    gnrc_pktbuf_lock();
     new = _mark(pkt, size, type);
-    mutex_unlock(&gnrc_pktbuf_mutex);
+    gnrc_pktbuf_unlock();
     return new;
 }
 
@@ -200,28 +201,28 @@ int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
 {
     int res;
 
-    mutex_lock(&gnrc_pktbuf_mutex);
+    gnrc_pktbuf_lock();
     res = _realloc_data(pkt, size);
-    mutex_unlock(&gnrc_pktbuf_mutex);
+    gnrc_pktbuf_unlock();
     return res;
 }
 
 void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
 {
-    mutex_lock(&gnrc_pktbuf_mutex);
+    gnrc_pktbuf_lock();
     while (pkt) {
         assert(pkt->users + num <= 0xff);
         pkt->users += num;
         pkt = pkt->next;
     }
-    mutex_unlock(&gnrc_pktbuf_mutex);
+    gnrc_pktbuf_unlock();
 }
 
 gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
 {
-    mutex_lock(&gnrc_pktbuf_mutex);
+    gnrc_pktbuf_lock();
     if (pkt == NULL) {
-        mutex_unlock(&gnrc_pktbuf_mutex);
+        gnrc_pktbuf_unlock();
         return NULL;
     }
     if (pkt->users > 1) {
@@ -230,10 +231,10 @@ gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
         if (new != NULL) {
             pkt->users--;
         }
-        mutex_unlock(&gnrc_pktbuf_mutex);
+        gnrc_pktbuf_unlock();
         return new;
     }
-    mutex_unlock(&gnrc_pktbuf_mutex);
+    gnrc_pktbuf_unlock();
     return pkt;
 }
 
@@ -241,6 +242,12 @@ gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
 void gnrc_pktbuf_stats(void)
 {
     LOG_INFO("pktbuf: no stat output for gnrc_pktbuf_malloc, use tools like valgrind\n");
+    printf("merges: %u (%" PRIuSIZE " bytes copied), already contiguous: %u\n",
+           gnrc_pktbuf_merge_stats()->merged, gnrc_pktbuf_merge_stats()->bytes,
+           gnrc_pktbuf_merge_stats()->avoided);
+    printf("lock: %u acquisitions, %u contended\n",
+           gnrc_pktbuf_lock_stats()->locked,
+           gnrc_pktbuf_lock_stats()->contended);
 }
 #endif
 
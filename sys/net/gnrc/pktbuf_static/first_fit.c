@@ -0,0 +1,317 @@
+/*
+ * Copyright (C) 2014 Martine Lenders <mlenders@inf.fu-berlin.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf
+ * @{
+ *
+ * @file
+ * @brief   First-fit allocator for the arena of the static packet buffer
+ *
+ * @author  Martine Lenders <mlenders@inf.fu-berlin.de>
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/types.h>
+
+#include "od.h"
+#include "net/gnrc/pktbuf.h"
+#include "string_utils.h"
+
+#include "pktbuf_internal.h"
+#include "pktbuf_static.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static alignas(sizeof(_unused_t)) uint8_t _static_buf[CONFIG_GNRC_PKTBUF_SIZE];
+static_assert((CONFIG_GNRC_PKTBUF_SIZE % sizeof(_unused_t)) == 0,
+              "CONFIG_GNRC_PKTBUF_SIZE has to be a multiple of 8");
+static _unused_t *_first_unused;
+
+#ifdef DEVELHELP
+/* maximum number of bytes allocated */
+static uint16_t max_byte_count = 0;
+#endif
+
+void _pktbuf_init(void)
+{
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+        memset(_static_buf, GNRC_PKTBUF_CANARY, sizeof(_static_buf));
+    }
+    /* Silence false -Wcast-align: _static_buf has qualifier
+     * `alignas(_unused_t)`, so it is guaranteed to be safe */
+    _first_unused = (_unused_t *)(uintptr_t)_static_buf;
+    _first_unused->next = NULL;
+    _first_unused->size = sizeof(_static_buf);
+}
+
+#ifdef DEVELHELP
+static inline void _print_chunk(void *chunk, size_t size, int num)
+{
+    printf("=========== chunk %3i (%-10p size: %4" PRIuSIZE ") ===========\n", num, chunk,
+           size);
+#ifdef MODULE_OD
+    od_hex_dump(chunk, size, OD_WIDTH_DEFAULT);
+#endif
+}
+
+static inline void _print_ptr(_unused_t *ptr)
+{
+    if (ptr == NULL) {
+        printf("(nil)");
+    }
+    else {
+        printf("%p", (void *)ptr);
+    }
+}
+
+static inline void _print_unused(_unused_t *ptr)
+{
+    printf("~ unused: ");
+    _print_ptr(ptr);
+    printf(" (next: ");
+    _print_ptr(ptr->next);
+    printf(", size: %4u) ~\n", ptr->size);
+}
+
+void _pktbuf_stats(void)
+{
+    _unused_t *ptr = _first_unused;
+    uint8_t *chunk = &_static_buf[0];
+    int count = 0;
+
+    printf("packet buffer: first byte: %p, last byte: %p (size: %u)\n",
+           (void *)&_static_buf[0],
+           (void *)&_static_buf[CONFIG_GNRC_PKTBUF_SIZE],
+           CONFIG_GNRC_PKTBUF_SIZE);
+    printf("  position of last byte used: %" PRIu16 "\n", max_byte_count);
+    if (ptr == NULL) {  /* packet buffer is completely full */
+        _print_chunk(chunk, CONFIG_GNRC_PKTBUF_SIZE, count++);
+    }
+
+    if (((void *)ptr) == ((void *)chunk)) { /* _first_unused is at the beginning */
+        _print_unused(ptr);
+        chunk += ptr->size;
+        ptr = ptr->next;
+    }
+
+    while (ptr) {
+        size_t size = ((uint8_t *)ptr) - chunk;
+        if ((size == 0) && (!_pktbuf_contains(ptr)) &&
+            (!_pktbuf_contains(chunk)) && (size > CONFIG_GNRC_PKTBUF_SIZE)) {
+            puts("ERROR");
+            return;
+        }
+        _print_chunk(chunk, size, count++);
+        chunk += (size + ptr->size);
+        _print_unused(ptr);
+        ptr = ptr->next;
+    }
+
+    if (chunk <= &_static_buf[CONFIG_GNRC_PKTBUF_SIZE - 1]) {
+        _print_chunk(chunk, &_static_buf[CONFIG_GNRC_PKTBUF_SIZE] - chunk, count);
+    }
+}
+#endif
+
+#ifdef TEST_SUITES
+bool _pktbuf_is_empty(void)
+{
+    return ((uintptr_t)_first_unused == (uintptr_t)_static_buf) &&
+           (_first_unused->size == sizeof(_static_buf));
+}
+
+bool _pktbuf_is_sane(void)
+{
+    _unused_t *ptr = _first_unused;
+
+    /* Invariants of this implementation:
+     *  - the head of _unused_t list is _first_unused
+     *  - if _unused_t list is empty the packet buffer is full and _first_unused is NULL
+     *  - forall ptr_in _unused_t list: &_static_buf[0] < ptr
+     *                                  && ptr < &_static_buf[CONFIG_GNRC_PKTBUF_SIZE]
+     *  - forall ptr in _unused_t list: ptr->next == NULL || ptr < ptr->next
+     *  - forall ptr in _unused_t list: (ptr->next != NULL && ptr->size <= (ptr->next - ptr)) ||
+     *                                  (ptr->next == NULL
+     *                                  && ptr->size == (CONFIG_GNRC_PKTBUF_SIZE - pos_in_buf))
+     */
+
+    while (ptr) {
+        if ((&_static_buf[0] >= (uint8_t *)ptr)
+            && ((uint8_t *)ptr >= &_static_buf[CONFIG_GNRC_PKTBUF_SIZE])) {
+            return false;
+        }
+        if ((ptr->next != NULL) && (ptr >= ptr->next)) {
+            return false;
+        }
+        size_t pos_in_buf = (uint8_t *)ptr - &_static_buf[0];
+        if (((ptr->next == NULL) || (ptr->size > (size_t)((uint8_t *)(ptr->next) - (uint8_t *)ptr)))
+            && ((ptr->next != NULL) || (ptr->size != CONFIG_GNRC_PKTBUF_SIZE - pos_in_buf))) {
+            return false;
+        }
+        ptr = ptr->next;
+    }
+
+    return true;
+}
+#endif
+
+void *_pktbuf_alloc(size_t size)
+{
+    _unused_t *prev = NULL, *ptr = _first_unused;
+
+    size = _align(size);
+    while (ptr && (size > ptr->size)) {
+        prev = ptr;
+        ptr = ptr->next;
+    }
+    if (ptr == NULL) {
+        DEBUG("pktbuf: no space left in packet buffer\n");
+        return NULL;
+    }
+    /* _unused_t struct would fit => add new space at ptr */
+    if (sizeof(_unused_t) > (ptr->size - size)) {
+        if (prev == NULL) { /* ptr was _first_unused */
+            _first_unused = ptr->next;
+        }
+        else {
+            prev->next = ptr->next;
+        }
+    }
+    else {
+        /* alignment is ensured by rounding size up in the _align() function.
+         * We cast to uintptr_t as intermediate step to silence -Wcast-align */
+        _unused_t *new = (_unused_t *)((uintptr_t)ptr + size);
+
+        if (((((uint8_t *)new) - &(_static_buf[0])) + sizeof(_unused_t))
+            > CONFIG_GNRC_PKTBUF_SIZE) {
+            /* content of new would exceed packet buffer size so set to NULL */
+            _first_unused = NULL;
+        }
+        else if (prev == NULL) { /* ptr was _first_unused */
+            _first_unused = new;
+        }
+        else {
+            prev->next = new;
+        }
+        new->next = ptr->next;
+        new->size = ptr->size - size;
+    }
+#ifdef DEVELHELP
+    uint16_t last_byte = (uint16_t)((((uint8_t *)ptr) + size) - &(_static_buf[0]));
+    if (last_byte > max_byte_count) {
+        max_byte_count = last_byte;
+    }
+#endif
+
+    const void *mismatch;
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE &&
+        (mismatch = memchk(ptr + 1, GNRC_PKTBUF_CANARY, size - sizeof(_unused_t)))) {
+        printf("[%p] mismatch at offset %"PRIuPTR"/%" PRIuSIZE
+               " (ignoring %" PRIuSIZE " initial bytes that were repurposed)\n",
+               (void *)ptr, (uintptr_t)mismatch - (uintptr_t)ptr, size, sizeof(_unused_t));
+#ifdef MODULE_OD
+        od_hex_dump(ptr, size, 0);
+#endif
+        assert(0);
+    }
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+        /* clear out canary */
+        memset(ptr, ~GNRC_PKTBUF_CANARY, size);
+    }
+
+    return (void *)ptr;
+}
+
+static inline bool _too_small_hole(_unused_t *a, _unused_t *b)
+{
+    return sizeof(_unused_t) > (size_t)(((uint8_t *)b) - (((uint8_t *)a) + a->size));
+}
+
+static inline _unused_t *_merge(_unused_t *a, _unused_t *b)
+{
+    assert(b != NULL);
+
+    a->next = b->next;
+    a->size = b->size + ((uint8_t *)b - (uint8_t *)a);
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+        memset(b, GNRC_PKTBUF_CANARY, sizeof(*b));
+    }
+    return a;
+}
+
+void _pktbuf_free(void *data, size_t size)
+{
+    size_t bytes_at_end;
+    _unused_t *new = (_unused_t *)data, *prev = NULL, *ptr = _first_unused;
+
+    if (data == NULL) {
+        return;
+    }
+
+    if (!_pktbuf_contains(data)) {
+        assert(0);
+        return;
+    }
+
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+        /* check if the data has already been marked as free */
+        size_t chk_len = _align(size) - sizeof(*new);
+        if (chk_len &&
+            !memchk((uint8_t *)data + sizeof(*new), GNRC_PKTBUF_CANARY, chk_len)) {
+            printf("pktbuf: double free detected! (at %p, len=%u)\n",
+                   data, (unsigned)_align(size));
+            DEBUG_BREAKPOINT(2);
+        }
+        memset(data, GNRC_PKTBUF_CANARY, _align(size));
+    }
+
+    while (ptr && (((void *)ptr) < data)) {
+        prev = ptr;
+        ptr = ptr->next;
+    }
+    new->next = ptr;
+    new->size = _align(size);
+    /* calculate number of bytes between new _unused_t chunk and end of packet
+     * buffer */
+    bytes_at_end = ((&_static_buf[0] + CONFIG_GNRC_PKTBUF_SIZE)
+                   - (((uint8_t *)new) + new->size));
+    if (bytes_at_end < sizeof(_unused_t)) {
+        /* new is very last segment and there is a little bit of memory left
+         * that wouldn't fit _unused_t (cut of in _pktbuf_alloc()) => re-add it */
+        new->size += bytes_at_end;
+    }
+    if (prev == NULL) { /* ptr was _first_unused or data before _first_unused */
+        _first_unused = new;
+    }
+    else {
+        prev->next = new;
+        if (_too_small_hole(prev, new)) {
+            new = _merge(prev, new);
+        }
+    }
+    if ((new->next != NULL) && (_too_small_hole(new, new->next))) {
+        _merge(new, new->next);
+    }
+}
+
+bool _pktbuf_contains(void *ptr)
+{
+    const uintptr_t start = (uintptr_t)_static_buf;
+    const uintptr_t end = start + sizeof(_static_buf);
+    uintptr_t pos = (uintptr_t)ptr;
+    return ((pos >= start) && (pos < end));
+}
+
+/** @} */
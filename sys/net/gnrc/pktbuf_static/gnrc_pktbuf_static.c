@@ -18,19 +18,23 @@
 #include <assert.h>
 #include <errno.h>
 #include <inttypes.h>
-#include <stdalign.h>
+#include <limits.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
 #include <sys/types.h>
 
+#include "architecture.h"
+#include "irq.h"
+#include "kernel_defines.h"
+#include "memarray.h"
 #include "mutex.h"
-#include "od.h"
+#include "sched.h"
+#include "thread.h"
 #include "utlist.h"
 #include "net/gnrc/pktbuf.h"
 #include "net/gnrc/nettype.h"
 #include "net/gnrc/pkt.h"
-#include "string_utils.h"
 
 #include "pktbuf_internal.h"
 #include "pktbuf_static.h"
@@ -38,20 +42,74 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
-static alignas(sizeof(_unused_t)) uint8_t _static_buf[CONFIG_GNRC_PKTBUF_SIZE];
-static_assert((CONFIG_GNRC_PKTBUF_SIZE % sizeof(_unused_t)) == 0,
-              "CONFIG_GNRC_PKTBUF_SIZE has to be a multiple of 8");
-static _unused_t *_first_unused;
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SNIP_SLAB)
+/* packet snip descriptors are kept apart from the data in the arena */
+static gnrc_pktsnip_t _snip_slab_buf[CONFIG_GNRC_PKTBUF_STATIC_SNIP_SLAB_NUMOF];
+static memarray_t _snip_slab;
+#ifdef DEVELHELP
+/* number of packet snip descriptors currently allocated from the slab */
+static unsigned _snip_slab_used;
+/* maximum number of packet snip descriptors allocated from the slab */
+static unsigned _snip_slab_max_used;
+/* number of packet snip descriptors allocated from the arena as the slab
+ * was exhausted */
+static unsigned _snip_slab_fallbacks;
+#endif
+#endif
 
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_MAGAZINE)
+/* magazine 0 of a cache holds packet snip descriptors, magazine i > 0 holds
+ * data chunks of i * sizeof(_unused_t) bytes */
+#define MAGAZINE_NUMOF      (1 + (CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_CHUNK_MAX / \
+                                  sizeof(_unused_t)))
+#define MAGAZINE_BATCH      ((CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_SIZE + 1) / 2)
+/* marks threads that did not get a cache */
+#define CACHE_NONE          (UINT8_MAX)
+
+static_assert(CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_NUMOF < CACHE_NONE,
+              "CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_NUMOF too large");
+static_assert(CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_SIZE <= UINT8_MAX,
+              "CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_SIZE too large");
+
+typedef struct {
+    void *chunks;           /* free chunks, linked by their first word */
+    uint8_t numof;          /* number of chunks in the magazine */
+} _magazine_t;
+
+/* only ever accessed by the thread owning the cache, or under
+ * gnrc_pktbuf_mutex once that thread exited */
+typedef struct {
+    _magazine_t mags[MAGAZINE_NUMOF];
+    uint16_t bytes;         /* bytes held by all magazines */
+    kernel_pid_t owner;     /* KERNEL_PID_UNDEF if the cache is unused */
 #ifdef DEVELHELP
-/* maximum number of bytes allocated */
-static uint16_t max_byte_count = 0;
+    unsigned hits;          /* allocations and releases without locking */
+    unsigned refills;
+    unsigned drains;
+#endif
+} _cache_t;
+
+static _cache_t _caches[CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_NUMOF];
+/* cache of each thread, index + 1 or 0 if the thread did not ask yet */
+static uint8_t _cache_of[MAXTHREADS];
+/* thread the entry in _cache_of was set for. A PID is reused after its thread
+ * exited, so the entry only holds for the thread recorded here. */
+static const thread_t *_cache_thread[MAXTHREADS];
 #endif
 
 /* internal gnrc_pktbuf functions */
 static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
                                     gnrc_nettype_t type);
-static void *_pktbuf_alloc(size_t size);
+static gnrc_pktsnip_t *_snip_alloc(void);
+static void *_arena_alloc(size_t size);
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_MAGAZINE)
+static gnrc_pktsnip_t *_magazine_create_snip(gnrc_pktsnip_t *next,
+                                             const void *data, size_t size,
+                                             gnrc_nettype_t type);
+static void _cache_flush(_cache_t *cache);
+static bool _cache_orphaned(const _cache_t *cache);
+static void _cache_release(_cache_t *cache);
+#endif
 
 static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
                                 void *data, size_t size, gnrc_nettype_t type)
@@ -66,18 +124,39 @@ static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
 #endif
 }
 
+static inline bool _snip_slab_contains(void *ptr)
+{
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SNIP_SLAB)
+    const uintptr_t start = (uintptr_t)_snip_slab_buf;
+    const uintptr_t end = start + sizeof(_snip_slab_buf);
+    uintptr_t pos = (uintptr_t)ptr;
+    return ((pos >= start) && (pos < end));
+#else
+    (void)ptr;
+    return false;
+#endif
+}
+
 void gnrc_pktbuf_init(void)
 {
-    mutex_lock(&gnrc_pktbuf_mutex);
-    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
-        memset(_static_buf, GNRC_PKTBUF_CANARY, sizeof(_static_buf));
-    }
-    /* Silence false -Wcast-align: _static_buf has qualifier
-     * `alignas(_unused_t)`, so it is guaranteed to be safe */
-    _first_unused = (_unused_t *)(uintptr_t)_static_buf;
-    _first_unused->next = NULL;
-    _first_unused->size = sizeof(_static_buf);
-    mutex_unlock(&gnrc_pktbuf_mutex);
+    gnrc_pktbuf_lock();
+    _pktbuf_init();
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SNIP_SLAB)
+    memarray_init(&_snip_slab, _snip_slab_buf, sizeof(gnrc_pktsnip_t),
+                  ARRAY_SIZE(_snip_slab_buf));
+#ifdef DEVELHELP
+    _snip_slab_used = 0;
+    _snip_slab_max_used = 0;
+    _snip_slab_fallbacks = 0;
+#endif
+#endif
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_MAGAZINE)
+    /* the cached chunks were returned to the arena by _pktbuf_init() */
+    memset(_caches, 0, sizeof(_caches));
+    memset(_cache_of, 0, sizeof(_cache_of));
+    memset(_cache_thread, 0, sizeof(_cache_thread));
+#endif
+    gnrc_pktbuf_unlock();
 }
 
 gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
@@ -90,9 +169,15 @@ gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t s
               size, CONFIG_GNRC_PKTBUF_SIZE);
         return NULL;
     }
-    mutex_lock(&gnrc_pktbuf_mutex);
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_MAGAZINE)
+    pkt = _magazine_create_snip(next, data, size, type);
+    if (pkt != NULL) {
+        return pkt;
+    }
+#endif
+    gnrc_pktbuf_lock();
     pkt = _create_snip(next, data, size, type);
-    mutex_unlock(&gnrc_pktbuf_mutex);
+    gnrc_pktbuf_unlock();
     return pkt;
 }
 
@@ -103,39 +188,39 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
     size_t required_new_size = _align(size);
     void *new_data_marked;
 
-    mutex_lock(&gnrc_pktbuf_mutex);
+    gnrc_pktbuf_lock();
     if ((size == 0) || (pkt == NULL) || (size > pkt->size) || (pkt->data == NULL)) {
         DEBUG("pktbuf: size == 0 (was %" PRIuSIZE ") or pkt == NULL (was %p) or "
               "size > pkt->size (was %" PRIuSIZE ") or pkt->data == NULL (was %p)\n",
               size, (void *)pkt, (pkt ? pkt->size : 0),
               (pkt ? pkt->data : NULL));
-        mutex_unlock(&gnrc_pktbuf_mutex);
+        gnrc_pktbuf_unlock();
         return NULL;
     }
     /* create new snip descriptor for marked data */
-    marked_snip = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    marked_snip = _snip_alloc();
     if (marked_snip == NULL) {
         DEBUG("pktbuf: could not reallocate marked section.\n");
-        mutex_unlock(&gnrc_pktbuf_mutex);
+        gnrc_pktbuf_unlock();
         return NULL;
     }
     /* marked data would not fit _unused_t marker => move data around to allow
      * for proper free */
     if ((pkt->size != size) && (size < required_new_size)) {
         void *new_data_rest;
-        new_data_marked = _pktbuf_alloc(size);
+        new_data_marked = _arena_alloc(size);
         if (new_data_marked == NULL) {
             DEBUG("pktbuf: could not reallocate marked section.\n");
             gnrc_pktbuf_free_internal(marked_snip, sizeof(gnrc_pktsnip_t));
-            mutex_unlock(&gnrc_pktbuf_mutex);
+            gnrc_pktbuf_unlock();
             return NULL;
         }
-        new_data_rest = _pktbuf_alloc(pkt->size - size);
+        new_data_rest = _arena_alloc(pkt->size - size);
         if (new_data_rest == NULL) {
             DEBUG("pktbuf: could not reallocate remaining section.\n");
             gnrc_pktbuf_free_internal(marked_snip, sizeof(gnrc_pktsnip_t));
             gnrc_pktbuf_free_internal(new_data_marked, size);
-            mutex_unlock(&gnrc_pktbuf_mutex);
+            gnrc_pktbuf_unlock();
             return NULL;
         }
         memcpy(new_data_marked, pkt->data, size);
@@ -153,7 +238,7 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
     pkt->size -= size;
     _set_pktsnip(marked_snip, pkt->next, new_data_marked, size, type);
     pkt->next = marked_snip;
-    mutex_unlock(&gnrc_pktbuf_mutex);
+    gnrc_pktbuf_unlock();
     return marked_snip;
 }
 
@@ -161,14 +246,14 @@ int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
 {
     size_t aligned_size = _align(size);
 
-    mutex_lock(&gnrc_pktbuf_mutex);
+    gnrc_pktbuf_lock();
     assert(pkt != NULL);
     assert(((pkt->size == 0) && (pkt->data == NULL)) ||
            ((pkt->size > 0) && (pkt->data != NULL) && gnrc_pktbuf_contains(pkt->data)));
     /* new size and old size are equal */
     if (size == pkt->size) {
         /* nothing to do */
-        mutex_unlock(&gnrc_pktbuf_mutex);
+        gnrc_pktbuf_unlock();
         return 0;
     }
     /* new size is 0 and data pointer isn't already NULL */
@@ -179,10 +264,10 @@ int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
     }
     /* if new size is bigger than old size */
     else if (size > pkt->size) {    /* new size does not fit */
-        void *new_data = _pktbuf_alloc(size);
+        void *new_data = _arena_alloc(size);
         if (new_data == NULL) {
             DEBUG("pktbuf: error allocating new data section\n");
-            mutex_unlock(&gnrc_pktbuf_mutex);
+            gnrc_pktbuf_unlock();
             return ENOMEM;
         }
         if (pkt->data != NULL) {            /* if old data exist */
@@ -196,26 +281,26 @@ int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
                      pkt->size - aligned_size);
     }
     pkt->size = size;
-    mutex_unlock(&gnrc_pktbuf_mutex);
+    gnrc_pktbuf_unlock();
     return 0;
 }
 
 void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
 {
-    mutex_lock(&gnrc_pktbuf_mutex);
+    gnrc_pktbuf_lock();
     while (pkt) {
         assert(pkt->users + num <= 0xff);
         pkt->users += num;
         pkt = pkt->next;
     }
-    mutex_unlock(&gnrc_pktbuf_mutex);
+    gnrc_pktbuf_unlock();
 }
 
 gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
 {
-    mutex_lock(&gnrc_pktbuf_mutex);
+    gnrc_pktbuf_lock();
     if (pkt == NULL) {
-        mutex_unlock(&gnrc_pktbuf_mutex);
+        gnrc_pktbuf_unlock();
         return NULL;
     }
 
@@ -231,128 +316,147 @@ gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
         if (new != NULL) {
             pkt->users--;
         }
-        mutex_unlock(&gnrc_pktbuf_mutex);
+        gnrc_pktbuf_unlock();
         return new;
     }
-    mutex_unlock(&gnrc_pktbuf_mutex);
+    gnrc_pktbuf_unlock();
     return pkt;
 }
 
 #ifdef DEVELHELP
-static inline void _print_chunk(void *chunk, size_t size, int num)
+void gnrc_pktbuf_stats(void)
 {
-    printf("=========== chunk %3i (%-10p size: %4" PRIuSIZE ") ===========\n", num, chunk,
-           size);
-#ifdef MODULE_OD
-    od_hex_dump(chunk, size, OD_WIDTH_DEFAULT);
+    gnrc_pktbuf_lock();
+    _pktbuf_stats();
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SNIP_SLAB)
+    printf("snip slab: %u of %u descriptors used (max: %u, size: %u)\n",
+           _snip_slab_used, (unsigned)ARRAY_SIZE(_snip_slab_buf),
+           _snip_slab_max_used, (unsigned)sizeof(gnrc_pktsnip_t));
+    printf("  descriptors allocated from arena: %u\n", _snip_slab_fallbacks);
 #endif
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_MAGAZINE)
+    unsigned used = 0;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_NUMOF; i++) {
+        used += (_caches[i].owner != KERNEL_PID_UNDEF);
+    }
+    printf("caches: %u of %u used\n", used,
+           CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_NUMOF);
+    for (unsigned i = 0; i < CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_NUMOF; i++) {
+        if (_caches[i].owner == KERNEL_PID_UNDEF) {
+            continue;
+        }
+        printf("  pid %u: %u bytes cached, hits: %u, refills: %u, drains: %u\n",
+               (unsigned)_caches[i].owner, (unsigned)_caches[i].bytes,
+               _caches[i].hits, _caches[i].refills, _caches[i].drains);
+    }
+#endif
+    printf("merges: %u (%" PRIuSIZE " bytes copied), already contiguous: %u\n",
+           gnrc_pktbuf_merge_stats()->merged, gnrc_pktbuf_merge_stats()->bytes,
+           gnrc_pktbuf_merge_stats()->avoided);
+    printf("lock: %u acquisitions, %u contended\n",
+           gnrc_pktbuf_lock_stats()->locked,
+           gnrc_pktbuf_lock_stats()->contended);
+    gnrc_pktbuf_unlock();
 }
+#endif
 
-static inline void _print_ptr(_unused_t *ptr)
+#ifdef TEST_SUITES
+bool gnrc_pktbuf_is_empty(void)
 {
-    if (ptr == NULL) {
-        printf("(nil)");
-    }
-    else {
-        printf("%p", (void *)ptr);
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_MAGAZINE)
+    /* cached chunks are free, but taken from the arena. Tests call this
+     * function when the other threads do not use the packet buffer. */
+    gnrc_pktbuf_lock();
+    for (unsigned i = 0; i < CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_NUMOF; i++) {
+        _cache_flush(&_caches[i]);
+    }
+    gnrc_pktbuf_unlock();
+#endif
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SNIP_SLAB)
+    if (memarray_available(&_snip_slab) != ARRAY_SIZE(_snip_slab_buf)) {
+        return false;
     }
+#endif
+    return _pktbuf_is_empty();
 }
 
-static inline void _print_unused(_unused_t *ptr)
+bool gnrc_pktbuf_is_sane(void)
 {
-    printf("~ unused: ");
-    _print_ptr(ptr);
-    printf(" (next: ");
-    _print_ptr(ptr->next);
-    printf(", size: %4u) ~\n", ptr->size);
+    return _pktbuf_is_sane();
 }
+#endif
 
-void gnrc_pktbuf_stats(void)
+/* returns NULL if the slab is exhausted or not used */
+static gnrc_pktsnip_t *_snip_slab_alloc(void)
 {
-    _unused_t *ptr = _first_unused;
-    uint8_t *chunk = &_static_buf[0];
-    int count = 0;
-
-    printf("packet buffer: first byte: %p, last byte: %p (size: %u)\n",
-           (void *)&_static_buf[0],
-           (void *)&_static_buf[CONFIG_GNRC_PKTBUF_SIZE],
-           CONFIG_GNRC_PKTBUF_SIZE);
-    printf("  position of last byte used: %" PRIu16 "\n", max_byte_count);
-    if (ptr == NULL) {  /* packet buffer is completely full */
-        _print_chunk(chunk, CONFIG_GNRC_PKTBUF_SIZE, count++);
-    }
-
-    if (((void *)ptr) == ((void *)chunk)) { /* _first_unused is at the beginning */
-        _print_unused(ptr);
-        chunk += ptr->size;
-        ptr = ptr->next;
-    }
-
-    while (ptr) {
-        size_t size = ((uint8_t *)ptr) - chunk;
-        if ((size == 0) && (!gnrc_pktbuf_contains(ptr)) &&
-            (!gnrc_pktbuf_contains(chunk)) && (size > CONFIG_GNRC_PKTBUF_SIZE)) {
-            puts("ERROR");
-            return;
-        }
-        _print_chunk(chunk, size, count++);
-        chunk += (size + ptr->size);
-        _print_unused(ptr);
-        ptr = ptr->next;
-    }
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SNIP_SLAB)
+    gnrc_pktsnip_t *pkt = memarray_alloc(&_snip_slab);
 
-    if (chunk <= &_static_buf[CONFIG_GNRC_PKTBUF_SIZE - 1]) {
-        _print_chunk(chunk, &_static_buf[CONFIG_GNRC_PKTBUF_SIZE] - chunk, count);
+    if (pkt != NULL) {
+#ifdef DEVELHELP
+        if (++_snip_slab_used > _snip_slab_max_used) {
+            _snip_slab_max_used = _snip_slab_used;
+        }
+#endif
+        return pkt;
     }
-}
+    DEBUG("pktbuf: snip slab exhausted, allocating from arena\n");
+#ifdef DEVELHELP
+    _snip_slab_fallbacks++;
+#endif
 #endif
+    return NULL;
+}
 
-#ifdef TEST_SUITES
-bool gnrc_pktbuf_is_empty(void)
+static gnrc_pktsnip_t *_snip_alloc(void)
 {
-    return ((uintptr_t)_first_unused == (uintptr_t)_static_buf) &&
-           (_first_unused->size == sizeof(_static_buf));
+    gnrc_pktsnip_t *pkt = _snip_slab_alloc();
+
+    return (pkt != NULL) ? pkt : _arena_alloc(sizeof(gnrc_pktsnip_t));
 }
 
-bool gnrc_pktbuf_is_sane(void)
+static void *_arena_alloc(size_t size)
 {
-    _unused_t *ptr = _first_unused;
-
-    /* Invariants of this implementation:
-     *  - the head of _unused_t list is _first_unused
-     *  - if _unused_t list is empty the packet buffer is full and _first_unused is NULL
-     *  - forall ptr_in _unused_t list: &_static_buf[0] < ptr
-     *                                  && ptr < &_static_buf[CONFIG_GNRC_PKTBUF_SIZE]
-     *  - forall ptr in _unused_t list: ptr->next == NULL || ptr < ptr->next
-     *  - forall ptr in _unused_t list: (ptr->next != NULL && ptr->size <= (ptr->next - ptr)) ||
-     *                                  (ptr->next == NULL
-     *                                  && ptr->size == (CONFIG_GNRC_PKTBUF_SIZE - pos_in_buf))
-     */
-
-    while (ptr) {
-        if ((&_static_buf[0] >= (uint8_t *)ptr)
-            && ((uint8_t *)ptr >= &_static_buf[CONFIG_GNRC_PKTBUF_SIZE])) {
-            return false;
+    void *chunk = _pktbuf_alloc(size);
+
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_MAGAZINE)
+    if (chunk == NULL) {
+        /* the chunks cached by other running threads are out of reach, but
+         * those of the calling thread and of exited threads are not */
+        bool flushed = false;
+
+        for (unsigned i = 0; i < CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_NUMOF; i++) {
+            _cache_t *cache = &_caches[i];
+
+            if ((cache->owner == KERNEL_PID_UNDEF) || (cache->bytes == 0)) {
+                continue;
+            }
+            if (_cache_orphaned(cache)) {
+                DEBUG("pktbuf: arena exhausted, releasing cache of exited "
+                      "thread %u\n", (unsigned)cache->owner);
+                _cache_release(cache);
+                flushed = true;
+            }
+            else if (!irq_is_in() && (cache->owner == thread_getpid())) {
+                DEBUG("pktbuf: arena exhausted, flushing cache of thread %u\n",
+                      (unsigned)cache->owner);
+                _cache_flush(cache);
+                flushed = true;
+            }
         }
-        if ((ptr->next != NULL) && (ptr >= ptr->next)) {
-            return false;
+        if (flushed) {
+            chunk = _pktbuf_alloc(size);
         }
-        size_t pos_in_buf = (uint8_t *)ptr - &_static_buf[0];
-        if (((ptr->next == NULL) || (ptr->size > (size_t)((uint8_t *)(ptr->next) - (uint8_t *)ptr)))
-            && ((ptr->next != NULL) || (ptr->size != CONFIG_GNRC_PKTBUF_SIZE - pos_in_buf))) {
-            return false;
-        }
-        ptr = ptr->next;
     }
-
-    return true;
-}
 #endif
+    return chunk;
+}
 
 static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
                                     gnrc_nettype_t type)
 {
-    gnrc_pktsnip_t *pkt = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    gnrc_pktsnip_t *pkt = _snip_alloc();
     void *_data = NULL;
 
     if (pkt == NULL) {
@@ -360,11 +464,21 @@ static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size
         return NULL;
     }
     if (size > 0) {
-        _data = _pktbuf_alloc(size);
+        _data = _arena_alloc(size);
         if (_data == NULL) {
             DEBUG("pktbuf: error allocating data for new packet snip\n");
             gnrc_pktbuf_free_internal(pkt, sizeof(gnrc_pktsnip_t));
-            return NULL;
+            if (!IS_USED(MODULE_GNRC_PKTBUF_STATIC_MAGAZINE) ||
+                ((_data = _pktbuf_alloc(size)) == NULL)) {
+                return NULL;
+            }
+            /* flushing the cache of this thread freed enough space, but the
+             * descriptor allocated before split it */
+            pkt = _snip_alloc();
+            if (pkt == NULL) {
+                gnrc_pktbuf_free_internal(_data, size);
+                return NULL;
+            }
         }
         if (data != NULL) {
             memcpy(_data, data, size);
@@ -374,151 +488,274 @@ static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size
     return pkt;
 }
 
-static void *_pktbuf_alloc(size_t size)
+void gnrc_pktbuf_free_internal(void *data, size_t size)
 {
-    _unused_t *prev = NULL, *ptr = _first_unused;
-
-    size = _align(size);
-    while (ptr && (size > ptr->size)) {
-        prev = ptr;
-        ptr = ptr->next;
-    }
-    if (ptr == NULL) {
-        DEBUG("pktbuf: no space left in packet buffer\n");
-        return NULL;
-    }
-    /* _unused_t struct would fit => add new space at ptr */
-    if (sizeof(_unused_t) > (ptr->size - size)) {
-        if (prev == NULL) { /* ptr was _first_unused */
-            _first_unused = ptr->next;
-        }
-        else {
-            prev->next = ptr->next;
+    if (_snip_slab_contains(data)) {
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SNIP_SLAB)
+        assert(size == sizeof(gnrc_pktsnip_t));
+        if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+            memset(data, GNRC_PKTBUF_CANARY, size);
         }
+        memarray_free(&_snip_slab, data);
+#ifdef DEVELHELP
+        _snip_slab_used--;
+#endif
+#endif
+        return;
     }
-    else {
-        /* alignment is ensured by rounding size up in the _align() function.
-         * We cast to uintptr_t as intermediate step to silence -Wcast-align */
-        _unused_t *new = (_unused_t *)((uintptr_t)ptr + size);
-
-        if (((((uint8_t *)new) - &(_static_buf[0])) + sizeof(_unused_t))
-            > CONFIG_GNRC_PKTBUF_SIZE) {
-            /* content of new would exceed packet buffer size so set to NULL */
-            _first_unused = NULL;
-        }
-        else if (prev == NULL) { /* ptr was _first_unused */
-            _first_unused = new;
+    _pktbuf_free(data, size);
+}
+
+bool gnrc_pktbuf_contains(void *ptr)
+{
+    return _snip_slab_contains(ptr) || _pktbuf_contains(ptr);
+}
+
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_MAGAZINE)
+/* true if the thread owning @p cache exited, even if its PID was reused
+ * since. A new thread on the stack of the exited one cannot be told apart,
+ * but it then inherits the cache and no other thread uses it.
+ * Requires gnrc_pktbuf_mutex to be locked. */
+static bool _cache_orphaned(const _cache_t *cache)
+{
+    unsigned i = cache->owner - KERNEL_PID_FIRST;
+
+    return thread_get(cache->owner) != _cache_thread[i];
+}
+
+/* returns the chunks of @p cache to the arena and unbinds it from its owner.
+ * Requires gnrc_pktbuf_mutex to be locked. */
+static void _cache_release(_cache_t *cache)
+{
+    _cache_flush(cache);
+    _cache_of[cache->owner - KERNEL_PID_FIRST] = 0;
+    memset(cache, 0, sizeof(*cache));
+}
+
+/* claims a cache for the calling thread, reclaiming those of exited threads.
+ * Requires gnrc_pktbuf_mutex to be locked. */
+static uint8_t _cache_claim(kernel_pid_t pid)
+{
+    uint8_t *idx = &_cache_of[pid - KERNEL_PID_FIRST];
+
+    if ((*idx != 0) && (*idx != CACHE_NONE)) {
+        /* a previous thread with this PID exited without releasing it */
+        _cache_release(&_caches[*idx - 1]);
+    }
+    _cache_thread[pid - KERNEL_PID_FIRST] = thread_get_active();
+    *idx = CACHE_NONE;
+    for (unsigned i = 0; i < CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_NUMOF; i++) {
+        _cache_t *cache = &_caches[i];
+
+        if ((cache->owner != KERNEL_PID_UNDEF) && _cache_orphaned(cache)) {
+            DEBUG("pktbuf: reclaiming cache of exited thread %u\n",
+                  (unsigned)cache->owner);
+            _cache_release(cache);
         }
-        else {
-            prev->next = new;
+        if (cache->owner == KERNEL_PID_UNDEF) {
+            cache->owner = pid;
+            *idx = i + 1;
+            break;
         }
-        new->next = ptr->next;
-        new->size = ptr->size - size;
-    }
-#ifdef DEVELHELP
-    uint16_t last_byte = (uint16_t)((((uint8_t *)ptr) + size) - &(_static_buf[0]));
-    if (last_byte > max_byte_count) {
-        max_byte_count = last_byte;
     }
-#endif
+    return *idx;
+}
 
-    const void *mismatch;
-    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE &&
-        (mismatch = memchk(ptr + 1, GNRC_PKTBUF_CANARY, size - sizeof(_unused_t)))) {
-        printf("[%p] mismatch at offset %"PRIuPTR"/%" PRIuSIZE
-               " (ignoring %" PRIuSIZE " initial bytes that were repurposed)\n",
-               (void *)ptr, (uintptr_t)mismatch - (uintptr_t)ptr, size, sizeof(_unused_t));
-#ifdef MODULE_OD
-        od_hex_dump(ptr, size, 0);
-#endif
-        assert(0);
+static _cache_t *_cache_get(void)
+{
+    kernel_pid_t pid = thread_getpid();
+    uint8_t idx;
+
+    if (irq_is_in() || !pid_is_valid(pid)) {
+        return NULL;
     }
-    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
-        /* clear out canary */
-        memset(ptr, ~GNRC_PKTBUF_CANARY, size);
+    idx = _cache_of[pid - KERNEL_PID_FIRST];
+    if ((idx == 0) ||
+        (_cache_thread[pid - KERNEL_PID_FIRST] != thread_get_active())) {
+        /* first allocation of this thread or PID reused since */
+        gnrc_pktbuf_lock();
+        idx = _cache_claim(pid);
+        gnrc_pktbuf_unlock();
     }
+    return (idx == CACHE_NONE) ? NULL : &_caches[idx - 1];
+}
 
-    return (void *)ptr;
+/* magazine for @p size bytes of data, 0 if not cached */
+static unsigned _magazine_idx(size_t size)
+{
+    size_t aligned = _align(size);
+
+    return (aligned <= CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_CHUNK_MAX)
+           ? (aligned / sizeof(_unused_t)) : 0;
 }
 
-static inline bool _too_small_hole(_unused_t *a, _unused_t *b)
+static size_t _magazine_chunk_size(unsigned mag)
 {
-    return sizeof(_unused_t) > (size_t)(((uint8_t *)b) - (((uint8_t *)a) + a->size));
+    return (mag == 0) ? sizeof(gnrc_pktsnip_t) : (mag * sizeof(_unused_t));
 }
 
-static inline _unused_t *_merge(_unused_t *a, _unused_t *b)
+static void _magazine_push(_cache_t *cache, unsigned mag, void *chunk)
 {
-    assert(b != NULL);
+    size_t size = _magazine_chunk_size(mag);
 
-    a->next = b->next;
-    a->size = b->size + ((uint8_t *)b - (uint8_t *)a);
     if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
-        memset(b, GNRC_PKTBUF_CANARY, sizeof(*b));
+        memset(chunk, GNRC_PKTBUF_CANARY, size);
     }
-    return a;
+    *((void **)chunk) = cache->mags[mag].chunks;
+    cache->mags[mag].chunks = chunk;
+    cache->mags[mag].numof++;
+    cache->bytes += size;
 }
 
-void gnrc_pktbuf_free_internal(void *data, size_t size)
+static void *_magazine_pop(_cache_t *cache, unsigned mag)
 {
-    size_t bytes_at_end;
-    _unused_t *new = (_unused_t *)data, *prev = NULL, *ptr = _first_unused;
+    void *chunk = cache->mags[mag].chunks;
+    size_t size = _magazine_chunk_size(mag);
 
-    if (data == NULL) {
-        return;
+    cache->mags[mag].chunks = *((void **)chunk);
+    cache->mags[mag].numof--;
+    cache->bytes -= size;
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+        memset(chunk, ~GNRC_PKTBUF_CANARY, size);
     }
+    return chunk;
+}
 
-    if (!gnrc_pktbuf_contains(data)) {
-        assert(0);
-        return;
+/* requires gnrc_pktbuf_mutex to be locked */
+static void _magazine_drain(_cache_t *cache, unsigned mag, unsigned numof)
+{
+    while ((numof-- > 0) && (cache->mags[mag].numof > 0)) {
+        gnrc_pktbuf_free_internal(_magazine_pop(cache, mag),
+                                  _magazine_chunk_size(mag));
     }
+}
 
-    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
-        /* check if the data has already been marked as free */
-        size_t chk_len = _align(size) - sizeof(*new);
-        if (chk_len &&
-            !memchk((uint8_t *)data + sizeof(*new), GNRC_PKTBUF_CANARY, chk_len)) {
-            printf("pktbuf: double free detected! (at %p, len=%u)\n",
-                   data, (unsigned)_align(size));
-            DEBUG_BREAKPOINT(2);
+/* requires gnrc_pktbuf_mutex to be locked */
+static void _cache_flush(_cache_t *cache)
+{
+    for (unsigned mag = 0; mag < MAGAZINE_NUMOF; mag++) {
+        _magazine_drain(cache, mag, UINT_MAX);
+    }
+}
+
+static void *_magazine_alloc(_cache_t *cache, unsigned mag)
+{
+    if (cache->mags[mag].numof == 0) {
+        /* refill a batch at once to only lock once for a number of
+         * allocations */
+        gnrc_pktbuf_lock();
+        for (unsigned i = 0; i < MAGAZINE_BATCH; i++) {
+            if ((i > 0) && ((cache->bytes + _magazine_chunk_size(mag)) >
+                            CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_BYTES)) {
+                /* do not exceed the budget of the cache */
+                break;
+            }
+            /* not _arena_alloc(), that would flush the cache on failure */
+            void *chunk = (mag == 0) ? _snip_slab_alloc() : NULL;
+
+            if (chunk == NULL) {
+                chunk = _pktbuf_alloc(_magazine_chunk_size(mag));
+            }
+            if (chunk == NULL) {
+                break;
+            }
+            _magazine_push(cache, mag, chunk);
         }
-        memset(data, GNRC_PKTBUF_CANARY, _align(size));
+        gnrc_pktbuf_unlock();
+#ifdef DEVELHELP
+        cache->refills++;
+#endif
+        if (cache->mags[mag].numof == 0) {
+            return NULL;
+        }
+    }
+#ifdef DEVELHELP
+    else {
+        cache->hits++;
     }
+#endif
+    return _magazine_pop(cache, mag);
+}
 
-    while (ptr && (((void *)ptr) < data)) {
-        prev = ptr;
-        ptr = ptr->next;
+static void _magazine_free(_cache_t *cache, unsigned mag, void *chunk)
+{
+    bool full = cache->mags[mag].numof >= CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_SIZE;
+
+    if (full || ((cache->bytes + _magazine_chunk_size(mag)) >
+                 CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_BYTES)) {
+        /* drain a batch at once to only lock once for a number of
+         * releases */
+        gnrc_pktbuf_lock();
+        gnrc_pktbuf_free_internal(chunk, _magazine_chunk_size(mag));
+        if (full) {
+            _magazine_drain(cache, mag, MAGAZINE_BATCH - 1);
+        }
+        else {
+            /* halve all magazines, so the next releases fit again */
+            for (unsigned i = 0; i < MAGAZINE_NUMOF; i++) {
+                _magazine_drain(cache, i, (cache->mags[i].numof + 1) / 2);
+            }
+        }
+        gnrc_pktbuf_unlock();
+#ifdef DEVELHELP
+        cache->drains++;
+#endif
+        return;
     }
-    new->next = ptr;
-    new->size = _align(size);
-    /* calculate number of bytes between new _unused_t chunk and end of packet
-     * buffer */
-    bytes_at_end = ((&_static_buf[0] + CONFIG_GNRC_PKTBUF_SIZE)
-                   - (((uint8_t *)new) + new->size));
-    if (bytes_at_end < sizeof(_unused_t)) {
-        /* new is very last segment and there is a little bit of memory left
-         * that wouldn't fit _unused_t (cut of in _pktbuf_alloc()) => re-add it */
-        new->size += bytes_at_end;
+#ifdef DEVELHELP
+    cache->hits++;
+#endif
+    _magazine_push(cache, mag, chunk);
+}
+
+static gnrc_pktsnip_t *_magazine_create_snip(gnrc_pktsnip_t *next,
+                                             const void *data, size_t size,
+                                             gnrc_nettype_t type)
+{
+    _cache_t *cache;
+    unsigned mag = _magazine_idx(size);
+    gnrc_pktsnip_t *pkt;
+    void *_data = NULL;
+
+    if (((size > 0) && (mag == 0)) || ((cache = _cache_get()) == NULL)) {
+        return NULL;
     }
-    if (prev == NULL) { /* ptr was _first_unused or data before _first_unused */
-        _first_unused = new;
+    pkt = _magazine_alloc(cache, 0);
+    if (pkt == NULL) {
+        return NULL;
     }
-    else {
-        prev->next = new;
-        if (_too_small_hole(prev, new)) {
-            new = _merge(prev, new);
+    if (size > 0) {
+        _data = _magazine_alloc(cache, mag);
+        if (_data == NULL) {
+            _magazine_free(cache, 0, pkt);
+            return NULL;
+        }
+        if (data != NULL) {
+            memcpy(_data, data, size);
         }
     }
-    if ((new->next != NULL) && (_too_small_hole(new, new->next))) {
-        _merge(new, new->next);
-    }
+    _set_pktsnip(pkt, next, _data, size, type);
+    return pkt;
 }
 
-bool gnrc_pktbuf_contains(void *ptr)
+bool gnrc_pktbuf_magazine_release(gnrc_pktsnip_t *pkt, uint32_t err)
 {
-    const uintptr_t start = (uintptr_t)_static_buf;
-    const uintptr_t end = start + sizeof(_static_buf);
-    uintptr_t pos = (uintptr_t)ptr;
-    return ((pos >= start) && (pos < end));
+    _cache_t *cache;
+    unsigned mag = _magazine_idx(pkt->size);
+
+    if (((pkt->size > 0) && (mag == 0)) || ((cache = _cache_get()) == NULL)) {
+        return false;
+    }
+    pkt->users = 0;
+    if (pkt->data != NULL) {
+        _magazine_free(cache, mag, pkt->data);
+    }
+    _magazine_free(cache, 0, pkt);
+    /* same order as under the lock in gnrc_pktbuf_release_error() */
+    DEBUG("pktbuf: report status code %" PRIu32 "\n", err);
+    gnrc_neterr_report(pkt, err);
+    return true;
 }
+#endif
 
 /** @} */
@@ -21,6 +21,7 @@
  * @author  Martine Lenders <m.lenders@fu-berlin.de>
  */
 
+#include <stdbool.h>
 #include <sys/types.h>
 
 #ifdef __cplusplus
@@ -50,6 +51,68 @@ static inline size_t _align(size_t size)
           ~(GNRC_PKTBUF_STATIC_ALIGN_MASK);
 }
 
+/**
+ * @name    Allocator of the packet buffer arena
+ *
+ * These functions are ***internal***. They are provided by the allocator of
+ * the packet buffer arena, i.e. either the default first-fit allocator or
+ * `gnrc_pktbuf_static_tlsf`, and are only called with
+ * @ref gnrc_pktbuf_mutex locked.
+ * @{
+ */
+/**
+ * @brief   Initializes the packet buffer arena
+ */
+void _pktbuf_init(void);
+
+/**
+ * @brief   Allocates a chunk of @p size bytes from the packet buffer arena
+ *
+ * @param[in] size  Number of bytes to allocate. Will be aligned with
+ *                  @ref _align().
+ *
+ * @return  Pointer to the allocated chunk
+ * @return  NULL, if no space is left in the packet buffer
+ */
+void *_pktbuf_alloc(size_t size);
+
+/**
+ * @brief   Returns a chunk to the packet buffer arena
+ *
+ * @param[in] data  Chunk allocated with @ref _pktbuf_alloc()
+ * @param[in] size  Size of @p data in bytes
+ */
+void _pktbuf_free(void *data, size_t size);
+
+/**
+ * @brief   Checks if @p ptr is within the packet buffer arena
+ *
+ * @param[in] ptr   Pointer to check
+ *
+ * @return  true, if @p ptr is within the packet buffer arena
+ */
+bool _pktbuf_contains(void *ptr);
+
+#if defined(DEVELHELP) || defined(DOXYGEN)
+/**
+ * @brief   Prints statistics of the packet buffer arena
+ */
+void _pktbuf_stats(void);
+#endif
+
+#if defined(TEST_SUITES) || defined(DOXYGEN)
+/**
+ * @brief   Checks if the packet buffer arena is empty
+ */
+bool _pktbuf_is_empty(void);
+
+/**
+ * @brief   Checks the allocator's internal invariants
+ */
+bool _pktbuf_is_sane(void);
+#endif
+/** @} */
+
 #ifdef __cplusplus
 }
 #endif
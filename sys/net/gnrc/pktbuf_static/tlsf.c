@@ -0,0 +1,452 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf
+ * @{
+ *
+ * @file
+ * @brief   Two-level segregated fit (TLSF) allocator for the arena of the
+ *          static packet buffer
+ *
+ * Free chunks are kept in doubly linked lists, one per size class. A size
+ * class is determined by the most significant bit of the chunk size
+ * (first level) and the @ref CONFIG_GNRC_PKTBUF_STATIC_TLSF_SL_LOG2 bits
+ * below it (second level). A bitmap per level allows to find a non-empty
+ * size class that is guaranteed to fit with a few bit operations, so
+ * allocation and release of a chunk do not depend on the number of chunks in
+ * the packet buffer.
+ *
+ * All offsets and sizes are stored in units of @ref _unused_t, so the
+ * management information of a free chunk fits into its first unit. The size
+ * of a free chunk is repeated in the last two bytes of its last unit, so a
+ * chunk being released can be merged with a free chunk in front of it without
+ * a search. Which units start or end a free chunk is tracked in a bitfield.
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bitarithm.h"
+#include "bitfield.h"
+#include "od.h"
+#include "net/gnrc/pktbuf.h"
+#include "string_utils.h"
+
+#include "pktbuf_internal.h"
+#include "pktbuf_static.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define UNIT_SIZE       ((unsigned)sizeof(_unused_t))   /**< allocation granularity */
+#define UNITS           (CONFIG_GNRC_PKTBUF_SIZE / UNIT_SIZE)   /**< arena size in units */
+#define NIL             UINT16_MAX                  /**< end of a free list */
+
+#define SL_LOG2         CONFIG_GNRC_PKTBUF_STATIC_TLSF_SL_LOG2
+#define SL_COUNT        (1U << SL_LOG2)             /**< second-level classes */
+
+/* binary logarithm of a 16-bit compile time constant */
+#define _LOG2_2(x)      (((x) & 0x2) ? 1 : 0)
+#define _LOG2_4(x)      (((x) & 0xc) ? (2 + _LOG2_2((x) >> 2)) : _LOG2_2(x))
+#define _LOG2_8(x)      (((x) & 0xf0) ? (4 + _LOG2_4((x) >> 4)) : _LOG2_4(x))
+#define _LOG2_16(x)     (((x) & 0xff00) ? (8 + _LOG2_8((x) >> 8)) : _LOG2_8(x))
+
+/**
+ * @brief   Number of first-level classes
+ *
+ * Sizes below @ref SL_COUNT units all map to first-level class 0.
+ */
+#define FL_COUNT        ((_LOG2_16(UNITS) >= SL_LOG2) ? \
+                         (_LOG2_16(UNITS) - SL_LOG2 + 2) : 1)
+
+static_assert((CONFIG_GNRC_PKTBUF_SIZE % sizeof(_unused_t)) == 0,
+              "CONFIG_GNRC_PKTBUF_SIZE has to be a multiple of sizeof(_unused_t)");
+static_assert(UNITS < NIL,
+              "CONFIG_GNRC_PKTBUF_SIZE is too large for gnrc_pktbuf_static_tlsf");
+static_assert((SL_LOG2 >= 1) && (SL_LOG2 <= 5),
+              "CONFIG_GNRC_PKTBUF_STATIC_TLSF_SL_LOG2 must be between 1 and 5");
+static_assert(FL_COUNT <= 32, "first-level bitmap too small");
+
+/**
+ * @brief   Management information at the start of a free chunk
+ */
+typedef struct {
+    uint16_t next;      /**< next free chunk in the same size class */
+    uint16_t prev;      /**< previous free chunk in the same size class */
+    uint16_t size;      /**< size of the free chunk in units */
+} _tlsf_free_t;
+
+static_assert(sizeof(_tlsf_free_t) + sizeof(uint16_t) <= UNIT_SIZE,
+              "free chunk header and footer need to fit into one unit, "
+              "gnrc_pktbuf_static_tlsf requires a 32 or 64 bit platform");
+
+static alignas(sizeof(_unused_t)) uint8_t _static_buf[CONFIG_GNRC_PKTBUF_SIZE];
+/* first units of free chunks in the free lists of each size class */
+static uint16_t _heads[FL_COUNT][SL_COUNT];
+/* set if a size class contains at least one free chunk */
+static uint32_t _fl_bitmap;
+static uint32_t _sl_bitmap[FL_COUNT];
+/* set for the first and last unit of each free chunk */
+static BITFIELD(_bounds, UNITS);
+
+#ifdef DEVELHELP
+/* bytes currently allocated */
+static unsigned _used;
+/* maximum number of bytes allocated at once */
+static unsigned _max_used;
+/* number of allocations that could not be served */
+static unsigned _alloc_fails;
+#endif
+
+static inline uint8_t *_unit(unsigned idx)
+{
+    return &_static_buf[idx * UNIT_SIZE];
+}
+
+static inline _tlsf_free_t *_chunk(unsigned idx)
+{
+    /* Silence false -Wcast-align: _static_buf has qualifier
+     * `alignas(_unused_t)` and idx is in units of _unused_t */
+    return (_tlsf_free_t *)(uintptr_t)_unit(idx);
+}
+
+static inline uint16_t *_footer(unsigned idx, unsigned size)
+{
+    return (uint16_t *)(uintptr_t)(_unit(idx + size) - sizeof(uint16_t));
+}
+
+static inline void _mapping(unsigned size, unsigned *fl, unsigned *sl)
+{
+    if (size < SL_COUNT) {
+        *fl = 0;
+        *sl = size;
+    }
+    else {
+        unsigned msb = bitarithm_msb(size);
+
+        *fl = msb - SL_LOG2 + 1;
+        *sl = (size >> (msb - SL_LOG2)) - SL_COUNT;
+    }
+}
+
+static void _insert(unsigned idx, unsigned size)
+{
+    _tlsf_free_t *chunk = _chunk(idx);
+    unsigned fl, sl;
+
+    _mapping(size, &fl, &sl);
+    chunk->size = size;
+    chunk->prev = NIL;
+    chunk->next = _heads[fl][sl];
+    if (chunk->next != NIL) {
+        _chunk(chunk->next)->prev = idx;
+    }
+    _heads[fl][sl] = idx;
+    _fl_bitmap |= 1UL << fl;
+    _sl_bitmap[fl] |= 1UL << sl;
+    *_footer(idx, size) = size;
+    bf_set(_bounds, idx);
+    bf_set(_bounds, idx + size - 1);
+}
+
+static void _remove(unsigned idx)
+{
+    _tlsf_free_t *chunk = _chunk(idx);
+    unsigned size = chunk->size;
+    unsigned fl, sl;
+
+    _mapping(size, &fl, &sl);
+    if (chunk->prev == NIL) {
+        _heads[fl][sl] = chunk->next;
+        if (chunk->next == NIL) {
+            _sl_bitmap[fl] &= ~(1UL << sl);
+            if (_sl_bitmap[fl] == 0) {
+                _fl_bitmap &= ~(1UL << fl);
+            }
+        }
+    }
+    else {
+        _chunk(chunk->prev)->next = chunk->next;
+    }
+    if (chunk->next != NIL) {
+        _chunk(chunk->next)->prev = chunk->prev;
+    }
+    bf_unset(_bounds, idx);
+    bf_unset(_bounds, idx + size - 1);
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+        memset(chunk, GNRC_PKTBUF_CANARY, sizeof(*chunk));
+        memset(_footer(idx, size), GNRC_PKTBUF_CANARY, sizeof(uint16_t));
+    }
+}
+
+static unsigned _find(unsigned size)
+{
+    unsigned fl, sl;
+    uint32_t sl_map;
+
+    /* round up to the next size class, so that any chunk in the found class
+     * is large enough */
+    if (size >= SL_COUNT) {
+        _mapping(size + (1U << (bitarithm_msb(size) - SL_LOG2)) - 1, &fl, &sl);
+    }
+    else {
+        _mapping(size, &fl, &sl);
+    }
+    if (fl < FL_COUNT) {
+        sl_map = _sl_bitmap[fl] & (UINT32_MAX << sl);
+        if (sl_map == 0) {
+            uint32_t fl_map = (fl + 1 < FL_COUNT)
+                            ? (_fl_bitmap & (UINT32_MAX << (fl + 1))) : 0;
+
+            if (fl_map != 0) {
+                fl = bitarithm_lsb(fl_map);
+                sl_map = _sl_bitmap[fl];
+            }
+        }
+        if (sl_map != 0) {
+            return _heads[fl][bitarithm_lsb(sl_map)];
+        }
+    }
+    /* all chunks in the class of size itself may still fit, but only some of
+     * them, so a search within that class is required */
+    _mapping(size, &fl, &sl);
+    for (unsigned idx = _heads[fl][sl]; idx != NIL; idx = _chunk(idx)->next) {
+        if (_chunk(idx)->size >= size) {
+            return idx;
+        }
+    }
+    return NIL;
+}
+
+void _pktbuf_init(void)
+{
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+        memset(_static_buf, GNRC_PKTBUF_CANARY, sizeof(_static_buf));
+    }
+    memset(_heads, 0xff, sizeof(_heads));
+    memset(_sl_bitmap, 0, sizeof(_sl_bitmap));
+    memset(_bounds, 0, sizeof(_bounds));
+    _fl_bitmap = 0;
+    _insert(0, UNITS);
+#ifdef DEVELHELP
+    _used = 0;
+    _max_used = 0;
+    _alloc_fails = 0;
+#endif
+}
+
+void *_pktbuf_alloc(size_t size)
+{
+    unsigned units = _align(size) / UNIT_SIZE;
+    unsigned idx, rest;
+
+    if ((units == 0) || (units > UNITS)) {
+        return NULL;
+    }
+    idx = _find(units);
+    if (idx == NIL) {
+        DEBUG("pktbuf: no space left in packet buffer\n");
+#ifdef DEVELHELP
+        _alloc_fails++;
+#endif
+        return NULL;
+    }
+    rest = _chunk(idx)->size - units;
+    _remove(idx);
+    if (rest > 0) {
+        _insert(idx + units, rest);
+    }
+#ifdef DEVELHELP
+    _used += units * UNIT_SIZE;
+    if (_used > _max_used) {
+        _max_used = _used;
+    }
+#endif
+
+    const void *mismatch;
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE &&
+        (mismatch = memchk(_unit(idx), GNRC_PKTBUF_CANARY, units * UNIT_SIZE))) {
+        printf("[%p] mismatch at offset %"PRIuPTR"/%u\n",
+               (void *)_unit(idx), (uintptr_t)mismatch - (uintptr_t)_unit(idx),
+               (unsigned)(units * UNIT_SIZE));
+#ifdef MODULE_OD
+        od_hex_dump(_unit(idx), units * UNIT_SIZE, 0);
+#endif
+        assert(0);
+    }
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+        /* clear out canary */
+        memset(_unit(idx), ~GNRC_PKTBUF_CANARY, units * UNIT_SIZE);
+    }
+
+    return _unit(idx);
+}
+
+void _pktbuf_free(void *data, size_t size)
+{
+    unsigned idx, units = _align(size) / UNIT_SIZE;
+
+    if (data == NULL) {
+        return;
+    }
+
+    if (!_pktbuf_contains(data)) {
+        assert(0);
+        return;
+    }
+
+    idx = ((uint8_t *)data - _static_buf) / UNIT_SIZE;
+    assert(((uint8_t *)data - _static_buf) % UNIT_SIZE == 0);
+
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+        /* check if the data has already been marked as free (ignoring
+         * first and last unit that may hold management information) */
+        if ((units > 2) &&
+            !memchk(_unit(idx + 1), GNRC_PKTBUF_CANARY,
+                    (units - 2) * UNIT_SIZE)) {
+            printf("pktbuf: double free detected! (at %p, len=%u)\n",
+                   data, (unsigned)(units * UNIT_SIZE));
+            DEBUG_BREAKPOINT(2);
+        }
+        memset(data, GNRC_PKTBUF_CANARY, units * UNIT_SIZE);
+    }
+    if (units == 0) {
+        return;
+    }
+#ifdef DEVELHELP
+    _used -= units * UNIT_SIZE;
+#endif
+    /* merge with free chunk in front */
+    if ((idx > 0) && bf_isset(_bounds, idx - 1)) {
+        unsigned prev_size = *_footer(0, idx);
+
+        idx -= prev_size;
+        units += prev_size;
+        _remove(idx);
+    }
+    /* merge with free chunk behind */
+    if (((idx + units) < UNITS) && bf_isset(_bounds, idx + units)) {
+        unsigned next = idx + units;
+
+        units += _chunk(next)->size;
+        _remove(next);
+    }
+    _insert(idx, units);
+}
+
+bool _pktbuf_contains(void *ptr)
+{
+    const uintptr_t start = (uintptr_t)_static_buf;
+    const uintptr_t end = start + sizeof(_static_buf);
+    uintptr_t pos = (uintptr_t)ptr;
+    return ((pos >= start) && (pos < end));
+}
+
+#ifdef DEVELHELP
+void _pktbuf_stats(void)
+{
+    unsigned free_chunks = 0, free_units = 0, largest = 0;
+
+    printf("packet buffer: first byte: %p, last byte: %p (size: %u)\n",
+           (void *)&_static_buf[0],
+           (void *)&_static_buf[CONFIG_GNRC_PKTBUF_SIZE],
+           CONFIG_GNRC_PKTBUF_SIZE);
+    printf("  allocator: TLSF (%u x %u size classes)\n", (unsigned)FL_COUNT,
+           (unsigned)SL_COUNT);
+    for (unsigned fl = 0; fl < FL_COUNT; fl++) {
+        for (unsigned sl = 0; sl < SL_COUNT; sl++) {
+            for (unsigned idx = _heads[fl][sl]; idx != NIL;
+                 idx = _chunk(idx)->next) {
+                free_chunks++;
+                free_units += _chunk(idx)->size;
+                if (_chunk(idx)->size > largest) {
+                    largest = _chunk(idx)->size;
+                }
+            }
+        }
+    }
+    printf("  used: %u bytes (max: %u bytes)\n", _used, _max_used);
+    printf("  free: %u bytes in %u chunks (largest: %u bytes)\n",
+           free_units * UNIT_SIZE, free_chunks, largest * UNIT_SIZE);
+    /* share of free memory not usable for an allocation of the largest
+     * free chunk's size */
+    printf("  fragmentation: %u%%\n",
+           (free_units) ? (100 - ((100 * largest) / free_units)) : 0);
+    printf("  failed allocations: %u\n", _alloc_fails);
+}
+#endif
+
+#ifdef TEST_SUITES
+bool _pktbuf_is_empty(void)
+{
+    return bf_isset(_bounds, 0) && (_chunk(0)->size == UNITS);
+}
+
+bool _pktbuf_is_sane(void)
+{
+    unsigned free_chunks = 0;
+    unsigned bounds = 0;
+
+    /* Invariants of this implementation:
+     *  - each chunk in the free list of size class (fl, sl) maps to (fl, sl)
+     *  - the free lists are properly doubly linked
+     *  - first and last unit of each free chunk are marked in _bounds and the
+     *    footer matches the size
+     *  - no two free chunks are adjacent
+     *  - the bitmaps mark exactly the non-empty size classes
+     *  - the number of units marked in _bounds matches the free chunks
+     */
+    for (unsigned fl = 0; fl < FL_COUNT; fl++) {
+        if (!!(_fl_bitmap & (1UL << fl)) != (_sl_bitmap[fl] != 0)) {
+            return false;
+        }
+        for (unsigned sl = 0; sl < SL_COUNT; sl++) {
+            unsigned prev = NIL;
+
+            if (!!(_sl_bitmap[fl] & (1UL << sl)) != (_heads[fl][sl] != NIL)) {
+                return false;
+            }
+            for (unsigned idx = _heads[fl][sl]; idx != NIL;
+                 idx = _chunk(idx)->next) {
+                _tlsf_free_t *chunk = _chunk(idx);
+                unsigned cfl, csl;
+
+                if ((idx >= UNITS) || (chunk->size == 0) ||
+                    ((idx + chunk->size) > UNITS) || (chunk->prev != prev)) {
+                    return false;
+                }
+                _mapping(chunk->size, &cfl, &csl);
+                if ((cfl != fl) || (csl != sl) ||
+                    !bf_isset(_bounds, idx) ||
+                    !bf_isset(_bounds, idx + chunk->size - 1) ||
+                    (*_footer(idx, chunk->size) != chunk->size)) {
+                    return false;
+                }
+                if (((idx + chunk->size) < UNITS) &&
+                    bf_isset(_bounds, idx + chunk->size)) {
+                    return false;
+                }
+                free_chunks++;
+                prev = idx;
+            }
+        }
+    }
+    for (unsigned idx = 0; idx < UNITS; idx++) {
+        if (bf_isset(_bounds, idx)) {
+            bounds++;
+        }
+    }
+    /* single unit chunks only have one unit marked */
+    return (bounds <= (2 * free_chunks)) && (bounds >= free_chunks);
+}
+#endif
+
+/** @} */
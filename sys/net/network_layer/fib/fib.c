@@ -37,6 +37,7 @@
 #include "debug.h"
 
 #include "architecture.h"
+#include "container.h"
 #include "net/fib.h"
 #include "net/fib/table.h"
 
@@ -68,6 +69,300 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
     *target = xtimer_now_usec64() + (ms * US_PER_MS);
 }
 
+#if IS_USED(MODULE_FIB_LPM)
+/*
+ * Longest prefix match trie
+ *
+ * Every entry of a single hop table is a node of a path compressed binary
+ * trie. Its key consists of the leading `bits` bits of its destination
+ * address: the prefix length for prefix entries, none for default routes
+ * (all-zero addresses) and the whole address for all other entries. So all
+ * entries that may match a destination address are found on the path to it,
+ * the deepest one being the longest prefix match.
+ *
+ * Where the keys below a node diverge and no entry has the common prefix as
+ * key, a branching node without entry is put into the trie. A trie with n
+ * entries needs less than n of them, so every entry provides one in
+ * fib_entry_t::lpm[1] that may be used for any entry. Entries that have the
+ * same key (e.g. addresses of different sizes, or the same prefix with
+ * differing host bits) are chained to the node in the trie using `dup`.
+ */
+
+static inline unsigned _lpm_bit(const uint8_t *key, unsigned pos)
+{
+    return (key[pos >> 3] >> (7 - (pos & 7))) & 1;
+}
+
+static inline fib_entry_t *_lpm_entry(fib_lpm_node_t *node)
+{
+    return container_of(node, fib_entry_t, lpm[0]);
+}
+
+static inline const uint8_t *_lpm_key(fib_lpm_node_t *node)
+{
+    return _lpm_entry(node)->global->address;
+}
+
+/* number of leading bits a and b have in common, at most max */
+static unsigned _lpm_common(const uint8_t *a, const uint8_t *b, unsigned max)
+{
+    unsigned i = 0;
+
+    while (((i + 8) <= max) && (a[i >> 3] == b[i >> 3])) {
+        i += 8;
+    }
+    while ((i < max) && (_lpm_bit(a, i) == _lpm_bit(b, i))) {
+        i++;
+    }
+    return i;
+}
+
+static unsigned _lpm_key_bits(const fib_entry_t *entry)
+{
+    const universal_address_container_t *global = entry->global;
+    unsigned max = global->address_size << 3;
+    bool is_all_zeros_addr = true;
+
+    for (size_t i = 0; i < global->address_size; ++i) {
+        if (global->address[i] != 0) {
+            is_all_zeros_addr = false;
+            break;
+        }
+    }
+    if (is_all_zeros_addr) {
+        /* default route, matches everything */
+        return 0;
+    }
+    if (entry->global_flags & FIB_FLAG_NET_PREFIX_MASK) {
+        unsigned prefix_len = (entry->global_flags & FIB_FLAG_NET_PREFIX_MASK)
+                              >> FIB_FLAG_NET_PREFIX_SHIFT;
+        return (prefix_len < max) ? prefix_len : max;
+    }
+    return max;
+}
+
+/* puts repl (may be NULL) into the place of node in the trie */
+static void _lpm_replace(fib_table_t *table, fib_lpm_node_t *node,
+                         fib_lpm_node_t *repl)
+{
+    fib_lpm_node_t *parent = node->parent;
+
+    if (repl != NULL) {
+        repl->parent = parent;
+    }
+    if (parent == NULL) {
+        table->lpm_root = repl;
+    }
+    else {
+        parent->child[parent->child[1] == node] = repl;
+    }
+}
+
+static void _lpm_set_child(fib_lpm_node_t *parent, unsigned dir,
+                           fib_lpm_node_t *child)
+{
+    parent->child[dir] = child;
+    if (child != NULL) {
+        child->parent = parent;
+    }
+}
+
+/* moves the children of node to repl */
+static void _lpm_move_children(fib_lpm_node_t *node, fib_lpm_node_t *repl)
+{
+    _lpm_set_child(repl, 0, node->child[0]);
+    _lpm_set_child(repl, 1, node->child[1]);
+}
+
+static fib_lpm_node_t *_lpm_branch_alloc(fib_table_t *table, unsigned bits)
+{
+    for (size_t i = 0; i < table->size; ++i) {
+        fib_lpm_node_t *branch = &table->data.entries[i].lpm[1];
+        if (!branch->branch) {
+            branch->branch = true;
+            branch->bits = bits;
+            return branch;
+        }
+    }
+    /* there are always less branching nodes than entries */
+    assert(false);
+    return NULL;
+}
+
+static void _lpm_branch_free(fib_lpm_node_t *branch)
+{
+    memset(branch, 0, sizeof(*branch));
+}
+
+static void _lpm_insert(fib_table_t *table, fib_entry_t *entry)
+{
+    fib_lpm_node_t *node = &entry->lpm[0];
+    const uint8_t *key = entry->global->address;
+    unsigned bits = _lpm_key_bits(entry);
+    fib_lpm_node_t *x = table->lpm_root;
+
+    memset(node, 0, sizeof(*node));
+    node->bits = bits;
+
+    if (x == NULL) {
+        table->lpm_root = node;
+        return;
+    }
+
+    /* find an entry that shares the longest possible prefix with key */
+    while ((x->bits < bits) && (x->child[_lpm_bit(key, x->bits)] != NULL)) {
+        x = x->child[_lpm_bit(key, x->bits)];
+    }
+    while (x->branch) {
+        x = x->child[0];
+    }
+
+    const uint8_t *other = _lpm_key(x);
+    unsigned common = _lpm_common(key, other, (bits < x->bits) ? bits : x->bits);
+
+    /* find the place of the new node on the path to that entry */
+    fib_lpm_node_t *parent = NULL;
+    x = table->lpm_root;
+    while ((x != NULL) &&
+           ((x->bits < common) || ((x->bits == common) && (common < bits)))) {
+        parent = x;
+        x = x->child[_lpm_bit(key, x->bits)];
+    }
+
+    if (x == NULL) {
+        _lpm_set_child(parent, _lpm_bit(key, parent->bits), node);
+    }
+    else if (x->bits == common) {
+        /* same key */
+        if (x->branch) {
+            _lpm_replace(table, x, node);
+            _lpm_move_children(x, node);
+            _lpm_branch_free(x);
+        }
+        else {
+            node->dup = x->dup;
+            x->dup = node;
+        }
+    }
+    else if (common == bits) {
+        /* key is a prefix of the keys below x */
+        _lpm_replace(table, x, node);
+        _lpm_set_child(node, _lpm_bit(other, bits), x);
+    }
+    else {
+        fib_lpm_node_t *branch = _lpm_branch_alloc(table, common);
+
+        _lpm_replace(table, x, branch);
+        _lpm_set_child(branch, _lpm_bit(key, common), node);
+        _lpm_set_child(branch, _lpm_bit(other, common), x);
+    }
+}
+
+static void _lpm_remove(fib_table_t *table, fib_entry_t *entry)
+{
+    fib_lpm_node_t *node = &entry->lpm[0];
+    const uint8_t *key = entry->global->address;
+    fib_lpm_node_t *x = table->lpm_root;
+
+    /* find the node in the trie that holds the key of the entry */
+    while (x->bits < node->bits) {
+        x = x->child[_lpm_bit(key, x->bits)];
+    }
+
+    if (x != node) {
+        /* entry is chained to another one with the same key */
+        while (x->dup != node) {
+            x = x->dup;
+        }
+        x->dup = node->dup;
+        return;
+    }
+
+    if (node->dup != NULL) {
+        _lpm_replace(table, node, node->dup);
+        _lpm_move_children(node, node->dup);
+    }
+    else if ((node->child[0] != NULL) && (node->child[1] != NULL)) {
+        fib_lpm_node_t *branch = _lpm_branch_alloc(table, node->bits);
+
+        _lpm_replace(table, node, branch);
+        _lpm_move_children(node, branch);
+    }
+    else {
+        fib_lpm_node_t *parent = node->parent;
+        fib_lpm_node_t *child = (node->child[0] != NULL) ? node->child[0]
+                                                         : node->child[1];
+
+        _lpm_replace(table, node, child);
+        /* drop a branching node that is left with a single child */
+        if ((child == NULL) && (parent != NULL) && parent->branch) {
+            fib_lpm_node_t *sibling = (parent->child[0] != NULL) ? parent->child[0]
+                                                                 : parent->child[1];
+            _lpm_replace(table, parent, sibling);
+            _lpm_branch_free(parent);
+        }
+    }
+}
+
+/**
+ * @brief looks up the entry for the given destination address in the trie
+ *
+ * @param[in] table         the FIB table to search in
+ * @param[in] dst           the destination address
+ * @param[in] dst_size      the destination address size
+ * @param[in] now           the current time
+ * @param[out] entry        the found entry, or an expired entry on the path
+ *
+ * @return 0 if we found a next-hop prefix
+ *         1 if we found the exact address next-hop
+ *         -EHOSTUNREACH if no fitting next-hop is available
+ *         -EAGAIN if an expired entry has been found and needs to be removed
+ */
+static int fib_lpm_find(fib_table_t *table, uint8_t *dst, size_t dst_size,
+                        uint64_t now, fib_entry_t **entry)
+{
+    unsigned dst_bits = dst_size << 3;
+    fib_lpm_node_t *x = table->lpm_root;
+    int ret = -EHOSTUNREACH;
+
+    while ((x != NULL) && (x->bits <= dst_bits)) {
+        if (!x->branch) {
+            /* all further nodes share the key of this one */
+            if (_lpm_common(_lpm_key(x), dst, x->bits) < x->bits) {
+                break;
+            }
+            for (fib_lpm_node_t *n = x; n != NULL; n = n->dup) {
+                fib_entry_t *e = _lpm_entry(n);
+
+                if ((e->lifetime != FIB_LIFETIME_NO_EXPIRE) && (e->lifetime < now)) {
+                    *entry = e;
+                    return -EAGAIN;
+                }
+                if (e->global->address_size != dst_size) {
+                    continue;
+                }
+                if (memcmp(e->global->address, dst, dst_size) == 0) {
+                    *entry = e;
+                    return 1;
+                }
+                if (n->bits < dst_bits) {
+                    *entry = e;
+                    ret = 0;
+                }
+            }
+        }
+        if (x->bits == dst_bits) {
+            break;
+        }
+        x = x->child[_lpm_bit(dst, x->bits)];
+    }
+
+    return ret;
+}
+#endif
+
+static int fib_remove(fib_table_t *table, fib_entry_t *entry);
+
 /**
  * @brief returns pointer to the entry for the given destination address
  *
@@ -86,6 +381,17 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
                           fib_entry_t **entry_arr, size_t *entry_arr_size) {
     uint64_t now = xtimer_now_usec64();
 
+#if IS_USED(MODULE_FIB_LPM)
+    int lpm_ret;
+
+    while ((lpm_ret = fib_lpm_find(table, dst, dst_size, now, &entry_arr[0])) == -EAGAIN) {
+        /* remove this entry since its lifetime expired */
+        fib_remove(table, entry_arr[0]);
+    }
+    *entry_arr_size = (lpm_ret >= 0);
+    return lpm_ret;
+#endif
+
     size_t count = 0;
     size_t prefix_size = 0;
     size_t match_size = dst_size << 3;
@@ -250,7 +556,19 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
                             uint8_t *next_hop, size_t next_hop_size, uint32_t
                             next_hop_flags, uint32_t lifetime)
 {
+#if IS_USED(MODULE_FIB_LPM)
+    uint64_t now = xtimer_now_usec64();
+#endif
+
     for (size_t i = 0; i < table->size; ++i) {
+#if IS_USED(MODULE_FIB_LPM)
+        /* lookups only remove expired entries on their path, so reuse others */
+        if ((table->data.entries[i].lifetime != 0)
+            && (table->data.entries[i].lifetime != FIB_LIFETIME_NO_EXPIRE)
+            && (table->data.entries[i].lifetime < now)) {
+            fib_remove(table, &table->data.entries[i]);
+        }
+#endif
         if (table->data.entries[i].lifetime == 0) {
 
             table->data.entries[i].global = universal_address_add(dst, dst_size);
@@ -271,6 +589,9 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
                 else {
                     table->data.entries[i].lifetime = FIB_LIFETIME_NO_EXPIRE;
                 }
+#if IS_USED(MODULE_FIB_LPM)
+                _lpm_insert(table, &table->data.entries[i]);
+#endif
 
                 return 0;
             }
@@ -283,12 +604,22 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
 /**
  * @brief removes the given entry
  *
+ * @param[in] table the FIB table the entry belongs to
  * @param[in] entry the entry to be removed
  *
  * @return 0 on success
  */
-static int fib_remove(fib_entry_t *entry)
+static int fib_remove(fib_table_t *table, fib_entry_t *entry)
 {
+#if IS_USED(MODULE_FIB_LPM)
+    /* only entries that have been created successfully are in the trie */
+    if (entry->lifetime != 0) {
+        _lpm_remove(table, entry);
+    }
+#else
+    (void)table;
+#endif
+
     if (entry->global != NULL) {
         universal_address_rem(entry->global);
     }
@@ -462,7 +793,7 @@ void fib_remove_entry(fib_table_t *table, uint8_t *dst, size_t dst_size)
 
     if (ret == 1) {
         /* we must take the according entry and update the values */
-        fib_remove(entry[0]);
+        fib_remove(table, entry[0]);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -482,7 +813,7 @@ void fib_flush(fib_table_t *table, kernel_pid_t interface)
     for (size_t i = 0; i < table->size; ++i) {
         if ((interface == KERNEL_PID_UNDEF) ||
             (interface == table->data.entries[i].iface_id)) {
-            fib_remove(&table->data.entries[i]);
+            fib_remove(table, &table->data.entries[i]);
         }
     }
 
@@ -603,6 +934,9 @@ void fib_init(fib_table_t *table)
     }
     else {
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
+#if IS_USED(MODULE_FIB_LPM)
+        table->lpm_root = NULL;
+#endif
     }
     universal_address_init();
     mutex_unlock(&(table->mtx_access));
@@ -628,6 +962,9 @@ void fib_deinit(fib_table_t *table)
     }
     else {
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
+#if IS_USED(MODULE_FIB_LPM)
+        table->lpm_root = NULL;
+#endif
     }
     universal_address_reset();
     mutex_unlock(&(table->mtx_access));
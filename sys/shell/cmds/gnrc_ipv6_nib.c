@@ -13,6 +13,7 @@
  * @author  Martine Lenders <m.lenders@fu-berlin.de>
  */
 
+#include <inttypes.h>
 #include <stdio.h>
 
 #include "kernel_defines.h"
@@ -95,6 +96,9 @@ static void _usage_nib_route(char **argv)
            argv[0], argv[1]);
     printf("       %s %s del <iface> <prefix>[/<prefix_len>]\n", argv[0], argv[1]);
     printf("       %s %s show [iface]\n", argv[0], argv[1]);
+#if IS_USED(MODULE_GNRC_IPV6_NIB_ROUTE_CACHE)
+    printf("       %s %s cache\n", argv[0], argv[1]);
+#endif  /* MODULE_GNRC_IPV6_NIB_ROUTE_CACHE */
 }
 
 static inline gnrc_netif_t *_get_iface(unsigned iface)
@@ -297,6 +301,15 @@ static int _nib_route(int argc, char **argv)
         }
         gnrc_ipv6_nib_ft_del(&pfx, pfx_len);
     }
+#if IS_USED(MODULE_GNRC_IPV6_NIB_ROUTE_CACHE)
+    else if ((argc > 2) && (strcmp(argv[2], "cache") == 0)) {
+        gnrc_ipv6_nib_ft_cache_stats_t stats;
+
+        gnrc_ipv6_nib_ft_cache_stats(&stats);
+        printf("route cache: %u entries, %" PRIu32 " hits, %" PRIu32 " misses\n",
+               CONFIG_GNRC_IPV6_NIB_ROUTE_CACHE_SIZE, stats.hits, stats.misses);
+    }
+#endif  /* MODULE_GNRC_IPV6_NIB_ROUTE_CACHE */
     else {
         _usage_nib_route(argv);
         return 1;
@@ -38,6 +38,9 @@
 #ifdef MODULE_NETSTATS
 #include "net/netstats.h"
 #endif
+#if IS_USED(MODULE_NETSTATS_LATENCY)
+#include "net/netstats/latency.h"
+#endif
 #ifdef MODULE_L2FILTER
 #include "net/l2filter.h"
 #endif
@@ -147,6 +150,8 @@ static const char *_netstats_module_to_str(uint8_t module)
         return "Layer 2";
     case NETSTATS_IPV6:
         return "IPv6";
+    case NETSTATS_LATENCY:
+        return "Latency";
     case NETSTATS_ALL:
         return "all";
     default:
@@ -182,10 +187,109 @@ static int _netif_stats(netif_t *iface, unsigned module, bool reset)
                (unsigned)stats.tx_bytes,
                (unsigned)stats.tx_success,
                (unsigned)stats.tx_failed);
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_PRIO)
+        if (module == NETSTATS_LAYER2) {
+            printf("            TX queue drops control %u default %u bulk %u\n",
+                   (unsigned)stats.tx_queue_drops[GNRC_NETIF_PKTQ_CLASS_CONTROL],
+                   (unsigned)stats.tx_queue_drops[GNRC_NETIF_PKTQ_CLASS_DEFAULT],
+                   (unsigned)stats.tx_queue_drops[GNRC_NETIF_PKTQ_CLASS_BULK]);
+        }
+#endif
         res = 0;
     }
     return res;
 }
+
+#if IS_USED(MODULE_NETSTATS_LATENCY)
+static const char *_latency_kind_str[NETSTATS_LATENCY_NUMOF] = {
+    [NETSTATS_LATENCY_TX_QUEUE] = "TX queue",
+    [NETSTATS_LATENCY_TX_ACCESS] = "TX access",
+    [NETSTATS_LATENCY_TX_AIR] = "TX air",
+    [NETSTATS_LATENCY_RX] = "RX",
+};
+
+static void _latency_print_bound(unsigned bucket)
+{
+    if (bucket == (CONFIG_NETSTATS_LATENCY_BUCKETS - 1)) {
+        printf(">= %lu", 1LU << bucket);
+    }
+    else {
+        printf("< %lu", 1LU << (bucket + 1));
+    }
+}
+
+static unsigned _latency_percentile(const uint32_t *count, uint32_t total,
+                                    unsigned percent)
+{
+    /* rank of the sample, rounded up */
+    uint32_t rank = ((uint64_t)total * percent + 99) / 100;
+    uint32_t sum = 0;
+
+    for (unsigned i = 0; i < CONFIG_NETSTATS_LATENCY_BUCKETS; i++) {
+        sum += count[i];
+        if (sum >= rank) {
+            return i;
+        }
+    }
+    return CONFIG_NETSTATS_LATENCY_BUCKETS - 1;
+}
+
+static int _netif_latency(netif_t *iface, bool reset)
+{
+    netstats_latency_t stats;
+    int res;
+
+    if (reset) {
+        res = netif_set_opt(iface, NETOPT_STATS, NETSTATS_LATENCY, NULL, 0);
+        printf("Reset statistics for module %s: %s!\n",
+               _netstats_module_to_str(NETSTATS_LATENCY),
+               (res < 0) ? "failed" : "succeeded");
+        return res;
+    }
+    res = netif_get_opt(iface, NETOPT_STATS, NETSTATS_LATENCY, &stats,
+                        sizeof(stats));
+    if (res < 0) {
+        printf("           Protocol or device doesn't provide statistics.\n");
+        return res;
+    }
+    printf("          Statistics for %s (in us)\n",
+           _netstats_module_to_str(NETSTATS_LATENCY));
+    for (unsigned kind = 0; kind < NETSTATS_LATENCY_NUMOF; kind++) {
+        const uint32_t *count = stats.count[kind];
+        uint32_t total = 0;
+
+        for (unsigned i = 0; i < CONFIG_NETSTATS_LATENCY_BUCKETS; i++) {
+            total += count[i];
+        }
+        printf("            %-9s samples %" PRIu32, _latency_kind_str[kind],
+               total);
+        if (total == 0) {
+            puts("");
+            continue;
+        }
+        printf("  p50 ");
+        _latency_print_bound(_latency_percentile(count, total, 50));
+        printf("  p99 ");
+        _latency_print_bound(_latency_percentile(count, total, 99));
+        printf("\n             ");
+        for (unsigned i = 0; i < CONFIG_NETSTATS_LATENCY_BUCKETS; i++) {
+            if (count[i] == 0) {
+                continue;
+            }
+            printf(" [%lu, ", (i == 0) ? 0LU : (1LU << i));
+            if (i == (CONFIG_NETSTATS_LATENCY_BUCKETS - 1)) {
+                printf("inf)");
+            }
+            else {
+                printf("%lu)", 1LU << (i + 1));
+            }
+            printf(": %" PRIu32, count[i]);
+        }
+        puts("");
+    }
+    return 0;
+}
+#endif
 #endif /* MODULE_NETSTATS */
 
 static void _link_usage(char *cmd_name)
@@ -290,7 +394,8 @@ static void _del_usage(char *cmd_name)
 #ifdef MODULE_NETSTATS
 static void _stats_usage(char *cmd_name)
 {
-    printf("usage: %s <if_id> stats [l2|ipv6] [reset]\n", cmd_name);
+    printf("usage: %s <if_id> stats [l2|ipv6%s] [reset]\n", cmd_name,
+           IS_USED(MODULE_NETSTATS_LATENCY) ? "|latency" : "");
     printf("       reset can be only used if the module is specified.\n");
 }
 #endif
@@ -960,6 +1065,12 @@ static void _netif_list(netif_t *iface)
 #endif
 #ifdef MODULE_NETSTATS_IPV6
     _netif_stats(iface, NETSTATS_IPV6, false);
+#endif
+#if IS_USED(MODULE_NETSTATS_LATENCY)
+    if (!IS_USED(MODULE_NETSTATS_L2)) {
+        puts("");
+    }
+    _netif_latency(iface, false);
 #endif
     puts("");
 }
@@ -1914,6 +2025,11 @@ int _gnrc_netif_config(int argc, char **argv)
             else if (strcmp(argv[3], "ipv6") == 0) {
                 module = NETSTATS_IPV6;
             }
+#if IS_USED(MODULE_NETSTATS_LATENCY)
+            else if (strcmp(argv[3], "latency") == 0) {
+                module = NETSTATS_LATENCY;
+            }
+#endif
             else {
                 printf("Module %s doesn't exist or does not provide statistics.\n", argv[3]);
 
@@ -1930,6 +2046,11 @@ int _gnrc_netif_config(int argc, char **argv)
             if (module & NETSTATS_IPV6) {
                 _netif_stats(iface, NETSTATS_IPV6, reset);
             }
+#if IS_USED(MODULE_NETSTATS_LATENCY)
+            if (module & NETSTATS_LATENCY) {
+                _netif_latency(iface, reset);
+            }
+#endif
 
             return 1;
         }
@@ -32,6 +32,9 @@
 #include "pm_layered.h"
 #endif
 #include "ztimer.h"
+#if MODULE_ZTIMER_WHEEL
+#include "ztimer/wheel.h"
+#endif
 #include "log.h"
 
 #define ENABLE_DEBUG 0
@@ -43,6 +46,17 @@ static void _ztimer_update(ztimer_clock_t *clock);
 static void _ztimer_print(const ztimer_clock_t *clock);
 static uint32_t _ztimer_update_head_offset(ztimer_clock_t *clock);
 
+/* offset of the first timer relative to the clock's base time */
+static inline uint32_t _head_offset(const ztimer_clock_t *clock)
+{
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        return _ztimer_wheel_head_offset(clock);
+    }
+#endif
+    return clock->list.next->offset;
+}
+
 #ifdef MODULE_ZTIMER_EXTEND
 static inline uint32_t _min_u32(uint32_t a, uint32_t b)
 {
@@ -114,6 +128,11 @@ bool ztimer_release(ztimer_clock_t *clock)
 
 static unsigned _is_set(const ztimer_clock_t *clock, const ztimer_t *t)
 {
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        return _ztimer_wheel_has(clock, &t->base);
+    }
+#endif
     if (!clock->list.next) {
         return 0;
     }
@@ -156,7 +175,38 @@ bool ztimer_remove(ztimer_clock_t *clock, ztimer_t *timer)
     return was_removed;
 }
 
-uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
+#if MODULE_ZTIMER_SLACK
+static uint32_t _coalesce(ztimer_clock_t *clock, uint32_t val, uint32_t slack)
+{
+    if (slack > UINT32_MAX - val) {
+        slack = UINT32_MAX - val;
+    }
+
+    /* ride along with the next interrupt, if it is due within the window */
+    if (clock->list.next) {
+        uint32_t next = _head_offset(clock);
+        if ((next >= val) && (next - val <= slack)) {
+            return next;
+        }
+    }
+
+    /* otherwise align the target, so that timers with similar slack expire
+     * at the same time */
+    if (slack) {
+        uint32_t align = slack;
+        while (align & (align - 1)) {
+            align &= align - 1;
+        }
+        uint32_t target = clock->list.offset + val;
+        val += ((target + align - 1) & ~(align - 1)) - target;
+    }
+
+    return val;
+}
+#endif
+
+static uint32_t _ztimer_set(ztimer_clock_t *clock, ztimer_t *timer,
+                            uint32_t val, uint32_t slack)
 {
     unsigned state = irq_disable();
 
@@ -191,6 +241,14 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
         val = 0;
     }
 
+#if MODULE_ZTIMER_SLACK
+    uint32_t target = _coalesce(clock, val, slack);
+    timer->coalesced = (target != val);
+    val = target;
+#else
+    (void)slack;
+#endif
+
     timer->base.offset = val;
     _add_entry_to_list(clock, &timer->base);
     _ztimer_update(clock);
@@ -213,6 +271,19 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
     return now;
 }
 
+uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
+{
+    return _ztimer_set(clock, timer, val, 0);
+}
+
+#if MODULE_ZTIMER_SLACK
+uint32_t ztimer_set_slack(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val,
+                          uint32_t slack)
+{
+    return _ztimer_set(clock, timer, val, slack);
+}
+#endif
+
 static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 {
     uint32_t delta_sum = 0;
@@ -227,6 +298,13 @@ static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
     }
 #endif
 
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        _ztimer_wheel_add(clock, entry);
+        return;
+    }
+#endif
+
     /* Jump past all entries which are set to an earlier target than the new entry */
     while (list->next) {
         ztimer_base_t *list_entry = list->next;
@@ -289,6 +367,13 @@ static uint32_t _ztimer_update_head_offset(ztimer_clock_t *clock)
     uint32_t now = ztimer_now(clock);
     uint32_t diff = now - old_base;
 
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        _ztimer_wheel_advance(clock, now);
+        return now;
+    }
+#endif
+
     ztimer_base_t *entry = clock->list.next;
 
     DEBUG(
@@ -335,27 +420,36 @@ static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 
     assert(_is_set(clock, (ztimer_t *)entry));
 
-    while (list->next) {
-        ztimer_base_t *list_entry = list->next;
-        if (list_entry == entry) {
-            if (entry == clock->last) {
-                /* if entry was the last timer, set the clocks last to the
-                 * previous entry, or NULL if that was the list ptr */
-                clock->last = (list == &clock->list) ? NULL : list;
-            }
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        _ztimer_wheel_del(clock, entry);
+        was_removed = true;
+    }
+    else
+#endif
+    {
+        while (list->next) {
+            ztimer_base_t *list_entry = list->next;
+            if (list_entry == entry) {
+                if (entry == clock->last) {
+                    /* if entry was the last timer, set the clocks last to the
+                     * previous entry, or NULL if that was the list ptr */
+                    clock->last = (list == &clock->list) ? NULL : list;
+                }
 
-            list->next = entry->next;
-            if (list->next) {
-                list_entry = list->next;
-                list_entry->offset += entry->offset;
-            }
+                list->next = entry->next;
+                if (list->next) {
+                    list_entry = list->next;
+                    list_entry->offset += entry->offset;
+                }
 
-            was_removed = true;
-            /* reset the entry's next pointer so _is_set() considers it unset */
-            entry->next = NULL;
-            break;
+                was_removed = true;
+                /* reset the entry's next pointer so _is_set() considers it unset */
+                entry->next = NULL;
+                break;
+            }
+            list = list->next;
         }
-        list = list->next;
     }
 
 #if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
@@ -371,6 +465,20 @@ static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 
 static ztimer_t *_now_next(ztimer_clock_t *clock)
 {
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        ztimer_base_t *entry = _ztimer_wheel_pop(clock);
+#if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
+        /* The last timer just got removed from the clock's wheel */
+        if (entry && !clock->list.next &&
+            clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+            pm_unblock(clock->block_pm_mode);
+        }
+#endif
+        return (ztimer_t *)entry;
+    }
+#endif
+
     ztimer_base_t *entry = clock->list.next;
 
     if (entry && (entry->offset == 0)) {
@@ -401,7 +509,7 @@ static void _ztimer_update(ztimer_clock_t *clock)
     if (clock->max_value < UINT32_MAX) {
         if (clock->list.next) {
             clock->ops->set(clock,
-                            _min_u32(clock->list.next->offset,
+                            _min_u32(_head_offset(clock),
                                      clock->max_value >> 1));
         }
         else {
@@ -413,7 +521,7 @@ static void _ztimer_update(ztimer_clock_t *clock)
     }
     else {
         if (clock->list.next) {
-            clock->ops->set(clock, clock->list.next->offset);
+            clock->ops->set(clock, _head_offset(clock));
         }
         else {
             clock->ops->cancel(clock);
@@ -437,7 +545,7 @@ void ztimer_handler(ztimer_clock_t *clock)
         uint32_t now = ztimer_now(clock);
 
         if (clock->list.next) {
-            uint32_t target = clock->list.offset + clock->list.next->offset;
+            uint32_t target = clock->list.offset + _head_offset(clock);
             int32_t diff = (int32_t)(target - now);
             if (diff > 0) {
                 DEBUG("ztimer_handler(): %p postponing by %" PRIi32 "\n",
@@ -462,14 +570,43 @@ void ztimer_handler(ztimer_clock_t *clock)
 #endif
 
     if (clock->list.next) {
-        clock->list.offset += clock->list.next->offset;
-        clock->list.next->offset = 0;
+#if MODULE_ZTIMER_WHEEL
+        if (clock->wheel) {
+            _ztimer_wheel_advance(clock,
+                                  clock->list.offset + _head_offset(clock));
+        }
+        else
+#endif
+        {
+            clock->list.offset += clock->list.next->offset;
+            clock->list.next->offset = 0;
+        }
 
         ztimer_t *entry = _now_next(clock);
+#if MODULE_ZTIMER_WHEEL
+        if (!entry && clock->wheel) {
+            /* a slot of the wheel got cascaded, but no timer is due yet:
+             * account for the time that passed since the slot was reached */
+            _ztimer_update_head_offset(clock);
+            entry = _now_next(clock);
+        }
+#endif
+#if MODULE_ZTIMER_SLACK
+        bool first = true;
+#endif
         while (entry) {
             DEBUG("ztimer_handler(): trigger %p->%p at %" PRIu32 "\n",
                   (void *)entry, (void *)entry->base.next, clock->ops->now(
                       clock));
+#if MODULE_ZTIMER_SLACK
+            /* the first timer needed this interrupt anyway, the following
+             * ones only share it if their slack moved them here */
+            clock->fired++;
+            if (!first && entry->coalesced) {
+                clock->coalesced++;
+            }
+            first = false;
+#endif
             entry->callback(entry->arg);
 #if MODULE_ZTIMER_ONDEMAND
             no_clock_user_left = ztimer_release(clock);
@@ -503,6 +640,13 @@ void ztimer_handler(ztimer_clock_t *clock)
 
 static void _ztimer_print(const ztimer_clock_t *clock)
 {
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        _ztimer_wheel_print(clock);
+        return;
+    }
+#endif
+
     const ztimer_base_t *entry = &clock->list;
     uint32_t last_offset = 0;
 
@@ -51,6 +51,9 @@
 #include "ztimer/periph_rtt.h"
 #include "ztimer/periph_rtc.h"
 #include "ztimer/config.h"
+#if MODULE_ZTIMER_WHEEL
+#include "ztimer/wheel.h"
+#endif
 
 /* both 'stdio_rtt' and 'stdio_semihosting' rely on ztimer for stdio output,
    so not output is possible before 'ztimer' has been initiated, silence all
@@ -268,6 +271,20 @@ ztimer_clock_t *const ZTIMER_SEC = ZTIMER_SEC_BASE;
 #  endif
 #endif
 
+/* Step 3b: setup memory for timer wheels of the ztimers requested */
+
+#if MODULE_ZTIMER_WHEEL
+#  if MODULE_ZTIMER_USEC
+static ztimer_wheel_t _ztimer_wheel_usec;
+#  endif
+#  if MODULE_ZTIMER_MSEC
+static ztimer_wheel_t _ztimer_wheel_msec;
+#  endif
+#  if MODULE_ZTIMER_SEC
+static ztimer_wheel_t _ztimer_wheel_sec;
+#  endif
+#endif
+
 #if IS_USED(MODULE_ZTIMER_USEC)
 #ifndef CONFIG_ZTIMER_AUTO_ADJUST_BASE_ITVL
 #define CONFIG_ZTIMER_AUTO_ADJUST_BASE_ITVL     1000
@@ -379,6 +396,9 @@ void ztimer_init(void)
     }
     LOG_DEBUG("ztimer_init(): ZTIMER_USEC without conversion\n");
 #  endif
+#  if MODULE_ZTIMER_WHEEL
+    ztimer_wheel_init(ZTIMER_USEC, &_ztimer_wheel_usec);
+#  endif
 
     /* warm-up time if set and needed */
     if (IS_USED(MODULE_ZTIMER_AUTO_ADJUST) &&
@@ -436,6 +456,9 @@ void ztimer_init(void)
               CONFIG_ZTIMER_MSEC_ADJUST);
     ZTIMER_MSEC->adjust = CONFIG_ZTIMER_MSEC_ADJUST;
 #  endif
+#  if MODULE_ZTIMER_WHEEL
+    ztimer_wheel_init(ZTIMER_MSEC, &_ztimer_wheel_msec);
+#  endif
 #endif
 
 #if MODULE_ZTIMER_SEC
@@ -445,5 +468,8 @@ void ztimer_init(void)
     ztimer_convert_frac_init(&_ztimer_convert_frac_sec, ZTIMER_SEC_BASE,
                              FREQ_1HZ, ZTIMER_SEC_CONVERT_LOWER_FREQ);
 #  endif
+#  if MODULE_ZTIMER_WHEEL
+    ztimer_wheel_init(ZTIMER_SEC, &_ztimer_wheel_sec);
+#  endif
 #endif
 }
@@ -0,0 +1,358 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_ztimer_wheel
+ * @{
+ *
+ * @file
+ * @brief       ztimer hierarchical timer wheel
+ *
+ * Timers on a wheel store their absolute target time in `base.offset`. The
+ * base time of the wheel is the base time of the clock (`clock->list.offset`),
+ * so ztimer core can keep using it for checkpointing and clock extension.
+ *
+ * A timer is kept on the level of the most significant digit in which its
+ * target differs from the base time, in the slot given by that digit of the
+ * target. So on all but the top level, the digit of the target is larger
+ * than the digit of the base time. Targets that are numerically smaller than
+ * the base time (i.e. beyond the next wrap-around of the 32 bit time) are
+ * kept on the top level, which is searched circularly starting after the
+ * digit of the base time.
+ *
+ * The first timer of the earliest non-empty slot is cached in
+ * `clock->list.next`. If that slot holds more than one timer, the clock is
+ * not armed for the exact target of the earliest timer, but for the time the
+ * base time reaches the slot, where the slot is cascaded to the levels below.
+ * On level 0 that is the exact target time of all timers in the slot. This
+ * way, no operation has to search through the timers of a slot, except for
+ * checking whether a timer that is not first in its slot is set, as the
+ * links of a timer that was never set cannot be trusted.
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bitarithm.h"
+#include "ztimer.h"
+#include "ztimer/wheel.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define LEVEL_BITS  CONFIG_ZTIMER_WHEEL_LEVEL_BITS
+#define SLOT_MASK   (ZTIMER_WHEEL_SLOTS - 1)
+#define TOP_LEVEL   (ZTIMER_WHEEL_LEVELS - 1)
+#define ALL_SLOTS   (UINT16_MAX >> (16 - ZTIMER_WHEEL_SLOTS))
+
+static unsigned _msb32(uint32_t v)
+{
+    /* bitarithm_msb() operates on unsigned, which may be 16 bit wide */
+    if (v >> 16) {
+        return 16 + bitarithm_msb((unsigned)(v >> 16));
+    }
+    return bitarithm_msb((unsigned)v);
+}
+
+static inline unsigned _digit(uint32_t time, unsigned level)
+{
+    return (time >> (level * LEVEL_BITS)) & SLOT_MASK;
+}
+
+/* mask of all slots in the circular range (from, to] */
+static unsigned _range_mask(unsigned from, unsigned to)
+{
+    unsigned upto_from = (2U << from) - 1;
+    unsigned upto_to = (2U << to) - 1;
+
+    if (to > from) {
+        return upto_to & ~upto_from;
+    }
+    return ~(upto_from & ~upto_to) & ALL_SLOTS;
+}
+
+static void _link(ztimer_base_t **pos, ztimer_base_t *entry)
+{
+    entry->next = *pos;
+    if (entry->next) {
+        entry->next->pprev = &entry->next;
+    }
+    entry->pprev = pos;
+    *pos = entry;
+}
+
+static void _unlink(ztimer_base_t *entry)
+{
+    *entry->pprev = entry->next;
+    if (entry->next) {
+        entry->next->pprev = entry->pprev;
+    }
+    /* reset the links so _is_set() considers the entry unset */
+    entry->next = NULL;
+    entry->pprev = NULL;
+}
+
+static inline unsigned _level(uint32_t target, uint32_t base)
+{
+    return (target > base) ? _msb32(target ^ base) / LEVEL_BITS : TOP_LEVEL;
+}
+
+/* ticks from base until the wheel has to be advanced for the slot holding
+ * target: if target is alone in its slot, that is target itself, otherwise
+ * it is when the slot is reached and has to be cascaded */
+static uint32_t _due(const ztimer_wheel_t *wheel, uint32_t target,
+                     uint32_t base)
+{
+    unsigned level = _level(target, base);
+    unsigned slot = _digit(target, level);
+
+    if (wheel->slot[level][slot]->next == NULL) {
+        return target - base;
+    }
+
+    unsigned shift = level * LEVEL_BITS;
+    uint32_t start = (uint32_t)slot << shift;
+
+    if (level < TOP_LEVEL) {
+        start |= base & ~((UINT32_C(1) << (shift + LEVEL_BITS)) - 1);
+    }
+    return start - base;
+}
+
+static void _insert(ztimer_wheel_t *wheel, ztimer_base_t *entry, uint32_t base)
+{
+    uint32_t target = entry->offset;
+    unsigned level = _level(target, base);
+    unsigned slot = _digit(target, level);
+
+    _link(&wheel->slot[level][slot], entry);
+    wheel->occupied[level] |= 1U << slot;
+}
+
+static void _insert_expired(ztimer_wheel_t *wheel, ztimer_base_t *entry,
+                            uint32_t now)
+{
+    uint32_t late = now - entry->offset;
+    ztimer_base_t **pos = &wheel->expired;
+
+    /* keep the order of timers that are equally late */
+    while (*pos && ((now - (*pos)->offset) >= late)) {
+        pos = &(*pos)->next;
+    }
+    _link(pos, entry);
+}
+
+static ztimer_base_t *_first(const ztimer_clock_t *clock)
+{
+    const ztimer_wheel_t *wheel = clock->wheel;
+
+    if (wheel->expired) {
+        return wheel->expired;
+    }
+
+    /* all slots on a level are reached before any slot on the levels above */
+    for (unsigned level = 0; level < ZTIMER_WHEEL_LEVELS; level++) {
+        unsigned occupied = wheel->occupied[level];
+
+        if (!occupied) {
+            continue;
+        }
+        if (level == TOP_LEVEL) {
+            unsigned base = _digit(clock->list.offset, level);
+            unsigned later = occupied & ~((2U << base) - 1);
+            if (later) {
+                occupied = later;
+            }
+        }
+        return wheel->slot[level][bitarithm_lsb(occupied)];
+    }
+
+    return NULL;
+}
+
+void ztimer_wheel_init(ztimer_clock_t *clock, ztimer_wheel_t *wheel)
+{
+    assert(clock->list.next == NULL);
+
+    memset(wheel, 0, sizeof(*wheel));
+    clock->wheel = wheel;
+}
+
+void _ztimer_wheel_add(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    ztimer_wheel_t *wheel = clock->wheel;
+    uint32_t base = clock->list.offset;
+    uint32_t offset = entry->offset;
+    ztimer_base_t *head = clock->list.next;
+
+    entry->offset = base + offset;
+    DEBUG("_ztimer_wheel_add() %p target %" PRIu32 "\n", (void *)entry,
+          entry->offset);
+
+    if (offset == 0) {
+        _insert_expired(wheel, entry, base);
+        clock->list.next = wheel->expired;
+        return;
+    }
+
+    _insert(wheel, entry, base);
+    if (!head || ((head != wheel->expired) &&
+                  (_due(wheel, entry->offset, base) < _due(wheel, head->offset, base)))) {
+        clock->list.next = entry;
+    }
+}
+
+bool _ztimer_wheel_has(const ztimer_clock_t *clock, const ztimer_base_t *entry)
+{
+    const ztimer_wheel_t *wheel = clock->wheel;
+    ztimer_base_t *const *pprev = entry->pprev;
+    ztimer_base_t *const *first = &wheel->slot[0][0];
+
+    /* Timers that have been removed have their links reset, but a timer
+     * that was never set may contain anything. So its links are only
+     * followed if they point into the wheel itself. */
+    if (!pprev) {
+        return false;
+    }
+    if (((pprev >= first) && (pprev < first + ZTIMER_WHEEL_LEVELS * ZTIMER_WHEEL_SLOTS)) ||
+        (pprev == &wheel->expired)) {
+        return *pprev == entry;
+    }
+
+    /* Otherwise, look for the timer in the only slot it can be in given its
+     * target, and among the expired timers. */
+    unsigned level = _level(entry->offset, clock->list.offset);
+    const ztimer_base_t *pos = wheel->slot[level][_digit(entry->offset, level)];
+
+    for (; pos; pos = pos->next) {
+        if (pos == entry) {
+            return true;
+        }
+    }
+    for (pos = wheel->expired; pos; pos = pos->next) {
+        if (pos == entry) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void _ztimer_wheel_del(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    ztimer_wheel_t *wheel = clock->wheel;
+    ztimer_base_t **pprev = entry->pprev;
+    ztimer_base_t **first = &wheel->slot[0][0];
+
+    DEBUG("_ztimer_wheel_del() %p\n", (void *)entry);
+    assert(pprev);
+
+    _unlink(entry);
+    /* if the entry was the only one in its slot, mark the slot as empty */
+    if ((pprev >= first) && (pprev < first + ZTIMER_WHEEL_LEVELS * ZTIMER_WHEEL_SLOTS) &&
+        (*pprev == NULL)) {
+        unsigned idx = pprev - first;
+        wheel->occupied[idx / ZTIMER_WHEEL_SLOTS] &= ~(1U << (idx & SLOT_MASK));
+    }
+
+    if (clock->list.next == entry) {
+        clock->list.next = _first(clock);
+    }
+}
+
+void _ztimer_wheel_advance(ztimer_clock_t *clock, uint32_t now)
+{
+    ztimer_wheel_t *wheel = clock->wheel;
+    uint32_t old = clock->list.offset;
+    uint32_t diff = now - old;
+
+    if (diff == 0) {
+        return;
+    }
+    clock->list.offset = now;
+
+    /* The levels below the most significant digit that changed have been
+     * passed completely, on that level only the slots up to the new digit.
+     * When the base time wraps around, the top level has changed. */
+    unsigned top = (now > old) ? _msb32(old ^ now) / LEVEL_BITS : TOP_LEVEL;
+
+    for (unsigned level = 0; level <= top; level++) {
+        unsigned passed = wheel->occupied[level];
+
+        if (level == top) {
+            passed &= _range_mask(_digit(old, level), _digit(now, level));
+        }
+        wheel->occupied[level] &= ~passed;
+
+        while (passed) {
+            unsigned slot = bitarithm_lsb(passed);
+            passed &= ~(1U << slot);
+
+            ztimer_base_t *entry = wheel->slot[level][slot];
+            wheel->slot[level][slot] = NULL;
+            while (entry) {
+                ztimer_base_t *next = entry->next;
+                if ((entry->offset - old) <= diff) {
+                    _insert_expired(wheel, entry, now);
+                }
+                else {
+                    _insert(wheel, entry, now);
+                }
+                entry = next;
+            }
+        }
+    }
+
+    clock->list.next = _first(clock);
+}
+
+ztimer_base_t *_ztimer_wheel_pop(ztimer_clock_t *clock)
+{
+    ztimer_base_t *entry = clock->wheel->expired;
+
+    if (entry) {
+        _unlink(entry);
+        clock->list.next = _first(clock);
+    }
+    return entry;
+}
+
+uint32_t _ztimer_wheel_head_offset(const ztimer_clock_t *clock)
+{
+    /* expired timers are always first */
+    if (clock->list.next == clock->wheel->expired) {
+        return 0;
+    }
+    return _due(clock->wheel, clock->list.next->offset, clock->list.offset);
+}
+
+void _ztimer_wheel_print(const ztimer_clock_t *clock)
+{
+    const ztimer_wheel_t *wheel = clock->wheel;
+
+    printf("base %" PRIu32 " head 0x%08" PRIxPTR "\n", clock->list.offset,
+           (uintptr_t)clock->list.next);
+    for (const ztimer_base_t *entry = wheel->expired; entry; entry = entry->next) {
+        printf("0x%08" PRIxPTR ":%" PRIu32 " ", (uintptr_t)entry, entry->offset);
+    }
+    puts("(expired)");
+    for (unsigned level = 0; level < ZTIMER_WHEEL_LEVELS; level++) {
+        for (unsigned slot = 0; slot < ZTIMER_WHEEL_SLOTS; slot++) {
+            const ztimer_base_t *entry = wheel->slot[level][slot];
+            if (!entry) {
+                continue;
+            }
+            printf("[%u][%u]", level, slot);
+            for (; entry; entry = entry->next) {
+                printf(" 0x%08" PRIxPTR ":%" PRIu32, (uintptr_t)entry,
+                       entry->offset);
+            }
+            puts("");
+        }
+    }
+}
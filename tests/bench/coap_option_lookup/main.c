@@ -0,0 +1,170 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of reading the options of CoAP requests
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "net/nanocoap.h"
+#include "test_utils/expect.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_REQUESTS
+#define NUMOF_REQUESTS      (100000U)
+#endif
+
+/* every measurement is repeated, the fastest one counts */
+#ifndef NUMOF_ROUNDS
+#define NUMOF_ROUNDS        (5U)
+#endif
+
+#define BUF_SIZE            (96U)
+
+typedef struct {
+    const char *name;
+    uint8_t buf[BUF_SIZE];
+    size_t len;
+} _request_t;
+
+static _request_t _requests[] = {
+    { .name = "GET path" },
+    { .name = "GET query" },
+    { .name = "GET observe" },
+    { .name = "POST block1" },
+};
+
+static void _build(_request_t *req, unsigned i)
+{
+    coap_pkt_t pkt;
+    coap_block1_t block = { .szx = 2 };
+    size_t len = coap_build_hdr((coap_hdr_t *)req->buf, COAP_TYPE_CON, "tk", 2,
+                                (i == 3) ? COAP_METHOD_POST : COAP_METHOD_GET, i);
+
+    coap_pkt_init(&pkt, req->buf, sizeof(req->buf), len);
+    switch (i) {
+    case 0:
+        /* LwM2M read */
+        coap_opt_add_uri_path(&pkt, "/3/0/1");
+        coap_opt_add_accept(&pkt, COAP_FORMAT_SENML_CBOR);
+        break;
+    case 1:
+        coap_opt_add_uri_path(&pkt, "/sensors/temp");
+        coap_opt_add_uri_query(&pkt, "unit", "c");
+        coap_opt_add_uri_query(&pkt, "fmt", "json");
+        coap_opt_add_accept(&pkt, COAP_FORMAT_JSON);
+        break;
+    case 2:
+        coap_opt_add_uint(&pkt, COAP_OPT_OBSERVE, 0);
+        coap_opt_add_uri_path(&pkt, "/sensors/temp");
+        coap_opt_add_uint(&pkt, COAP_OPT_BLOCK2, 2);
+        break;
+    case 3:
+        /* firmware upload */
+        coap_opt_add_uri_path(&pkt, "/fw");
+        coap_opt_add_format(&pkt, COAP_FORMAT_OCTET);
+        block.more = true;
+        coap_opt_add_block1_control(&pkt, &block);
+        coap_opt_add_uint(&pkt, COAP_OPT_SIZE1, 65536);
+        break;
+    }
+    req->len = coap_opt_finish(&pkt, COAP_OPT_FINISH_PAYLOAD);
+    expect(req->len + 16 <= sizeof(req->buf));
+    memset(&req->buf[req->len], 0xab, 16);
+    req->len += 16;
+}
+
+/* the options a typical handler looks up, present or not */
+static unsigned _lookup_options(coap_pkt_t *pkt)
+{
+    coap_block1_t block;
+    uint32_t value;
+    const char *query;
+    size_t query_len;
+    unsigned sum = 0;
+
+    sum += coap_get_accept(pkt);
+    sum += coap_get_content_type(pkt);
+    sum += coap_find_uri_query(pkt, "fmt", &query, &query_len);
+    sum += coap_opt_get_uint(pkt, COAP_OPT_OBSERVE, &value) == 0;
+    sum += coap_get_block1(pkt, &block);
+    sum += coap_get_block2(pkt, &block);
+    sum += coap_opt_get_uint(pkt, COAP_OPT_SIZE1, &value) == 0;
+    return sum;
+}
+
+static unsigned _read_path(coap_pkt_t *pkt)
+{
+    uint8_t uri[CONFIG_NANOCOAP_URI_MAX];
+
+    return coap_get_uri_path(pkt, uri);
+}
+
+static uint32_t _time(const _request_t *req, coap_pkt_t *pkt,
+                      unsigned (*read)(coap_pkt_t *))
+{
+    uint32_t min = UINT32_MAX;
+    unsigned sum = 0;
+
+    for (unsigned round = 0; round < NUMOF_ROUNDS; round++) {
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+
+        for (unsigned i = 0; i < NUMOF_REQUESTS; i++) {
+            if (read) {
+                sum += read(pkt);
+            }
+            else {
+                sum += coap_parse(pkt, (uint8_t *)req->buf, req->len);
+            }
+        }
+        start = ztimer_now(ZTIMER_USEC) - start;
+        if (start < min) {
+            min = start;
+        }
+    }
+    /* keep the compiler from dropping the calls */
+    expect(sum != UINT32_MAX);
+    return ((uint64_t)min * NS_PER_US) / NUMOF_REQUESTS;
+}
+
+static void _measure(const _request_t *req)
+{
+    coap_pkt_t pkt;
+
+    expect(coap_parse(&pkt, (uint8_t *)req->buf, req->len) == 0);
+
+    uint32_t parse = _time(req, &pkt, NULL);
+    uint32_t lookup = _time(req, &pkt, _lookup_options);
+    uint32_t path = _time(req, &pkt, _read_path);
+
+    printf("%-11s: parse %4" PRIu32 " ns, lookup options %4" PRIu32 " ns, "
+           "read path %4" PRIu32 " ns\n", req->name, parse, lookup, path);
+}
+
+int main(void)
+{
+    puts("CoAP option lookup benchmark application.\n");
+    printf("option index: %s\n",
+           IS_USED(MODULE_NANOCOAP_OPTION_INDEX) ? "yes" : "no");
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_requests); i++) {
+        _build(&_requests[i], i);
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_requests); i++) {
+        _measure(&_requests[i]);
+    }
+
+    puts("done.");
+    return 0;
+}
@@ -0,0 +1,20 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("CoAP option lookup benchmark application.\r\n")
+    child.expect(r"option index: (yes|no)\r\n")
+    for _ in range(4):
+        child.expect(r"[\w ]+: parse\s+\d+ ns, lookup options\s+\d+ ns, "
+                     r"read path\s+\d+ ns\r\n", timeout=60)
+    child.expect_exact("done.\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,148 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of dispatching CoAP requests to resources
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "net/nanocoap.h"
+#include "net/nanocoap/resource_trie.h"
+#include "test_utils/expect.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_RESOURCES
+#define NUMOF_RESOURCES     (1000U)
+#endif
+
+#ifndef NUMOF_REQUESTS
+#define NUMOF_REQUESTS      (10000U)
+#endif
+
+/* requests prepared in advance, used round-robin */
+#define NUMOF_PKTS          (32U)
+#define PKT_SIZE            (32U)
+#define PATH_SIZE           (16U)
+
+/* LwM2M-like tree: /<object>/<instance>/<resource> */
+#define RES_PER_INSTANCE    (25U)
+#define INST_PER_OBJECT     (2U)
+
+static coap_resource_t _resources[NUMOF_RESOURCES];
+static char _paths[NUMOF_RESOURCES][PATH_SIZE];
+static uint8_t _bufs[NUMOF_PKTS][PKT_SIZE];
+static coap_pkt_t _pkts[NUMOF_PKTS];
+static unsigned _handled;
+
+/* simple xorshift, so the benchmark does not depend on the random module */
+static uint32_t _rand(void)
+{
+    static uint32_t state = 0x2545f491;
+
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+static ssize_t _handler(coap_pkt_t *pkt, uint8_t *buf, size_t len,
+                        coap_request_ctx_t *ctx)
+{
+    (void)pkt;
+    (void)buf;
+    (void)len;
+    (void)ctx;
+    _handled++;
+    return 0;
+}
+
+static void _init_resources(void)
+{
+    for (unsigned n = 0; n < NUMOF_RESOURCES; n++) {
+        unsigned instance = n / RES_PER_INSTANCE;
+
+        snprintf(_paths[n], sizeof(_paths[n]), "/%u/%u/%u",
+                 3 + (instance / INST_PER_OBJECT), instance % INST_PER_OBJECT,
+                 n % RES_PER_INSTANCE);
+        _resources[n] = (coap_resource_t){
+            .path = _paths[n],
+            .methods = COAP_GET | COAP_PUT,
+            .handler = _handler,
+        };
+    }
+}
+
+/* GET requests for random ones of the first numof resources */
+static void _init_requests(unsigned numof)
+{
+    for (unsigned i = 0; i < NUMOF_PKTS; i++) {
+        uint8_t *pos = _bufs[i];
+
+        pos += coap_build_hdr((coap_hdr_t *)pos, COAP_TYPE_NON, NULL, 0,
+                              COAP_METHOD_GET, i);
+        pos += coap_opt_put_uri_path(pos, 0, _paths[_rand() % numof]);
+        expect(coap_parse(&_pkts[i], _bufs[i], pos - _bufs[i]) == 0);
+    }
+}
+
+static uint32_t _req_per_s(uint32_t us)
+{
+    return ((uint64_t)NUMOF_REQUESTS * US_PER_SEC) / (us ? us : 1);
+}
+
+static void _measure(unsigned numof)
+{
+    sock_udp_ep_t remote = { 0 };
+    coap_request_ctx_t ctx = { .remote = &remote };
+    coap_resource_trie_t trie;
+    uint8_t resp[PKT_SIZE];
+    uint32_t start, linear, indexed;
+
+    expect(coap_resource_trie_init(&trie, _resources, numof) == 0);
+    _init_requests(numof);
+
+    _handled = 0;
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < NUMOF_REQUESTS; i++) {
+        coap_tree_handler(&_pkts[i % NUMOF_PKTS], resp, sizeof(resp), &ctx,
+                          _resources, numof);
+    }
+    linear = ztimer_now(ZTIMER_USEC) - start;
+    expect(_handled == NUMOF_REQUESTS);
+
+    _handled = 0;
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < NUMOF_REQUESTS; i++) {
+        coap_resource_trie_handler(&_pkts[i % NUMOF_PKTS], resp, sizeof(resp),
+                                   &ctx, &trie);
+    }
+    indexed = ztimer_now(ZTIMER_USEC) - start;
+    expect(_handled == NUMOF_REQUESTS);
+
+    printf("%4u resources: linear %8" PRIu32 " req/s, trie %8" PRIu32 " req/s\n",
+           numof, _req_per_s(linear), _req_per_s(indexed));
+}
+
+int main(void)
+{
+    puts("CoAP resource dispatch benchmark application.\n");
+    _init_resources();
+
+    for (unsigned n = 10; n <= NUMOF_RESOURCES; n *= 10) {
+        _measure(n);
+    }
+
+    puts("done.");
+    return 0;
+}
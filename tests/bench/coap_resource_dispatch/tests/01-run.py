@@ -0,0 +1,19 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("CoAP resource dispatch benchmark application.\r\n")
+    # dispatch with 10, 100, ... resources, depending on NUMOF_RESOURCES
+    while child.expect([r"\s*\d+ resources: linear\s+\d+ req/s, trie\s+\d+ req/s\r\n",
+                        "done.\r\n"], timeout=60) == 0:
+        pass
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
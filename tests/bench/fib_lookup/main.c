@@ -0,0 +1,138 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of FIB next hop lookups
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/fib.h"
+#include "test_utils/expect.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_ROUTES
+#define NUMOF_ROUTES        (1000U)
+#endif
+
+#ifndef NUMOF_LOOKUPS
+#define NUMOF_LOOKUPS       (1000U)
+#endif
+
+#define ADDR_SIZE           (16U)
+#define NUMOF_NEXT_HOPS     (4U)
+
+static fib_entry_t _entries[NUMOF_ROUTES];
+static fib_table_t _table = {
+    .data.entries = _entries,
+    .table_type = FIB_TABLE_TYPE_SH,
+    .size = NUMOF_ROUTES,
+};
+
+/* simple xorshift, so the benchmark does not depend on the random module */
+static uint32_t _rand(void)
+{
+    static uint32_t state = 0x2545f491;
+
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+/* the destination prefix of route n: fd00:<n>:<hash of n>::/64 and some /48
+ * and /56 prefixes in between, so prefixes are nested */
+static void _route(unsigned n, uint8_t *prefix, unsigned *prefix_len)
+{
+    uint32_t hash = n * 2654435761U;
+
+    memset(prefix, 0, ADDR_SIZE);
+    prefix[0] = 0xfd;
+    prefix[2] = n >> 8;
+    prefix[3] = n;
+    prefix[4] = hash >> 24;
+    prefix[5] = hash >> 16;
+    prefix[6] = hash >> 8;
+    prefix[7] = hash;
+    switch (n % 8) {
+    case 0:
+        *prefix_len = 48;
+        memset(&prefix[6], 0, 2);
+        break;
+    case 1:
+        *prefix_len = 56;
+        prefix[7] = 0;
+        break;
+    default:
+        *prefix_len = 64;
+    }
+}
+
+static void _add_routes(unsigned from, unsigned to)
+{
+    uint8_t prefix[ADDR_SIZE];
+    uint8_t next_hop[ADDR_SIZE] = { 0xfe, 0x80 };
+    unsigned prefix_len;
+
+    for (unsigned n = from; n < to; n++) {
+        _route(n, prefix, &prefix_len);
+        next_hop[15] = n % NUMOF_NEXT_HOPS;
+        expect(fib_add_entry(&_table, 1, prefix, ADDR_SIZE,
+                             prefix_len << FIB_FLAG_NET_PREFIX_SHIFT,
+                             next_hop, ADDR_SIZE, 0,
+                             (uint32_t)FIB_LIFETIME_NO_EXPIRE) == 0);
+    }
+}
+
+static void _measure(unsigned routes)
+{
+    uint8_t dst[ADDR_SIZE];
+    uint8_t next_hop[ADDR_SIZE];
+    unsigned prefix_len;
+    kernel_pid_t iface;
+    uint32_t flags;
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < NUMOF_LOOKUPS; i++) {
+        /* a random host in a random one of the routes */
+        _route(_rand() % routes, dst, &prefix_len);
+        for (unsigned j = 8; j < ADDR_SIZE; j++) {
+            dst[j] = _rand();
+        }
+        size_t next_hop_size = sizeof(next_hop);
+        expect(fib_get_next_hop(&_table, &iface, next_hop, &next_hop_size,
+                                &flags, dst, ADDR_SIZE, 0) == 0);
+    }
+    uint32_t diff = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("%4u routes: %8" PRIu32 " us / %u = %" PRIu32 " ns\n", routes, diff,
+           NUMOF_LOOKUPS, (uint32_t)(((uint64_t)diff * NS_PER_US) / NUMOF_LOOKUPS));
+}
+
+int main(void)
+{
+    unsigned routes = 0;
+
+    puts("FIB lookup benchmark application.\n");
+    fib_init(&_table);
+
+    for (unsigned n = 10; n <= NUMOF_ROUTES; n *= 10) {
+        _add_routes(routes, n);
+        routes = n;
+        _measure(routes);
+    }
+
+    puts("done.");
+    return 0;
+}
@@ -0,0 +1,19 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("FIB lookup benchmark application.\r\n")
+    # lookups with 10, 100, ... routes, depending on NUMOF_ROUTES
+    while child.expect([r"\s*\d+ routes:\s+\d+ us / \d+ = \d+ ns\r\n",
+                        "done.\r\n"], timeout=60) == 0:
+        pass
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,187 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Load test of gcoap with many concurrent confirmable requests
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "mutex.h"
+#include "schedstatistics.h"
+#include "net/gcoap.h"
+#include "net/ipv6/addr.h"
+#include "net/sock/udp.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_REQUESTS
+#define NUMOF_REQUESTS      (4096U)
+#endif
+
+#define SERVER_PORT         (5684U)
+#define BUF_SIZE            (64U)
+
+static char _server_stack[THREAD_STACKSIZE_DEFAULT];
+/* static, as its mailbox holds all requests of a round */
+static sock_udp_t _server_sock;
+static uint8_t _server_buf[BUF_SIZE];
+static uint8_t _resp_buf[BUF_SIZE];
+static uint8_t _req_buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+
+/* if set, the server answers with an empty ACK and a separate response */
+static bool _separate;
+static unsigned _responses;
+static unsigned _failures;
+static unsigned _expected;
+static mutex_t _done = MUTEX_INIT_LOCKED;
+static kernel_pid_t _gcoap_pid = KERNEL_PID_UNDEF;
+
+/* result of a round */
+typedef struct {
+    uint32_t total_us;      /* time until all responses arrived */
+    uint32_t gcoap_us;      /* time spent in the gcoap thread */
+} _round_t;
+
+static void _reply(sock_udp_t *sock, coap_pkt_t *pkt, sock_udp_ep_t *remote)
+{
+    static uint16_t mid;
+    ssize_t len;
+
+    if (_separate) {
+        len = coap_build_hdr((coap_hdr_t *)_resp_buf, COAP_TYPE_ACK, NULL, 0,
+                             COAP_CODE_EMPTY, coap_get_id(pkt));
+        sock_udp_send(sock, _resp_buf, len, remote);
+        len = coap_build_hdr((coap_hdr_t *)_resp_buf, COAP_TYPE_NON,
+                             coap_get_token(pkt), coap_get_token_len(pkt),
+                             COAP_CODE_CONTENT, mid++);
+    }
+    else {
+        len = coap_build_reply(pkt, COAP_CODE_CONTENT, _resp_buf,
+                               sizeof(_resp_buf), 0);
+    }
+    expect(len > 0);
+    sock_udp_send(sock, _resp_buf, len, remote);
+}
+
+/* runs below the priority of main, so all requests of a round are waiting
+ * before the first one is answered */
+static void *_server(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        sock_udp_ep_t remote;
+        coap_pkt_t pkt;
+        ssize_t len = sock_udp_recv(&_server_sock, _server_buf, sizeof(_server_buf),
+                                    SOCK_NO_TIMEOUT, &remote);
+
+        if ((len > 0) && (coap_parse(&pkt, _server_buf, len) == 0)) {
+            _reply(&_server_sock, &pkt, &remote);
+        }
+    }
+    return NULL;
+}
+
+static void _resp_handler(const gcoap_request_memo_t *memo, coap_pkt_t *pdu,
+                          const sock_udp_ep_t *remote)
+{
+    (void)pdu;
+    (void)remote;
+
+    _gcoap_pid = thread_getpid();
+    if (memo->state == GCOAP_MEMO_RESP) {
+        _responses++;
+    }
+    else {
+        _failures++;
+    }
+    if (_responses + _failures == _expected) {
+        mutex_unlock(&_done);
+    }
+}
+
+static uint64_t _gcoap_runtime(void)
+{
+    return (_gcoap_pid == KERNEL_PID_UNDEF) ? 0
+                                            : sched_pidlist[_gcoap_pid].runtime_us;
+}
+
+/* sends numof confirmable requests at once and waits for all responses */
+static _round_t _round(unsigned numof, bool separate)
+{
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = SERVER_PORT };
+    _round_t res;
+    uint64_t runtime;
+    uint32_t start;
+
+    ipv6_addr_set_loopback((ipv6_addr_t *)&remote.addr.ipv6);
+    _separate = separate;
+    _responses = 0;
+    _failures = 0;
+    _expected = numof;
+
+    runtime = _gcoap_runtime();
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < numof; i++) {
+        coap_pkt_t pdu;
+        ssize_t len;
+
+        gcoap_req_init(&pdu, _req_buf, sizeof(_req_buf), COAP_METHOD_GET,
+                       "/load");
+        coap_hdr_set_type(pdu.hdr, COAP_TYPE_CON);
+        len = coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE);
+        expect(gcoap_req_send(_req_buf, len, &remote, NULL, _resp_handler,
+                              NULL, GCOAP_SOCKET_TYPE_UDP) > 0);
+    }
+    mutex_lock(&_done);
+    res.total_us = ztimer_now(ZTIMER_USEC) - start;
+    /* the first round learns the PID of the gcoap thread */
+    res.gcoap_us = runtime ? _gcoap_runtime() - runtime : 0;
+
+    expect(_failures == 0);
+    expect(_responses == numof);
+    return res;
+}
+
+static void _print(const char *name, unsigned numof, _round_t res)
+{
+    printf("%s %6" PRIu32 " req/s, gcoap %6" PRIu32 " ns/req", name,
+           (uint32_t)(((uint64_t)numof * US_PER_SEC) / (res.total_us ? res.total_us : 1)),
+           (uint32_t)(((uint64_t)res.gcoap_us * NS_PER_US) / numof));
+}
+
+int main(void)
+{
+    sock_udp_ep_t local = { .family = AF_INET6, .port = SERVER_PORT };
+
+    puts("gcoap request load test application.\n");
+
+    expect(sock_udp_create(&_server_sock, &local, NULL, 0) == 0);
+    thread_create(_server_stack, sizeof(_server_stack),
+                  THREAD_PRIORITY_MAIN + 1, 0, _server, NULL, "server");
+
+    /* warm up and learn the PID of the gcoap thread */
+    _round(1, false);
+
+    for (unsigned n = 16; n <= NUMOF_REQUESTS; n *= 4) {
+        printf("%4u requests:", n);
+        _print(" piggybacked", n, _round(n, false));
+        _print(", separate", n, _round(n, true));
+        puts("");
+    }
+
+    puts("done.");
+    return 0;
+}
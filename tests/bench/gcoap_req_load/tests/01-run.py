@@ -0,0 +1,20 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("gcoap request load test application.\r\n")
+    # rounds of 16, 64, ... requests, depending on NUMOF_REQUESTS
+    while child.expect([r"\s*\d+ requests: piggybacked\s+\d+ req/s, gcoap\s+\d+ ns/req, "
+                        r"separate\s+\d+ req/s, gcoap\s+\d+ ns/req\r\n",
+                        "done.\r\n"], timeout=120) == 0:
+        pass
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
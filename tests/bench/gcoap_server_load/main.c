@@ -0,0 +1,156 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Load test of the gcoap server with requests of different sizes
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "kernel_defines.h"
+#include "sched.h"
+#include "schedstatistics.h"
+#include "net/gcoap.h"
+#include "net/ipv6/addr.h"
+#include "net/sock/udp.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_REQUESTS
+#define NUMOF_REQUESTS      (256U)
+#endif
+
+#define CLIENT_PORT         (5684U)
+#define REQ_BUF_SIZE        (512U)
+
+/* payload sizes of the requests, all fit into the default
+ * CONFIG_GCOAP_PDU_BUF_SIZE */
+static const uint16_t _payload_sizes[] = { 0, 32, 64, 96 };
+
+static sock_udp_t _client_sock;
+static uint8_t _req_buf[REQ_BUF_SIZE];
+static uint8_t _resp_buf[64];
+static uint32_t _checksum;
+static kernel_pid_t _gcoap_pid = KERNEL_PID_UNDEF;
+
+static ssize_t _load_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                             coap_request_ctx_t *ctx)
+{
+    (void)ctx;
+
+    _gcoap_pid = thread_getpid();
+    /* read the whole payload, like a handler storing it would */
+    for (unsigned i = 0; i < pdu->payload_len; i++) {
+        _checksum += pdu->payload[i];
+    }
+    return gcoap_response(pdu, buf, len, COAP_CODE_CHANGED);
+}
+
+static const coap_resource_t _resources[] = {
+    { "/load", COAP_PUT, _load_handler, NULL },
+};
+
+static gcoap_listener_t _listener = {
+    &_resources[0],
+    ARRAY_SIZE(_resources),
+    GCOAP_SOCKET_TYPE_UDP,
+    NULL,
+    NULL,
+    NULL
+};
+
+static uint64_t _gcoap_runtime(void)
+{
+    return (_gcoap_pid == KERNEL_PID_UNDEF) ? 0
+                                            : sched_pidlist[_gcoap_pid].runtime_us;
+}
+
+static size_t _build_req(uint16_t id, size_t payload_len)
+{
+    uint8_t *pos = _req_buf;
+
+    pos += coap_build_hdr((coap_hdr_t *)pos, COAP_TYPE_NON, &id, sizeof(id),
+                          COAP_METHOD_PUT, id);
+    pos += coap_opt_put_uri_path(pos, 0, "/load");
+    if (payload_len) {
+        *pos++ = COAP_PAYLOAD_MARKER;
+        memset(pos, id, payload_len);
+        pos += payload_len;
+    }
+    return pos - _req_buf;
+}
+
+/* sends NUMOF_REQUESTS requests and receives their responses, returns the
+ * number of 2.04 responses */
+static unsigned _round(size_t payload_len, uint32_t *total_us, uint32_t *gcoap_us)
+{
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = CONFIG_GCOAP_PORT };
+    unsigned changed = 0;
+    uint64_t runtime;
+    uint32_t start;
+
+    ipv6_addr_set_loopback((ipv6_addr_t *)&remote.addr.ipv6);
+
+    runtime = _gcoap_runtime();
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < NUMOF_REQUESTS; i++) {
+        size_t len = _build_req(i, payload_len);
+
+        expect(sock_udp_send(&_client_sock, _req_buf, len, &remote) > 0);
+    }
+    for (unsigned i = 0; i < NUMOF_REQUESTS; i++) {
+        coap_pkt_t pkt;
+        ssize_t len = sock_udp_recv(&_client_sock, _resp_buf, sizeof(_resp_buf),
+                                    US_PER_SEC, NULL);
+
+        expect(len > 0);
+        expect(coap_parse(&pkt, _resp_buf, len) == 0);
+        if (coap_get_code_raw(&pkt) == COAP_CODE_CHANGED) {
+            changed++;
+        }
+    }
+    *total_us = ztimer_now(ZTIMER_USEC) - start;
+    /* the first round learns the PID of the gcoap thread */
+    *gcoap_us = runtime ? _gcoap_runtime() - runtime : 0;
+    return changed;
+}
+
+int main(void)
+{
+    sock_udp_ep_t local = { .family = AF_INET6, .port = CLIENT_PORT };
+    uint32_t total_us, gcoap_us;
+
+    puts("gcoap server load test application.\n");
+
+    gcoap_register_listener(&_listener);
+    expect(sock_udp_create(&_client_sock, &local, NULL, 0) == 0);
+
+    /* warm up and learn the PID of the gcoap thread */
+    _round(0, &total_us, &gcoap_us);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_payload_sizes); i++) {
+        unsigned changed = _round(_payload_sizes[i], &total_us, &gcoap_us);
+
+        printf("%3u byte payload: %6" PRIu32 " req/s, gcoap %6" PRIu32 " ns/req, "
+               "%u of %u handled\n", _payload_sizes[i],
+               (uint32_t)(((uint64_t)NUMOF_REQUESTS * US_PER_SEC) / (total_us ? total_us : 1)),
+               (uint32_t)(((uint64_t)gcoap_us * NS_PER_US) / NUMOF_REQUESTS),
+               changed, NUMOF_REQUESTS);
+    }
+
+    puts("done.");
+    return 0;
+}
@@ -0,0 +1,20 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("gcoap server load test application.\r\n")
+    for _ in range(4):
+        child.expect(r"\s*(\d+) byte payload:\s+\d+ req/s, gcoap\s+\d+ ns/req, "
+                     r"(\d+) of (\d+) handled\r\n", timeout=60)
+        assert child.match.group(2) == child.match.group(3)
+    child.expect_exact("done.\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,271 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Latency of fast gcoap requests under a load of slow requests
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "mutex.h"
+#include "net/gcoap.h"
+#include "net/ipv6/addr.h"
+#include "net/sock/udp.h"
+#include "sched.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+/* time a slow handler keeps the CPU busy, e.g. writing to flash */
+#ifndef SLOW_US
+#define SLOW_US             (10000U)
+#endif
+
+#ifndef NUMOF_ROUNDS
+#define NUMOF_ROUNDS        (16U)
+#endif
+
+/* fast requests sent one after the other in every round */
+#define FAST_PER_ROUND      (8U)
+#define CLIENT_PORT         (5684U)
+
+/* slow requests sent at the start of every round */
+static const uint8_t _slow_per_round[] = { 0, 1, 2, 4 };
+
+static sock_udp_t _client_sock;
+static uint8_t _buf[64];
+static unsigned _slow_calls;
+
+static ssize_t _fast_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                             coap_request_ctx_t *ctx)
+{
+    (void)ctx;
+    return gcoap_response(pdu, buf, len, COAP_CODE_CONTENT);
+}
+
+static ssize_t _slow_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                             coap_request_ctx_t *ctx)
+{
+    (void)ctx;
+    _slow_calls++;
+    ztimer_spin(ZTIMER_USEC, SLOW_US);
+    return gcoap_response(pdu, buf, len, COAP_CODE_CONTENT);
+}
+
+static void _nested_resp_handler(const gcoap_request_memo_t *memo,
+                                 coap_pkt_t *pdu, const sock_udp_ep_t *remote)
+{
+    (void)pdu;
+    (void)remote;
+    mutex_unlock(memo->context);
+}
+
+/* sends a request to /fast with gcoap and waits for its response, like a
+ * handler that queries another node */
+static ssize_t _nested_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                               coap_request_ctx_t *ctx)
+{
+    (void)ctx;
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = CONFIG_GCOAP_PORT };
+    uint8_t req_buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    mutex_t done = MUTEX_INIT_LOCKED;
+    coap_pkt_t req;
+
+    ipv6_addr_set_loopback((ipv6_addr_t *)&remote.addr.ipv6);
+    gcoap_req_init(&req, req_buf, sizeof(req_buf), COAP_METHOD_GET, "/fast");
+    coap_hdr_set_type(req.hdr, COAP_TYPE_NON);
+    ssize_t req_len = coap_opt_finish(&req, COAP_OPT_FINISH_NONE);
+    expect(gcoap_req_send(req_buf, req_len, &remote, NULL,
+                          _nested_resp_handler, &done,
+                          GCOAP_SOCKET_TYPE_UDP) > 0);
+    mutex_lock(&done);
+    return gcoap_response(pdu, buf, len, COAP_CODE_CONTENT);
+}
+
+static const coap_resource_t _resources[] = {
+    { "/fast", COAP_GET, _fast_handler, NULL },
+    { "/nested", COAP_GET | COAP_OFFLOAD, _nested_handler, NULL },
+    { "/slow", COAP_GET | COAP_OFFLOAD, _slow_handler, NULL },
+};
+
+static gcoap_listener_t _listener = {
+    &_resources[0],
+    ARRAY_SIZE(_resources),
+    GCOAP_SOCKET_TYPE_UDP,
+    NULL,
+    NULL,
+    NULL
+};
+
+/* latencies of a run, in microseconds */
+typedef struct {
+    uint32_t fast_sum;
+    uint32_t fast_max;
+    uint32_t slow_sum;
+} _result_t;
+
+/* the token of a request is its sequence number in the round */
+static void _send_msg(uint16_t seq, const char *path, unsigned type,
+                      uint16_t mid)
+{
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = CONFIG_GCOAP_PORT };
+    uint8_t *pos = _buf;
+
+    ipv6_addr_set_loopback((ipv6_addr_t *)&remote.addr.ipv6);
+    pos += coap_build_hdr((coap_hdr_t *)pos, type, &seq, sizeof(seq),
+                          COAP_METHOD_GET, mid);
+    pos += coap_opt_put_uri_path(pos, 0, path);
+    expect(sock_udp_send(&_client_sock, _buf, pos - _buf, &remote) > 0);
+}
+
+static void _send(uint16_t seq, const char *path)
+{
+    static uint16_t mid;
+
+    _send_msg(seq, path, COAP_TYPE_NON, mid++);
+}
+
+/* receives a response, returns its sequence number */
+static uint16_t _recv(void)
+{
+    coap_pkt_t pkt;
+    uint16_t seq;
+    ssize_t len = sock_udp_recv(&_client_sock, _buf, sizeof(_buf), US_PER_SEC,
+                                NULL);
+
+    expect(len > 0);
+    expect(coap_parse(&pkt, _buf, len) == 0);
+    expect(coap_get_code_raw(&pkt) == COAP_CODE_CONTENT);
+    expect(coap_get_token_len(&pkt) == sizeof(seq));
+    memcpy(&seq, coap_get_token(&pkt), sizeof(seq));
+    return seq;
+}
+
+static void _round(unsigned slow, _result_t *res)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    unsigned slow_done = 0;
+
+    for (unsigned i = 0; i < slow; i++) {
+        _send(i, "/slow");
+    }
+    for (unsigned i = 0; i < FAST_PER_ROUND; i++) {
+        uint32_t sent = ztimer_now(ZTIMER_USEC);
+        uint16_t seq;
+
+        _send(slow + i, "/fast");
+        /* responses to slow requests may arrive in between */
+        while ((seq = _recv()) < slow) {
+            res->slow_sum += ztimer_now(ZTIMER_USEC) - start;
+            slow_done++;
+        }
+        expect(seq == slow + i);
+
+        uint32_t latency = ztimer_now(ZTIMER_USEC) - sent;
+        res->fast_sum += latency;
+        if (latency > res->fast_max) {
+            res->fast_max = latency;
+        }
+    }
+    while (slow_done < slow) {
+        expect(_recv() < slow);
+        res->slow_sum += ztimer_now(ZTIMER_USEC) - start;
+        slow_done++;
+    }
+}
+
+/* a retransmission of a confirmable request that is still handled must not
+ * run the handler again */
+static void _duplicate(void)
+{
+    unsigned calls = _slow_calls;
+    unsigned responses = 0;
+
+    _send_msg(UINT16_MAX, "/slow", COAP_TYPE_CON, UINT16_MAX);
+    _send_msg(UINT16_MAX, "/slow", COAP_TYPE_CON, UINT16_MAX);
+    expect(_recv() == UINT16_MAX);
+    responses++;
+    /* the retransmission would be answered right after the original */
+    if (sock_udp_recv(&_client_sock, _buf, sizeof(_buf), 2 * SLOW_US,
+                      NULL) > 0) {
+        responses++;
+    }
+    printf("duplicate: %u handler runs, %u responses\n", _slow_calls - calls,
+           responses);
+}
+
+/* offloaded handlers that wait for the gcoap thread must not deadlock it, even
+ * if they hold all buffers they can get */
+static void _nested(void)
+{
+    unsigned responses = 0;
+    unsigned rejected = 0;
+
+    for (unsigned i = 0; i < CONFIG_GCOAP_RESP_BUFS_MAX; i++) {
+        _send(i, "/nested");
+    }
+    for (unsigned i = 0; i < CONFIG_GCOAP_RESP_BUFS_MAX; i++) {
+        coap_pkt_t pkt;
+        ssize_t len = sock_udp_recv(&_client_sock, _buf, sizeof(_buf),
+                                    US_PER_SEC, NULL);
+
+        expect(len > 0);
+        expect(coap_parse(&pkt, _buf, len) == 0);
+        if (coap_get_code_raw(&pkt) == COAP_CODE_SERVICE_UNAVAILABLE) {
+            rejected++;
+        }
+        else {
+            expect(coap_get_code_raw(&pkt) == COAP_CODE_CONTENT);
+            responses++;
+        }
+    }
+    printf("nested: %u responses, %u rejected\n", responses, rejected);
+}
+
+int main(void)
+{
+    sock_udp_ep_t local = { .family = AF_INET6, .port = CLIENT_PORT };
+
+    puts("gcoap worker latency test application.\n");
+    printf("workers: %s, slow handler: %u us\n",
+           IS_USED(MODULE_GCOAP_WORKERS) ? "yes" : "no", SLOW_US);
+
+    gcoap_register_listener(&_listener);
+    expect(sock_udp_create(&_client_sock, &local, NULL, 0) == 0);
+    /* the client stands in for remote clients, which a busy gcoap thread
+     * does not keep from sending requests */
+    sched_change_priority(thread_get_active(), THREAD_PRIORITY_MAIN - 2);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_slow_per_round); i++) {
+        unsigned slow = _slow_per_round[i];
+        _result_t res = { 0 };
+
+        for (unsigned round = 0; round < NUMOF_ROUNDS; round++) {
+            _round(slow, &res);
+        }
+        printf("%u slow: fast avg %6" PRIu32 " us, max %6" PRIu32 " us, "
+               "slow avg %6" PRIu32 " us\n", slow,
+               res.fast_sum / (NUMOF_ROUNDS * FAST_PER_ROUND), res.fast_max,
+               slow ? res.slow_sum / (NUMOF_ROUNDS * slow) : 0);
+    }
+
+    _duplicate();
+    if (IS_USED(MODULE_GCOAP_WORKERS)) {
+        _nested();
+    }
+
+    puts("done.");
+    return 0;
+}
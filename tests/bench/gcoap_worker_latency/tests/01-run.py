@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("gcoap worker latency test application.\r\n")
+    child.expect(r"workers: (yes|no), slow handler: \d+ us\r\n")
+    workers = child.match.group(1) == "yes"
+    for slow in (0, 1, 2, 4):
+        child.expect(r"{} slow: fast avg\s+\d+ us, max\s+\d+ us, "
+                     r"slow avg\s+\d+ us\r\n".format(slow), timeout=60)
+    if workers:
+        child.expect_exact("duplicate: 1 handler runs, 1 responses\r\n")
+        child.expect(r"nested: (\d+) responses, 1 rejected\r\n")
+    else:
+        child.expect(r"duplicate: \d+ handler runs, \d+ responses\r\n")
+    child.expect_exact("done.\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
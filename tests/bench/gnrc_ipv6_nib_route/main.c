@@ -0,0 +1,110 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of NIB forwarding table lookups
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "test_utils/expect.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_ROUTES
+#define NUMOF_ROUTES        (32U)
+#endif
+
+#ifndef NUMOF_LOOKUPS
+#define NUMOF_LOOKUPS       (100000U)
+#endif
+
+#define IFACE               (6U)
+#define NUMOF_NEXT_HOPS     (4U)
+
+/* simple xorshift, so the benchmark does not depend on the random module */
+static uint32_t _rand(void)
+{
+    static uint32_t state = 0x2545f491;
+
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+/* destination prefix of route n: 2001:db8:<n>::/48 */
+static void _route(unsigned n, ipv6_addr_t *addr)
+{
+    ipv6_addr_set_unspecified(addr);
+    addr->u16[0] = byteorder_htons(0x2001);
+    addr->u16[1] = byteorder_htons(0x0db8);
+    addr->u16[2] = byteorder_htons(n + 1);
+}
+
+static void _add_routes(void)
+{
+    ipv6_addr_t next_hop = IPV6_ADDR_UNSPECIFIED;
+    ipv6_addr_t pfx;
+
+    ipv6_addr_set_link_local_prefix(&next_hop);
+    for (unsigned n = 0; n < NUMOF_ROUTES; n++) {
+        _route(n, &pfx);
+        next_hop.u8[15] = (n % NUMOF_NEXT_HOPS) + 1;
+        expect(gnrc_ipv6_nib_ft_add(&pfx, 48, &next_hop, IFACE, 0) == 0);
+    }
+}
+
+static void _measure(unsigned flows)
+{
+    ipv6_addr_t dsts[flows];
+    gnrc_ipv6_nib_ft_t fte;
+
+    /* a random host in a random one of the routes per flow */
+    for (unsigned i = 0; i < flows; i++) {
+        _route(_rand() % NUMOF_ROUTES, &dsts[i]);
+        dsts[i].u32[2].u32 = _rand();
+        dsts[i].u32[3].u32 = _rand();
+    }
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < NUMOF_LOOKUPS; i++) {
+        expect(gnrc_ipv6_nib_ft_get(&dsts[i % flows], NULL, &fte) == 0);
+    }
+    uint32_t diff = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("%3u flows: %8" PRIu32 " us / %u = %" PRIu32 " lookups/s\n",
+           flows, diff, NUMOF_LOOKUPS,
+           (uint32_t)(((uint64_t)NUMOF_LOOKUPS * US_PER_SEC) / diff));
+}
+
+int main(void)
+{
+    puts("NIB route lookup benchmark application.\n");
+    _add_routes();
+
+    for (unsigned flows = 1; flows <= 64; flows *= 4) {
+        _measure(flows);
+    }
+
+#if IS_USED(MODULE_GNRC_IPV6_NIB_ROUTE_CACHE)
+    gnrc_ipv6_nib_ft_cache_stats_t stats;
+
+    gnrc_ipv6_nib_ft_cache_stats(&stats);
+    printf("route cache: %" PRIu32 " hits, %" PRIu32 " misses\n",
+           stats.hits, stats.misses);
+#endif
+
+    puts("done.");
+    return 0;
+}
@@ -0,0 +1,20 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("NIB route lookup benchmark application.\r\n")
+    # lookups with 1, 4, 16 and 64 flows
+    for _ in range(4):
+        child.expect(r"\s*\d+ flows:\s+\d+ us / \d+ = \d+ lookups/s\r\n",
+                     timeout=60)
+    child.expect_exact("done.\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
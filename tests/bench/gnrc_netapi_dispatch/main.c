@@ -0,0 +1,118 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of packet bursts dispatched via netapi
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "ztimer.h"
+
+#ifndef TEST_DURATION_US
+#define TEST_DURATION_US    (1000000U)
+#endif
+
+#ifndef BURST_SIZE
+#define BURST_SIZE          (8U)
+#endif
+
+#define QUEUE_SIZE          (16U)
+#define FLAG_DONE           (0x1)
+
+static char _stack[THREAD_STACKSIZE_MAIN];
+static msg_t _queue[QUEUE_SIZE];
+static thread_t *_main_thread;
+static bool _batch;
+
+static void *_receiver(void *arg)
+{
+    (void)arg;
+    gnrc_netreg_entry_t entry;
+    msg_t msgs[QUEUE_SIZE];
+    unsigned received = 0;
+
+    msg_init_queue(_queue, QUEUE_SIZE);
+    gnrc_netreg_entry_init_pid(&entry, GNRC_NETREG_DEMUX_CTX_ALL,
+                               thread_getpid());
+    gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &entry);
+    thread_flags_set(_main_thread, FLAG_DONE);
+
+    while (1) {
+        int num;
+
+        if (_batch) {
+            num = msg_receive_many(msgs, ARRAY_SIZE(msgs));
+        }
+        else {
+            num = msg_receive(msgs);
+        }
+        for (int i = 0; i < num; i++) {
+            gnrc_pktbuf_release(msgs[i].content.ptr);
+        }
+        received += num;
+        if (received >= BURST_SIZE) {
+            received -= BURST_SIZE;
+            thread_flags_set(_main_thread, FLAG_DONE);
+        }
+    }
+
+    return NULL;
+}
+
+static uint32_t _run(bool batch)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    uint32_t pkts = 0;
+
+    _batch = batch;
+    while ((ztimer_now(ZTIMER_USEC) - start) < TEST_DURATION_US) {
+        for (unsigned i = 0; i < BURST_SIZE; i++) {
+            gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, 64,
+                                                  GNRC_NETTYPE_UNDEF);
+            if (!gnrc_netapi_dispatch_receive(GNRC_NETTYPE_UNDEF,
+                                              GNRC_NETREG_DEMUX_CTX_ALL, pkt)) {
+                gnrc_pktbuf_release(pkt);
+            }
+        }
+        /* the receiver runs at a lower priority, so it only gets to process
+         * the burst when we block here */
+        thread_flags_wait_any(FLAG_DONE);
+        pkts += BURST_SIZE;
+    }
+
+    return pkts;
+}
+
+int main(void)
+{
+    _main_thread = thread_get_active();
+    thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN + 1, 0,
+                  _receiver, NULL, "receiver");
+    /* wait for the receiver to register */
+    thread_flags_wait_any(FLAG_DONE);
+
+    uint32_t single = _run(false);
+    uint32_t batch = _run(true);
+
+    printf("{ \"msg_receive\" : %" PRIu32 ", \"msg_receive_many\" : %" PRIu32
+           " }\n", single, batch);
+
+    return 0;
+}
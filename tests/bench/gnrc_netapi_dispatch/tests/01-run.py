@@ -0,0 +1,16 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"{ \"msg_receive\" : \d+, \"msg_receive_many\" : \d+ }",
+                 timeout=10)
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,237 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of the receive path of GNRC network interfaces
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/ethernet.h"
+#include "net/gnrc.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/ieee802154.h"
+#include "net/netdev_test.h"
+#include "test_utils/expect.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_FRAMES
+#define NUMOF_FRAMES        (20000U)
+#endif
+
+/**
+ * @brief   Time in microseconds every call to the receive function of the
+ *          device takes, e.g. for bus transfers to a transceiver
+ */
+#ifndef RECV_ACCESS_US
+#define RECV_ACCESS_US      (0U)
+#endif
+
+#define ETHERTYPE_BENCH     (0x88b5)    /* local experimental ethertype */
+
+#define LOCAL_L2            { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01 }
+#define REMOTE_L2           { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x02 }
+
+static const uint8_t _local_l2[] = LOCAL_L2;
+static const uint8_t _remote_l2[] = REMOTE_L2;
+
+static gnrc_netif_t _eth_netif, _wpan_netif;
+static char _eth_netif_stack[THREAD_STACKSIZE_DEFAULT];
+static char _wpan_netif_stack[THREAD_STACKSIZE_DEFAULT];
+static netdev_test_t _eth_dev, _wpan_dev;
+
+static uint8_t _frame[ETHERNET_FRAME_LEN];
+static size_t _frame_len;
+static unsigned _recv_calls;
+static unsigned _received;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = (dev == &_eth_dev.netdev.netdev)
+                         ? NETDEV_TYPE_ETHERNET
+                         : NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_proto(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(gnrc_nettype_t));
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_UNDEF;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _get_max_pdu_size(netdev_t *dev, void *value, size_t max_len)
+{
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = (dev == &_eth_dev.netdev.netdev)
+                         ? ETHERNET_DATA_LEN
+                         : 102U;
+    return sizeof(uint16_t);
+}
+
+static int _get_src_len(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = sizeof(_local_l2);
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= ETHERNET_ADDR_LEN);
+    memcpy(value, _local_l2, ETHERNET_ADDR_LEN);
+    return ETHERNET_ADDR_LEN;
+}
+
+static int _get_address_long(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_local_l2));
+    memcpy(value, _local_l2, sizeof(_local_l2));
+    return sizeof(_local_l2);
+}
+
+/* behaves like a radio that knows the length of the received frame */
+static int _recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    (void)dev;
+    (void)info;
+    _recv_calls++;
+    if (RECV_ACCESS_US > 0) {
+        ztimer_spin(ZTIMER_USEC, RECV_ACCESS_US);
+    }
+    if (buf == NULL) {
+        return _frame_len;
+    }
+    if ((size_t)len < _frame_len) {
+        return -ENOBUFS;
+    }
+    memcpy(buf, _frame, _frame_len);
+    return _frame_len;
+}
+
+static void _isr(netdev_t *dev)
+{
+    dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+}
+
+static void _sink(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    (void)ctx;
+    expect(cmd == GNRC_NETAPI_MSG_TYPE_RCV);
+    _received++;
+    gnrc_pktbuf_release(pkt);
+}
+
+static gnrc_netreg_entry_cbd_t _sink_cbd = { .cb = _sink };
+static gnrc_netreg_entry_t _sink_entry;
+
+static void _init_dev(netdev_test_t *dev)
+{
+    netdev_test_setup(dev, NULL);
+    netdev_test_set_get_cb(dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(dev, NETOPT_PROTO, _get_proto);
+    netdev_test_set_get_cb(dev, NETOPT_MAX_PDU_SIZE, _get_max_pdu_size);
+    netdev_test_set_get_cb(dev, NETOPT_SRC_LEN, _get_src_len);
+    netdev_test_set_get_cb(dev, NETOPT_ADDRESS, _get_address);
+    netdev_test_set_get_cb(dev, NETOPT_ADDRESS_LONG, _get_address_long);
+    netdev_test_set_recv_cb(dev, _recv);
+    netdev_test_set_isr_cb(dev, _isr);
+}
+
+static void _init(void)
+{
+    _init_dev(&_eth_dev);
+    _init_dev(&_wpan_dev);
+    expect(gnrc_netif_ethernet_create(&_eth_netif, _eth_netif_stack,
+                                      sizeof(_eth_netif_stack),
+                                      GNRC_NETIF_PRIO, "bench_eth",
+                                      &_eth_dev.netdev.netdev) == 0);
+    expect(gnrc_netif_ieee802154_create(&_wpan_netif, _wpan_netif_stack,
+                                        sizeof(_wpan_netif_stack),
+                                        GNRC_NETIF_PRIO, "bench_wpan",
+                                        &_wpan_dev.netdev.netdev) == 0);
+    gnrc_netreg_entry_init_cb(&_sink_entry, GNRC_NETREG_DEMUX_CTX_ALL,
+                              &_sink_cbd);
+    gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &_sink_entry);
+}
+
+static void _eth_frame(size_t payload_len)
+{
+    ethernet_hdr_t *hdr = (ethernet_hdr_t *)_frame;
+
+    memcpy(hdr->dst, _local_l2, ETHERNET_ADDR_LEN);
+    memcpy(hdr->src, _remote_l2, ETHERNET_ADDR_LEN);
+    hdr->type = byteorder_htons(ETHERTYPE_BENCH);
+    memset(hdr + 1, 0xab, payload_len);
+    _frame_len = sizeof(*hdr) + payload_len;
+}
+
+static void _wpan_frame(size_t payload_len)
+{
+    static const le_uint16_t pan = { .u16 = 0x23 };
+    int res = ieee802154_set_frame_hdr(_frame, _local_l2, sizeof(_local_l2),
+                                       _remote_l2, sizeof(_remote_l2),
+                                       pan, pan,
+                                       IEEE802154_FCF_TYPE_DATA, 0);
+
+    expect(res > 0);
+    memset(&_frame[res], 0xab, payload_len);
+    _frame_len = res + payload_len;
+}
+
+static void _measure(const char *name, netdev_t *dev)
+{
+    uint32_t start, diff;
+
+    _recv_calls = 0;
+    _received = 0;
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < NUMOF_FRAMES; i++) {
+        /* the interface thread has a higher priority, so the frame is
+         * handled completely before this returns */
+        netdev_trigger_event_isr(dev);
+    }
+    diff = ztimer_now(ZTIMER_USEC) - start;
+    expect(_received == NUMOF_FRAMES);
+    printf("%-16s %8" PRIu32 " us / %u = %5" PRIu32 " ns/frame, "
+           "%7" PRIu32 " frames/s, %u recv() calls/frame\n",
+           name, diff, NUMOF_FRAMES,
+           (uint32_t)(((uint64_t)diff * NS_PER_US) / NUMOF_FRAMES),
+           (uint32_t)(((uint64_t)NUMOF_FRAMES * US_PER_SEC) / diff),
+           _recv_calls / NUMOF_FRAMES);
+}
+
+int main(void)
+{
+    puts("GNRC netif receive benchmark application.\n");
+    _init();
+
+    _eth_frame(64);
+    _measure("Ethernet 78B", &_eth_dev.netdev.netdev);
+    _eth_frame(ETHERNET_DATA_LEN);
+    _measure("Ethernet 1514B", &_eth_dev.netdev.netdev);
+    _wpan_frame(16);
+    _measure("802.15.4 37B", &_wpan_dev.netdev.netdev);
+    _wpan_frame(IEEE802154_FRAME_LEN_MAX - IEEE802154_FCS_LEN - 21);
+    _measure("802.15.4 125B", &_wpan_dev.netdev.netdev);
+
+    puts("done.");
+    return 0;
+}
@@ -0,0 +1,19 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("GNRC netif receive benchmark application.\r\n")
+    for _ in range(4):
+        child.expect(r"[\w. ]+\s+\d+ us / \d+ = \s*\d+ ns/frame, \s*\d+ frames/s, "
+                     r"\d+ recv\(\) calls/frame\r\n", timeout=60)
+    child.expect_exact("done.\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
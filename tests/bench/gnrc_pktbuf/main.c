@@ -0,0 +1,119 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of packet buffer allocations under a fragment mix
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "net/gnrc/pktbuf.h"
+#include "random.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_PKTS
+#define NUMOF_PKTS  (16U)
+#endif
+
+#ifndef NUMOF_HDRS
+#define NUMOF_HDRS  (3U)
+#endif
+
+#ifndef ROUNDS
+#define ROUNDS      (10000U)
+#endif
+
+#ifndef SEED
+#define SEED        (0x6c0f)
+#endif
+
+static gnrc_pktsnip_t *_pkts[NUMOF_PKTS];
+static unsigned _failed;
+
+static gnrc_pktsnip_t *_build_pkt(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL,
+                                          random_uint32_range(16, 128),
+                                          GNRC_NETTYPE_UNDEF);
+
+    for (unsigned i = 0; (pkt != NULL) && (i < NUMOF_HDRS); i++) {
+        gnrc_pktsnip_t *hdr = gnrc_pktbuf_add(pkt, NULL,
+                                              random_uint32_range(2, 41),
+                                              GNRC_NETTYPE_UNDEF);
+        if (hdr == NULL) {
+            gnrc_pktbuf_release(pkt);
+        }
+        pkt = hdr;
+    }
+    if (pkt == NULL) {
+        _failed++;
+    }
+    return pkt;
+}
+
+static size_t _largest_alloc(void)
+{
+    size_t lower = 0, upper = CONFIG_GNRC_PKTBUF_SIZE + 1;
+
+    /* binary search for the largest snip that can still be allocated */
+    while ((upper - lower) > 1) {
+        size_t size = lower + ((upper - lower) / 2);
+        gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, size,
+                                              GNRC_NETTYPE_UNDEF);
+
+        if (pkt == NULL) {
+            upper = size;
+        }
+        else {
+            gnrc_pktbuf_release(pkt);
+            lower = size;
+        }
+    }
+    return lower;
+}
+
+int main(void)
+{
+    unsigned ops = 0;
+    uint32_t start, runtime;
+
+    puts("gnrc_pktbuf benchmark application.");
+    random_init(SEED);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned round = 0; round < ROUNDS; round++) {
+        unsigned i = random_uint32_range(0, NUMOF_PKTS);
+
+        if (_pkts[i] == NULL) {
+            _pkts[i] = _build_pkt();
+        }
+        else {
+            gnrc_pktbuf_release(_pkts[i]);
+            _pkts[i] = NULL;
+        }
+        ops++;
+    }
+    runtime = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("{ \"ops\" : %u, \"failed\" : %u, \"us\" : %" PRIu32
+           ", \"largest\" : %u }\n", ops, _failed, runtime,
+           (unsigned)_largest_alloc());
+#ifdef DEVELHELP
+    gnrc_pktbuf_stats();
+#endif
+    for (unsigned i = 0; i < NUMOF_PKTS; i++) {
+        gnrc_pktbuf_release(_pkts[i]);
+    }
+    puts("done.");
+
+    return 0;
+}
@@ -0,0 +1,177 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of the packet buffer used by multiple threads
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "container.h"
+#include "msg.h"
+#include "net/gnrc/pktbuf.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_WORKERS
+#define NUMOF_WORKERS   (3U)
+#endif
+
+#ifndef NUMOF_PKTS
+#define NUMOF_PKTS      (4U)
+#endif
+
+#ifndef PAYLOAD_MIN
+#define PAYLOAD_MIN     (8U)
+#endif
+
+#ifndef PAYLOAD_MAX
+#define PAYLOAD_MAX     (96U)
+#endif
+
+#ifndef ROUNDS
+#define ROUNDS          (20000U)
+#endif
+
+#ifndef RX_PERIOD_US
+#define RX_PERIOD_US    (100U)
+#endif
+
+#define MSG_TYPE_DONE   (0x4b1d)
+
+typedef struct {
+    gnrc_pktsnip_t *pkts[NUMOF_PKTS];
+    uint32_t seed;
+    unsigned ops;
+    unsigned failed;
+} worker_t;
+
+static char _worker_stacks[NUMOF_WORKERS][THREAD_STACKSIZE_DEFAULT];
+static char _rx_stack[THREAD_STACKSIZE_DEFAULT];
+static worker_t _workers[NUMOF_WORKERS];
+static kernel_pid_t _main_pid;
+static volatile bool _running = true;
+static unsigned _rx_ops;
+static unsigned _rx_failed;
+
+/* the random module is not thread-safe, so every thread has its own LCG */
+static unsigned _rand_range(uint32_t *seed, unsigned lower, unsigned upper)
+{
+    *seed = (*seed * 1664525U) + 1013904223U;
+    return lower + ((*seed >> 16) % (upper - lower));
+}
+
+static gnrc_pktsnip_t *_build_pkt(uint32_t *seed)
+{
+    /* UDP, IPv6 and network interface header */
+    static const uint8_t hdr_sizes[] = { 8, 40, 24 };
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL,
+                                          _rand_range(seed, PAYLOAD_MIN,
+                                                      PAYLOAD_MAX + 1),
+                                          GNRC_NETTYPE_UNDEF);
+
+    for (unsigned i = 0; (pkt != NULL) && (i < ARRAY_SIZE(hdr_sizes)); i++) {
+        gnrc_pktsnip_t *hdr = gnrc_pktbuf_add(pkt, NULL, hdr_sizes[i],
+                                              GNRC_NETTYPE_UNDEF);
+        if (hdr == NULL) {
+            gnrc_pktbuf_release(pkt);
+        }
+        pkt = hdr;
+    }
+    return pkt;
+}
+
+/* behaves like a network stack thread: keeps a few packets in flight and
+ * hands over to the other threads in between */
+static void *_worker(void *arg)
+{
+    worker_t *worker = arg;
+    msg_t msg = { .type = MSG_TYPE_DONE };
+
+    for (unsigned round = 0; round < ROUNDS; round++) {
+        unsigned i = round % NUMOF_PKTS;
+
+        gnrc_pktbuf_release(worker->pkts[i]);
+        worker->pkts[i] = _build_pkt(&worker->seed);
+        if (worker->pkts[i] == NULL) {
+            worker->failed++;
+        }
+        worker->ops += 2;
+        thread_yield();
+    }
+    for (unsigned i = 0; i < NUMOF_PKTS; i++) {
+        gnrc_pktbuf_release(worker->pkts[i]);
+        worker->pkts[i] = NULL;
+    }
+    msg_send(&msg, _main_pid);
+    return NULL;
+}
+
+/* behaves like a network interface thread woken up by its device, which
+ * preempts the other threads at arbitrary points */
+static void *_rx(void *arg)
+{
+    uint32_t seed = 0x6c0f;
+
+    (void)arg;
+    while (_running) {
+        gnrc_pktsnip_t *pkt;
+
+        ztimer_sleep(ZTIMER_USEC, RX_PERIOD_US);
+        pkt = _build_pkt(&seed);
+        if (pkt == NULL) {
+            _rx_failed++;
+        }
+        gnrc_pktbuf_release(pkt);
+        _rx_ops += 2;
+    }
+    return NULL;
+}
+
+int main(void)
+{
+    unsigned ops = 0, failed = 0;
+    uint32_t start, runtime;
+
+    puts("gnrc_pktbuf multithreaded benchmark application.");
+    _main_pid = thread_getpid();
+    thread_create(_rx_stack, sizeof(_rx_stack), THREAD_PRIORITY_MAIN - 2, 0,
+                  _rx, NULL, "rx");
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < NUMOF_WORKERS; i++) {
+        _workers[i].seed = i;
+        thread_create(_worker_stacks[i], sizeof(_worker_stacks[i]),
+                      THREAD_PRIORITY_MAIN - 1, 0, _worker, &_workers[i],
+                      "worker");
+    }
+    for (unsigned i = 0; i < NUMOF_WORKERS; i++) {
+        msg_t msg;
+
+        msg_receive(&msg);
+    }
+    runtime = ztimer_now(ZTIMER_USEC) - start;
+    _running = false;
+
+    for (unsigned i = 0; i < NUMOF_WORKERS; i++) {
+        ops += _workers[i].ops;
+        failed += _workers[i].failed;
+    }
+    printf("{ \"ops\" : %u, \"failed\" : %u, \"us\" : %" PRIu32 " }\n",
+           ops + _rx_ops, failed + _rx_failed, runtime);
+#ifdef DEVELHELP
+    gnrc_pktbuf_stats();
+#endif
+    puts("done.");
+
+    return 0;
+}
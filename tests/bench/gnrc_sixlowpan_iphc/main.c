@@ -0,0 +1,245 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of 6LoWPAN IPHC compression and decompression
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/sixlowpan/ctx.h"
+#include "net/gnrc/sixlowpan/iphc.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "test_utils/expect.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_CTXS
+#define NUMOF_CTXS          (4U)
+#endif
+
+#ifndef NUMOF_PACKETS
+#define NUMOF_PACKETS       (20000U)
+#endif
+
+#define PAYLOAD_SIZE        (32U)
+
+#define LOCAL_L2            { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01 }
+#define REMOTE_L2           { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x02 }
+
+static const uint8_t _local_l2[] = LOCAL_L2;
+static const uint8_t _remote_l2[] = REMOTE_L2;
+static const uint8_t _payload[PAYLOAD_SIZE];
+
+static gnrc_netif_t _netif;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static netdev_test_t _dev;
+
+/* last frame sent, without MAC header */
+static uint8_t _frame[128];
+static size_t _frame_len;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_proto(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(gnrc_nettype_t));
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _get_max_pdu_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = 102U;
+    return sizeof(uint16_t);
+}
+
+static int _get_src_len(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = sizeof(_local_l2);
+    return sizeof(uint16_t);
+}
+
+static int _get_address_long(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_local_l2));
+    memcpy(value, _local_l2, sizeof(_local_l2));
+    return sizeof(_local_l2);
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    int res = iolist->iol_len;
+
+    (void)dev;
+    _frame_len = 0;
+    /* skip MAC header */
+    for (iolist = iolist->iol_next; iolist; iolist = iolist->iol_next) {
+        expect((_frame_len + iolist->iol_len) <= sizeof(_frame));
+        memcpy(&_frame[_frame_len], iolist->iol_base, iolist->iol_len);
+        _frame_len += iolist->iol_len;
+    }
+    return res + _frame_len;
+}
+
+static void _init_netif(void)
+{
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_PROTO, _get_proto);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _get_max_pdu_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_SRC_LEN, _get_src_len);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS_LONG, _get_address_long);
+    netdev_test_set_send_cb(&_dev, _send);
+    expect(gnrc_netif_ieee802154_create(&_netif, _netif_stack,
+                                        sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                        "bench_wpan",
+                                        &_dev.netdev.netdev) == 0);
+}
+
+/* 2001:db8:0:<n>::/64 */
+static void _prefix(unsigned n, ipv6_addr_t *addr)
+{
+    ipv6_addr_set_unspecified(addr);
+    addr->u16[0] = byteorder_htons(0x2001);
+    addr->u16[1] = byteorder_htons(0x0db8);
+    addr->u16[3] = byteorder_htons(n);
+}
+
+static void _add_ctxs(void)
+{
+    ipv6_addr_t pfx;
+
+    for (unsigned n = 0; n < NUMOF_CTXS; n++) {
+        _prefix(n, &pfx);
+        expect(gnrc_sixlowpan_ctx_update(n, &pfx, 64, UINT16_MAX, true));
+    }
+}
+
+/* addresses with the IIDs derived from the link-layer addresses, so they can
+ * be elided completely */
+static void _addrs(int ctx, ipv6_addr_t *src, ipv6_addr_t *dst)
+{
+    if (ctx < 0) {
+        ipv6_addr_set_link_local_prefix(src);
+        ipv6_addr_set_link_local_prefix(dst);
+    }
+    else {
+        _prefix(ctx, src);
+        _prefix(ctx, dst);
+    }
+    memcpy(&src->u8[8], _local_l2, sizeof(_local_l2));
+    memcpy(&dst->u8[8], _remote_l2, sizeof(_remote_l2));
+    src->u8[8] ^= 0x02;
+    dst->u8[8] ^= 0x02;
+}
+
+static gnrc_pktsnip_t *_build_ipv6(const ipv6_addr_t *src,
+                                   const ipv6_addr_t *dst)
+{
+    gnrc_pktsnip_t *pkt, *netif;
+
+    pkt = gnrc_pktbuf_add(NULL, _payload, sizeof(_payload),
+                          GNRC_NETTYPE_UNDEF);
+    expect(pkt != NULL);
+    pkt = gnrc_ipv6_hdr_build(pkt, src, dst);
+    expect(pkt != NULL);
+    ((ipv6_hdr_t *)pkt->data)->nh = PROTNUM_IPV6_NONXT;
+    ((ipv6_hdr_t *)pkt->data)->hl = 64;
+    netif = gnrc_netif_hdr_build(NULL, 0, _remote_l2, sizeof(_remote_l2));
+    expect(netif != NULL);
+    gnrc_netif_hdr_set_netif(netif->data, &_netif);
+    return gnrc_pkt_prepend(pkt, netif);
+}
+
+static gnrc_pktsnip_t *_build_sixlo(void)
+{
+    gnrc_pktsnip_t *pkt, *netif;
+
+    netif = gnrc_netif_hdr_build(_local_l2, sizeof(_local_l2),
+                                 _remote_l2, sizeof(_remote_l2));
+    expect(netif != NULL);
+    gnrc_netif_hdr_set_netif(netif->data, &_netif);
+    pkt = gnrc_pktbuf_add(netif, _frame, _frame_len, GNRC_NETTYPE_SIXLOWPAN);
+    expect(pkt != NULL);
+    return pkt;
+}
+
+static void _print(const char *op, const char *name, uint32_t diff)
+{
+    printf("%s %-12s %8" PRIu32 " us / %u = %5" PRIu32 " ns/packet\n",
+           op, name, diff, NUMOF_PACKETS,
+           (uint32_t)(((uint64_t)diff * NS_PER_US) / NUMOF_PACKETS));
+}
+
+static void _measure(const char *name, int ctx)
+{
+    ipv6_addr_t src, dst;
+    uint32_t start, diff;
+    size_t frame_len;
+
+    _addrs(ctx, &src, &dst);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < NUMOF_PACKETS; i++) {
+        gnrc_sixlowpan_iphc_send(_build_ipv6(&src, &dst), NULL, 0);
+    }
+    diff = ztimer_now(ZTIMER_USEC) - start;
+    _print("encode", name, diff);
+    frame_len = _frame_len;
+    printf("%-19s %u byte IPHC header\n", "",
+           (unsigned)(frame_len - sizeof(_payload)));
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < NUMOF_PACKETS; i++) {
+        gnrc_sixlowpan_iphc_recv(_build_sixlo(), NULL, 0);
+    }
+    diff = ztimer_now(ZTIMER_USEC) - start;
+    _print("decode", name, diff);
+    /* nobody else sent anything in between */
+    expect(_frame_len == frame_len);
+}
+
+int main(void)
+{
+    static char name[16];
+
+    puts("6LoWPAN IPHC benchmark application.\n");
+    _init_netif();
+    _add_ctxs();
+
+    _measure("link-local", -1);
+    for (unsigned n = 0; n < NUMOF_CTXS; n += (NUMOF_CTXS > 1) ? NUMOF_CTXS - 1 : 1) {
+        snprintf(name, sizeof(name), "context %u", n);
+        _measure(name, n);
+    }
+
+    puts("done.");
+    return 0;
+}
@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("6LoWPAN IPHC benchmark application.\r\n")
+    # link-local, first and last context (the latter only with > 1 context)
+    for _ in range(2):
+        child.expect(r"encode [\w -]+\s+\d+ us / \d+ = \s*\d+ ns/packet\r\n",
+                     timeout=60)
+        child.expect(r"\s+\d+ byte IPHC header\r\n")
+        child.expect(r"decode [\w -]+\s+\d+ us / \d+ = \s*\d+ ns/packet\r\n",
+                     timeout=60)
+    child.expect_exact("done.\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
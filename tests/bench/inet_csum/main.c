@@ -0,0 +1,127 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of the Internet Checksum calculation
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "net/inet_csum.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef BENCH_BYTES
+#define BENCH_BYTES         (16U * 1024U * 1024U)
+#endif
+
+#define MAX_SIZE            (1280U)
+#define MAX_ALIGN           (4U)
+
+static uint8_t _src[MAX_SIZE + MAX_ALIGN] __attribute__((aligned(8)));
+static uint8_t _dst[MAX_SIZE + MAX_ALIGN] __attribute__((aligned(8)));
+
+/* the byte-pair loop inet_csum_slice() used to be */
+static uint16_t _ref_csum(uint16_t sum, const uint8_t *buf, uint16_t len)
+{
+    uint32_t csum = sum;
+
+    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
+        csum += (uint16_t)(*buf << 8) + *(buf + 1);
+    }
+    if (len & 1) {
+        csum += (uint16_t)(*buf << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+static uint16_t _run_ref(uint8_t *dst, const uint8_t *src, uint16_t len)
+{
+    (void)dst;
+    return _ref_csum(0, src, len);
+}
+
+static uint16_t _run_csum(uint8_t *dst, const uint8_t *src, uint16_t len)
+{
+    (void)dst;
+    return inet_csum(0, src, len);
+}
+
+static uint16_t _run_memcpy_csum(uint8_t *dst, const uint8_t *src, uint16_t len)
+{
+    memcpy(dst, src, len);
+    return inet_csum(0, dst, len);
+}
+
+static uint16_t _run_csum_copy(uint8_t *dst, const uint8_t *src, uint16_t len)
+{
+    return inet_csum_slice_copy(0, dst, src, len, 0);
+}
+
+static const struct {
+    const char *name;
+    uint16_t (*run)(uint8_t *, const uint8_t *, uint16_t);
+} _variants[] = {
+    { "reference", _run_ref },
+    { "inet_csum", _run_csum },
+    { "memcpy+inet_csum", _run_memcpy_csum },
+    { "inet_csum_slice_copy", _run_csum_copy },
+};
+
+static void _measure(unsigned variant, uint16_t size, unsigned align)
+{
+    const uint8_t *src = &_src[align];
+    uint8_t *dst = &_dst[align];
+    unsigned rounds = BENCH_BYTES / size;
+    /* keep the compiler from optimizing the calls away */
+    volatile uint16_t sum;
+
+    sum = _ref_csum(0, src, size);
+    expect(_variants[variant].run(dst, src, size) == sum);
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < rounds; i++) {
+        sum = _variants[variant].run(dst, src, size);
+    }
+    uint32_t diff = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("%-20s %4u bytes, align %u: %8" PRIu32 " us = %6" PRIu32 " KiB/s\n",
+           _variants[variant].name, size, align, diff,
+           (uint32_t)((uint64_t)rounds * size * 1000000U / 1024U / diff));
+}
+
+int main(void)
+{
+    static const uint16_t sizes[] = { 64, 512, MAX_SIZE };
+
+    puts("inet_csum benchmark application.\n");
+
+    for (unsigned i = 0; i < sizeof(_src); i++) {
+        _src[i] = (uint8_t)(i * 0x9d + 0x42);
+    }
+
+    for (unsigned v = 0; v < ARRAY_SIZE(_variants); v++) {
+        for (unsigned s = 0; s < ARRAY_SIZE(sizes); s++) {
+            for (unsigned align = 0; align < MAX_ALIGN; align++) {
+                _measure(v, sizes[s], align);
+            }
+        }
+    }
+
+    puts("done.");
+    return 0;
+}
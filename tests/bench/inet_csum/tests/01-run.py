@@ -0,0 +1,20 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("inet_csum benchmark application.\r\n")
+    # 4 variants, 3 sizes, 4 alignments
+    for _ in range(4 * 3 * 4):
+        child.expect(r"\S+\s+\d+ bytes, align \d: \s*\d+ us = \s*\d+ KiB/s\r\n",
+                     timeout=60)
+    child.expect_exact("done.\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
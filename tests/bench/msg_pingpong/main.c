@@ -18,13 +18,16 @@
  * @}
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdatomic.h>
 #include <stdio.h>
 #include "macros/units.h"
 #include "thread.h"
 #include "clk.h"
+#include "time_units.h"
 
+#include "irq.h"
 #include "msg.h"
 #include "xtimer.h"
 
@@ -32,7 +35,67 @@
 #define TEST_DURATION_US    (1000000U)
 #endif
 
+#ifndef TEST_QUEUE_SIZE
+#define TEST_QUEUE_SIZE     (16U)
+#endif
+
+#ifndef TEST_ISR_ROUNDS
+#define TEST_ISR_ROUNDS     (1000U)
+#endif
+
+#ifndef TEST_ISR_PERIOD_US
+#define TEST_ISR_PERIOD_US  (100U)
+#endif
+
 static char _stack[THREAD_STACKSIZE_MAIN];
+static char _queue_stack[THREAD_STACKSIZE_MAIN];
+static msg_t _queue[TEST_QUEUE_SIZE];
+
+/* windows with interrupts disabled, in microseconds */
+typedef struct {
+    uint32_t max;
+    uint32_t sum;
+    uint32_t count;
+} irq_off_t;
+
+#if MEASURE_IRQ_OFF
+/* On native, irq_disable() and irq_restore() are functions, so the Makefile
+ * wraps them to time every window in which a measured call disables
+ * interrupts. Windows of nested irq_disable() calls are not counted
+ * separately. */
+static volatile bool _measuring;
+static bool _irq_off_open;
+static uint32_t _irq_off_start;
+static irq_off_t _irq_off;
+
+unsigned __real_irq_disable(void);
+void __real_irq_restore(unsigned state);
+
+unsigned __wrap_irq_disable(void)
+{
+    unsigned state = __real_irq_disable();
+
+    /* a window ended by irq_enable() instead of irq_restore() is dropped */
+    if (state && _measuring && !irq_is_in()) {
+        _irq_off_open = true;
+        _irq_off_start = xtimer_now_usec();
+    }
+    return state;
+}
+
+void __wrap_irq_restore(unsigned state)
+{
+    if (state && _irq_off_open) {
+        uint32_t diff = xtimer_now_usec() - _irq_off_start;
+
+        _irq_off_open = false;
+        _irq_off.max = (diff > _irq_off.max) ? diff : _irq_off.max;
+        _irq_off.sum += diff;
+        _irq_off.count++;
+    }
+    __real_irq_restore(state);
+}
+#endif
 
 static void _timer_callback(void *_flag)
 {
@@ -52,6 +115,103 @@ static void *_second_thread(void *arg)
     return NULL;
 }
 
+static void *_queue_thread(void *arg)
+{
+    (void)arg;
+
+    msg_init_queue(_queue, TEST_QUEUE_SIZE);
+    while (1) {
+        msg_t test;
+        msg_receive(&test);
+    }
+
+    return NULL;
+}
+
+static uint32_t _measure_queued(xtimer_t *timer, atomic_flag *flag,
+                                kernel_pid_t other)
+{
+    atomic_flag_test_and_set(flag);
+    xtimer_set(timer, TEST_DURATION_US);
+
+    uint32_t n = 0;
+
+    /* fill the queue of the other thread, which runs at the same priority,
+     * and let it empty the queue whenever it is full */
+    while (atomic_flag_test_and_set(flag)) {
+        msg_t test;
+#if MEASURE_IRQ_OFF
+        _measuring = true;
+#endif
+        int res = msg_try_send(&test, other);
+#if MEASURE_IRQ_OFF
+        _measuring = false;
+#endif
+        if (res == 1) {
+            n++;
+        }
+        else {
+            thread_yield();
+        }
+    }
+
+    return n;
+}
+
+static irq_off_t _send_int;
+static unsigned _send_int_rounds;
+static kernel_pid_t _send_int_target;
+
+static void _send_int_callback(void *arg)
+{
+    xtimer_t *timer = arg;
+    msg_t test;
+
+    /* the whole call runs in interrupt context */
+    uint32_t start = xtimer_now_usec();
+    msg_send_int(&test, _send_int_target);
+    uint32_t diff = xtimer_now_usec() - start;
+
+    _send_int.max = (diff > _send_int.max) ? diff : _send_int.max;
+    _send_int.sum += diff;
+    _send_int.count++;
+    if (--_send_int_rounds) {
+        xtimer_set(timer, TEST_ISR_PERIOD_US);
+    }
+}
+
+static void _measure_send_int(kernel_pid_t other)
+{
+    xtimer_t timer = {
+        .callback = _send_int_callback,
+        .arg = &timer,
+    };
+
+    _send_int_target = other;
+    _send_int_rounds = TEST_ISR_ROUNDS;
+    xtimer_set(&timer, TEST_ISR_PERIOD_US);
+    while (_send_int_rounds) {
+        xtimer_usleep(TEST_ISR_PERIOD_US);
+    }
+}
+
+static void _print_irq_off(const char *name, const irq_off_t *irq_off)
+{
+    printf("{ \"%s\" : { \"count\" : %"PRIu32", \"max_us\" : %"PRIu32
+           ", \"avg_ns\" : %"PRIu32" } }\n",
+           name, irq_off->count, irq_off->max,
+           irq_off->count ? (uint32_t)((uint64_t)irq_off->sum * NS_PER_US
+                                       / irq_off->count) : 0);
+}
+
+static void _print(const char *name, uint32_t n)
+{
+    printf("{ \"%s\" : %"PRIu32, name, n);
+    printf(", \"ticks\" : %"PRIu32,
+           (uint32_t)((TEST_DURATION_US/US_PER_MS) * (coreclk()/KHZ(1)))/n);
+    puts(" }");
+}
+
 int main(void)
 {
     puts("main starting");
@@ -81,10 +241,17 @@ int main(void)
         n++;
     }
 
-    printf("{ \"result\" : %"PRIu32, n);
-    printf(", \"ticks\" : %"PRIu32,
-           (uint32_t)((TEST_DURATION_US/US_PER_MS) * (coreclk()/KHZ(1)))/n);
-    puts(" }");
+    _print("result", n);
+
+    other = thread_create(_queue_stack, sizeof(_queue_stack),
+                          THREAD_PRIORITY_MAIN, 0, _queue_thread, NULL,
+                          "queue_thread");
+    _print("queued", _measure_queued(&timer, &flag, other));
+#if MEASURE_IRQ_OFF
+    _print_irq_off("try_send_irq_off", &_irq_off);
+#endif
+    _measure_send_int(other);
+    _print_irq_off("send_int_irq_off", &_send_int);
 
     return 0;
 }
@@ -7,12 +7,19 @@
 # General Public License v2.1. See the file LICENSE in the top level
 # directory for more details.
 
+import os
 import sys
 from testrunner import run
 
+IRQ_OFF = r"{{ \"{}\" : {{ \"count\" : \d+, \"max_us\" : \d+, \"avg_ns\" : \d+ }} }}"
+
 
 def testfunc(child):
     child.expect(r"{ \"result\" : \d+(, \"ticks\" : \d+)? }")
+    child.expect(r"{ \"queued\" : \d+(, \"ticks\" : \d+)? }")
+    if os.environ.get("BOARD", "").startswith("native"):
+        child.expect(IRQ_OFF.format("try_send_irq_off"))
+    child.expect(IRQ_OFF.format("send_int_irq_off"))
 
 
 if __name__ == "__main__":
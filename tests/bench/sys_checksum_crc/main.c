@@ -0,0 +1,124 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of the CRC implementations of sys/checksum
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "checksum/crc.h"
+#include "checksum/crc16_ccitt.h"
+#include "checksum/crc32.h"
+#include "checksum/ucrc16.h"
+#include "container.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef BENCH_BYTES
+#define BENCH_BYTES         (4U * 1024U * 1024U)
+#endif
+
+#define BUF_SIZE            (1024U)
+
+static uint8_t _buf[BUF_SIZE];
+static uint32_t _crc32_table[256];
+static uint32_t _kermit_table[256];
+
+static uint32_t _run_crc32(void)
+{
+    return crc32(_buf, sizeof(_buf));
+}
+
+static uint32_t _run_crc_crc32_bitwise(void)
+{
+    return crc_calc(&crc_model_crc32, NULL, _buf, sizeof(_buf));
+}
+
+static uint32_t _run_crc_crc32_table(void)
+{
+    return crc_calc(&crc_model_crc32, _crc32_table, _buf, sizeof(_buf));
+}
+
+static uint32_t _run_crc16_kermit(void)
+{
+    return crc16_ccitt_kermit_calc(_buf, sizeof(_buf));
+}
+
+static uint32_t _run_ucrc16_kermit(void)
+{
+    return ucrc16_calc_le(_buf, sizeof(_buf), UCRC16_CCITT_POLY_LE, 0);
+}
+
+static uint32_t _run_crc_kermit_bitwise(void)
+{
+    return crc_calc(&crc_model_crc16_kermit, NULL, _buf, sizeof(_buf));
+}
+
+static uint32_t _run_crc_kermit_table(void)
+{
+    return crc_calc(&crc_model_crc16_kermit, _kermit_table, _buf, sizeof(_buf));
+}
+
+static const struct {
+    const char *name;
+    uint32_t (*run)(void);
+    uint32_t (*ref)(void);
+} _variants[] = {
+    { "crc32()", _run_crc32, _run_crc_crc32_bitwise },
+    { "crc_calc(crc32)", _run_crc_crc32_bitwise, _run_crc_crc32_bitwise },
+    { "crc_calc(crc32, table)", _run_crc_crc32_table, _run_crc_crc32_bitwise },
+    { "crc16_ccitt_kermit_calc()", _run_crc16_kermit, _run_crc_kermit_bitwise },
+    { "ucrc16_calc_le()", _run_ucrc16_kermit, _run_crc_kermit_bitwise },
+    { "crc_calc(kermit)", _run_crc_kermit_bitwise, _run_crc_kermit_bitwise },
+    { "crc_calc(kermit, table)", _run_crc_kermit_table, _run_crc_kermit_bitwise },
+};
+
+static void _measure(unsigned variant)
+{
+    unsigned rounds = BENCH_BYTES / BUF_SIZE;
+    volatile uint32_t res;
+
+    expect(_variants[variant].run() == _variants[variant].ref());
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < rounds; i++) {
+        res = _variants[variant].run();
+    }
+    uint32_t diff = ztimer_now(ZTIMER_USEC) - start;
+    (void)res;
+
+    printf("%-26s %8" PRIu32 " us = %6" PRIu32 " KiB/s\n",
+           _variants[variant].name, diff,
+           (uint32_t)((uint64_t)rounds * BUF_SIZE * 1000000U / 1024U / diff));
+}
+
+int main(void)
+{
+    puts("CRC benchmark application.\n");
+    printf("crc32_fast: %u, crc16_fast: %u, CONFIG_CRC32_FAST_SLICES: %u\n",
+           IS_USED(MODULE_CRC32_FAST), IS_USED(MODULE_CRC16_FAST),
+           CONFIG_CRC32_FAST_SLICES);
+
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i] = (uint8_t)(i * 0x9d + 0x42);
+    }
+    crc_table_init(&crc_model_crc32, _crc32_table);
+    crc_table_init(&crc_model_crc16_kermit, _kermit_table);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_variants); i++) {
+        _measure(i);
+    }
+
+    puts("done.");
+    return 0;
+}
@@ -47,6 +47,7 @@
 #endif
 
 static ztimer_t _timers[NUMOF_TIMERS];
+static ztimer_t _probe;
 
 /* This variable is set by any timer that actually triggers.  As the test is
  * only testing set/remove/now operations, timers are not supposed to trigger.
@@ -103,6 +104,8 @@ int main(void)
         _timers[n].callback = _callback;
         _timers[n].arg = &_triggers;
     }
+    _probe.callback = _callback;
+    _probe.arg = &_triggers;
 
     start = ztimer_now(ZTIMER_USEC);
 
@@ -273,6 +276,36 @@ int main(void)
     _print_result("remove() many decreasing", NUMOF_TIMERS, diff);
     expect(!_triggers);
 
+    /*
+     * test setting / removing one timer REPEAT times with 10, 100, 1000
+     * other timers armed
+     *
+     */
+    for (unsigned armed = 10; armed <= NUMOF_TIMERS; armed *= 10) {
+        char desc[32];
+
+        _base = BASE  - (ztimer_now(ZTIMER_USEC) - start);
+        for (n = 0; n < armed; n++) {
+            _timer_set(n);
+        }
+
+        before = ztimer_now(ZTIMER_USEC);
+        for (n = 0; n < REPEAT; n++) {
+            ztimer_set(ZTIMER, &_probe, _timer_val(armed / 2) + SPREAD / 2);
+            ztimer_remove(ZTIMER, &_probe);
+        }
+
+        diff = ztimer_now(ZTIMER_USEC) - before;
+
+        snprintf(desc, sizeof(desc), "set() + remove() %u armed", armed);
+        _print_result(desc, REPEAT, diff);
+        expect(!_triggers);
+
+        for (n = 0; n < armed; n++) {
+            _timer_remove(n);
+        }
+    }
+
     /*
      * test ztimer_now()
      *
@@ -0,0 +1,196 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Stress test for the lock-free message queue
+ *
+ * Two threads and a timer interrupt send sequence numbers to a receiver with
+ * a small message queue using @ref msg_try_send() and @ref msg_send_int().
+ * Every accepted message has to be received exactly once and in order, and
+ * every message reported by @ref msg_avail() has to be receivable.
+ *
+ * In the first round, the senders run at the priority of the receiver, so the
+ * queue fills up. In the second round, they run at a lower priority, so the
+ * receiver preempts them whenever it is woken up from the timer interrupt.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define ROUNDS_NUMOF        (2U)
+#define SENDERS_NUMOF       (2U)
+#define SENDS_PER_THREAD    (100000U)
+#define QUEUE_SIZE          (8U)
+#define ISR_PERIOD_US       (50U)
+
+#define MSG_TYPE_DATA       (0x1234)
+#define MSG_TYPE_DONE       (0x1235)
+
+static char _rcv_stack[THREAD_STACKSIZE_MAIN];
+static char _snd_stacks[ROUNDS_NUMOF][SENDERS_NUMOF][THREAD_STACKSIZE_MAIN];
+
+static msg_t _queue[QUEUE_SIZE];
+static kernel_pid_t _main_pid;
+static kernel_pid_t _rcv_pid;
+
+static ztimer_t _timer;
+static volatile bool _stop;
+static uint32_t _isr_seq;
+static uint32_t _sent[SENDERS_NUMOF + 1];
+static uint32_t _expected[MAXTHREADS + 1];
+static bool _failed;
+
+static void _timer_cb(void *arg)
+{
+    (void)arg;
+    msg_t m = { .type = MSG_TYPE_DATA, .content.value = _isr_seq };
+
+    if (msg_send_int(&m, _rcv_pid) == 1) {
+        _isr_seq++;
+        _sent[SENDERS_NUMOF]++;
+    }
+    if (!_stop) {
+        ztimer_set(ZTIMER_USEC, &_timer, ISR_PERIOD_US);
+    }
+}
+
+static void _check(const msg_t *m)
+{
+    /* map KERNEL_PID_ISR to the slot after the last thread */
+    unsigned idx = (m->sender_pid == KERNEL_PID_ISR) ? MAXTHREADS
+                                                       : (unsigned)m->sender_pid - 1;
+
+    if (m->content.value != _expected[idx]) {
+        printf("FAILED: got %" PRIu32 " from %" PRIkernel_pid ", expected %" PRIu32
+               "\n", m->content.value, m->sender_pid, _expected[idx]);
+        _failed = true;
+    }
+    _expected[idx] = m->content.value + 1;
+}
+
+static void *_receiver(void *arg)
+{
+    (void)arg;
+    msg_t m;
+
+    msg_init_queue(_queue, QUEUE_SIZE);
+
+    while (1) {
+        unsigned done = 0;
+        uint32_t received = 0;
+
+        while (done < SENDERS_NUMOF) {
+            /* only the receiver takes messages out of the queue, so a
+             * message msg_avail() reports has to be there */
+            if (msg_avail() == 0) {
+                msg_receive(&m);
+            }
+            else if (msg_try_receive(&m) != 1) {
+                puts("FAILED: msg_avail() reported a message that is not there");
+                _failed = true;
+                continue;
+            }
+            if (m.type == MSG_TYPE_DONE) {
+                done++;
+                continue;
+            }
+            _check(&m);
+            received++;
+        }
+
+        _stop = true;
+        ztimer_remove(ZTIMER_USEC, &_timer);
+        while (msg_try_receive(&m) == 1) {
+            _check(&m);
+            received++;
+        }
+
+        m.content.value = received;
+        msg_send(&m, _main_pid);
+    }
+
+    return NULL;
+}
+
+static void *_sender(void *arg)
+{
+    uint32_t *sent = arg;
+    msg_t m = { .type = MSG_TYPE_DATA };
+
+    for (unsigned i = 0; i < SENDS_PER_THREAD; i++) {
+        m.content.value = *sent;
+        if (msg_try_send(&m, _rcv_pid) == 1) {
+            (*sent)++;
+        }
+        /* give the receiver and the other sender a chance to run */
+        if ((i % 16) == 0) {
+            thread_yield();
+        }
+    }
+
+    m.type = MSG_TYPE_DONE;
+    msg_send(&m, _rcv_pid);
+    return NULL;
+}
+
+static uint32_t _round(unsigned round, uint8_t prio)
+{
+    msg_t m;
+    uint32_t sent = 0;
+
+    _stop = false;
+    for (unsigned i = 0; i <= SENDERS_NUMOF; i++) {
+        _sent[i] = 0;
+    }
+    ztimer_set(ZTIMER_USEC, &_timer, ISR_PERIOD_US);
+
+    for (unsigned i = 0; i < SENDERS_NUMOF; i++) {
+        thread_create(_snd_stacks[round][i], sizeof(_snd_stacks[round][i]),
+                      prio, 0, _sender, &_sent[i], "sender");
+    }
+
+    msg_receive(&m);
+
+    for (unsigned i = 0; i <= SENDERS_NUMOF; i++) {
+        sent += _sent[i];
+    }
+    printf("sent: %" PRIu32 ", received: %" PRIu32 " (%" PRIu32 " from ISR)\n",
+           sent, m.content.value, _sent[SENDERS_NUMOF]);
+
+    if (sent != m.content.value) {
+        _failed = true;
+    }
+    return sent;
+}
+
+int main(void)
+{
+    puts("START");
+    _main_pid = thread_getpid();
+    _rcv_pid = thread_create(_rcv_stack, sizeof(_rcv_stack),
+                             THREAD_PRIORITY_MAIN + 1, 0, _receiver, NULL,
+                             "receiver");
+    _timer.callback = _timer_cb;
+
+    _round(0, THREAD_PRIORITY_MAIN + 1);
+    _round(1, THREAD_PRIORITY_MAIN + 2);
+
+    if (_failed) {
+        puts("FAILED");
+        return 1;
+    }
+    puts("SUCCESS");
+    return 0;
+}
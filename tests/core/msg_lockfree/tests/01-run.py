@@ -0,0 +1,19 @@
+#!/usr/bin/env python3
+
+import sys
+from testrunner import run
+
+ROUNDS_NUMOF = 2
+
+
+def testfunc(child):
+    child.expect_exact("START")
+    for _ in range(ROUNDS_NUMOF):
+        child.expect(r"sent: (\d+), received: (\d+)")
+        assert int(child.match.group(1)) == int(child.match.group(2))
+        assert int(child.match.group(1)) > 0
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
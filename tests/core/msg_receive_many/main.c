@@ -0,0 +1,78 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   msg_receive_many() test application
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "msg.h"
+#include "thread.h"
+
+#define QUEUE_SIZE      (4U)
+#define SENDERS_NUMOF   (3U)
+
+static kernel_pid_t _main_pid;
+static msg_t _queue[QUEUE_SIZE];
+static char _stacks[SENDERS_NUMOF][THREAD_STACKSIZE_MAIN];
+
+static void *_sender(void *arg)
+{
+    msg_t m = { .content.value = (uintptr_t)arg };
+
+    /* blocks, as the queue of the main thread is full */
+    msg_send(&m, _main_pid);
+    return NULL;
+}
+
+static void _print(const msg_t *msgs, int n)
+{
+    printf("received %d:", n);
+    for (int i = 0; i < n; i++) {
+        printf(" %u", (unsigned)msgs[i].content.value);
+    }
+    puts("");
+}
+
+int main(void)
+{
+    msg_t msgs[QUEUE_SIZE * 2];
+
+    puts("START");
+    _main_pid = thread_getpid();
+    msg_init_queue(_queue, QUEUE_SIZE);
+
+    printf("received %d\n", msg_try_receive_many(msgs, QUEUE_SIZE));
+
+    for (unsigned i = 0; i < QUEUE_SIZE; i++) {
+        msg_t m = { .content.value = i };
+        msg_send_to_self(&m);
+    }
+    for (unsigned i = 0; i < SENDERS_NUMOF - 1; i++) {
+        thread_create(_stacks[i], sizeof(_stacks[i]), THREAD_PRIORITY_MAIN - 1,
+                      0, _sender, (void *)(uintptr_t)(QUEUE_SIZE + i), "sender");
+    }
+
+    /* takes three queued messages, the blocked senders move into the queue */
+    _print(msgs, msg_try_receive_many(msgs, 3));
+    _print(msgs, msg_receive_many(msgs, QUEUE_SIZE * 2));
+    printf("received %d\n", msg_try_receive_many(msgs, QUEUE_SIZE));
+
+    /* blocks until the last sender, which has a lower priority, runs */
+    thread_create(_stacks[SENDERS_NUMOF - 1], sizeof(_stacks[0]),
+                  THREAD_PRIORITY_MAIN + 1, 0, _sender,
+                  (void *)(uintptr_t)(QUEUE_SIZE + SENDERS_NUMOF - 1), "sender");
+    _print(msgs, msg_receive_many(msgs, QUEUE_SIZE * 2));
+
+    puts("SUCCESS");
+    return 0;
+}
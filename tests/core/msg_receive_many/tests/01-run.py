@@ -0,0 +1,18 @@
+#!/usr/bin/env python3
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("START")
+    child.expect_exact("received 0")
+    child.expect_exact("received 3: 0 1 2")
+    child.expect_exact("received 3: 3 4 5")
+    child.expect_exact("received 0")
+    child.expect_exact("received 1: 6")
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
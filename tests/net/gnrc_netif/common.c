@@ -38,7 +38,7 @@ static msg_t _main_msg_queue[MSG_QUEUE_SIZE];
 static uint8_t tmp_buffer[ETHERNET_DATA_LEN];
 static size_t tmp_buffer_bytes = 0;
 
-static int _dump_send_packet(netdev_t *netdev, const iolist_t *iolist)
+int _dump_send_packet(netdev_t *netdev, const iolist_t *iolist)
 {
     int res;
 
@@ -99,6 +99,7 @@ extern netdev_t *ieee802154_dev;
 extern netdev_t *devs[DEFAULT_DEVS_NUMOF];
 
 void _tests_init(void);
+int _dump_send_packet(netdev_t *netdev, const iolist_t *iolist);
 void _test_trigger_recv(gnrc_netif_t *netif, const uint8_t *data,
                         size_t data_len);
 
@@ -1699,6 +1699,86 @@ static void test_netapi_recv__ipv6_ethernet_payload(void)
     _test_trigger_recv(&ethernet_netif, data, sizeof(data));
 }
 
+#define SEND_IOLIST_MAX     (4U)
+
+static const void *_send_iolist_bases[SEND_IOLIST_MAX];
+static unsigned _send_iolist_numof;
+static mutex_t _send_done = MUTEX_INIT_LOCKED;
+
+static int _record_send_iolist(netdev_t *dev, const iolist_t *iolist)
+{
+    int res = 0;
+
+    (void)dev;
+    _send_iolist_numof = 0;
+    for (const iolist_t *iol = iolist; iol; iol = iol->iol_next) {
+        if (_send_iolist_numof < SEND_IOLIST_MAX) {
+            _send_iolist_bases[_send_iolist_numof++] = iol->iol_base;
+        }
+        res += iol->iol_len;
+    }
+    mutex_unlock(&_send_done);
+    return res;
+}
+
+static void _test_send__zero_copy(gnrc_netif_t *netif, netdev_t *dev,
+                                  const uint8_t *dst, size_t dst_len)
+{
+    netdev_test_t *test_dev = container_of(
+            container_of(dev, netdev_ieee802154_t, netdev),
+            netdev_test_t,
+            netdev
+            );
+    gnrc_pktsnip_t *payload = gnrc_pktbuf_add(NULL, "ABCDEFG",
+            sizeof("ABCDEFG"),
+            GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(payload);
+    gnrc_pktsnip_t *hdr = gnrc_pktbuf_add(payload, "0123", sizeof("0123"),
+            GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(hdr);
+    gnrc_pktsnip_t *netif_hdr = gnrc_netif_hdr_build(NULL, 0, dst, dst_len);
+    TEST_ASSERT_NOT_NULL(netif_hdr);
+#ifdef DEVELHELP
+    unsigned merged = gnrc_pktbuf_merge_stats()->merged;
+#endif
+
+    /* keep the snips to compare them with what was handed to the device */
+    gnrc_pktbuf_hold(hdr, 1);
+    netdev_test_set_send_cb(test_dev, _record_send_iolist);
+    TEST_ASSERT(gnrc_netif_send(netif, gnrc_pkt_prepend(hdr, netif_hdr)) > 0);
+    mutex_lock(&_send_done);
+    netdev_test_set_send_cb(test_dev, _dump_send_packet);
+    /* L2 header followed by the snips themselves, not copies of them */
+    TEST_ASSERT_EQUAL_INT(3, _send_iolist_numof);
+    TEST_ASSERT(hdr->data == _send_iolist_bases[1]);
+    TEST_ASSERT(payload->data == _send_iolist_bases[2]);
+#ifdef DEVELHELP
+    TEST_ASSERT_EQUAL_INT(merged, gnrc_pktbuf_merge_stats()->merged);
+#endif
+    gnrc_pktbuf_release(hdr);
+}
+
+static void test_netif_send__zero_copy_ethernet(void)
+{
+    static const uint8_t dst[] = { LA1, LA2, LA3, LA4, LA5, LA6 + 1 };
+
+    _test_send__zero_copy(&ethernet_netif, ethernet_dev, dst, sizeof(dst));
+}
+
+static void test_netif_send__zero_copy_ieee802154(void)
+{
+    static const uint8_t dst[] = { LA1, LA2, LA3, LA4, LA5, LA6, LA7,
+                                   LA8 + 1 };
+    netdev_ieee802154_t *dev = container_of(ieee802154_dev,
+                                            netdev_ieee802154_t, netdev);
+    uint8_t seq = dev->seq;
+
+    _test_send__zero_copy(&ieee802154_netif, ieee802154_dev, dst,
+                          sizeof(dst));
+    /* the output of the send tests expects the sequence number to be unused */
+    dev->seq = seq;
+}
+
 static Test *embunit_tests_gnrc_netif(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -1779,6 +1859,8 @@ static Test *embunit_tests_gnrc_netif(void)
             new_TestFixture(test_netif_get_by_name_buffer),
             new_TestFixture(test_netif_get_opt),
             new_TestFixture(test_netif_set_opt),
+            new_TestFixture(test_netif_send__zero_copy_ethernet),
+            new_TestFixture(test_netif_send__zero_copy_ieee802154),
             /* only add tests not involving output here */
     };
     EMB_UNIT_TESTCALLER(tests, _set_up, NULL, fixtures);
@@ -0,0 +1,373 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the priority-aware send queue of @ref net_gnrc_netif
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "msg.h"
+#include "net/ethernet.h"
+#include "net/gnrc.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/netif/internal.h"
+#include "net/gnrc/netif/pktq.h"
+#include "net/icmpv6.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/netstats.h"
+#include "net/protnum.h"
+#include "test_utils/expect.h"
+
+#define DSCP_LE         (0x01)
+#define DSCP_CS1        (0x08)
+#define DSCP_CS6        (0x30)
+#define PKT_LEN         (64U)
+#define SENT_NUMOF      (16U)
+
+static const uint8_t _dst[] = { 0x3e, 0xe6, 0xb5, 0x22, 0xfd, 0x0b };
+static gnrc_netif_t _netif;
+/* only the send queue of this interface is used, to test the scheduler
+ * without the network interface thread */
+static gnrc_netif_t _queue_netif;
+static netdev_test_t _netdev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static bool _busy;
+static char _sent[SENT_NUMOF];
+static unsigned _sent_numof;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    static const uint8_t addr[] = { 0x3e, 0xe6, 0xb5, 0x22, 0xfd, 0x0a };
+
+    (void)dev;
+    expect(max_len >= sizeof(addr));
+    memcpy(value, addr, sizeof(addr));
+    return sizeof(addr);
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    const iolist_t *last = iolist;
+    int res = 0;
+
+    (void)dev;
+    if (_busy) {
+        return -EBUSY;
+    }
+    for (; iolist != NULL; iolist = iolist->iol_next) {
+        res += iolist->iol_len;
+        last = iolist;
+    }
+    /* the payload is filled with the tag of the packet */
+    if (_sent_numof < SENT_NUMOF) {
+        _sent[_sent_numof++] = *((char *)last->iol_base);
+    }
+    return res;
+}
+
+static gnrc_pktsnip_t *_build_pkt(char tag, uint8_t dscp, uint8_t nh,
+                                  uint8_t icmpv6_type)
+{
+    gnrc_pktsnip_t *netif, *ipv6, *payload;
+    ipv6_hdr_t *hdr;
+
+    netif = gnrc_netif_hdr_build(NULL, 0, _dst, sizeof(_dst));
+    expect(netif != NULL);
+    payload = gnrc_pktbuf_add(NULL, NULL,
+                              PKT_LEN - netif->size - sizeof(ipv6_hdr_t),
+                              GNRC_NETTYPE_UNDEF);
+    expect(payload != NULL);
+    memset(payload->data, tag, payload->size);
+    ((uint8_t *)payload->data)[0] = (nh == PROTNUM_ICMPV6) ? icmpv6_type : tag;
+    ipv6 = gnrc_pktbuf_add(payload, NULL, sizeof(ipv6_hdr_t),
+                           GNRC_NETTYPE_IPV6);
+    expect(ipv6 != NULL);
+    hdr = ipv6->data;
+    memset(hdr, 0, sizeof(*hdr));
+    ipv6_hdr_set_version(hdr);
+    ipv6_hdr_set_tc(hdr, dscp << 2);
+    hdr->nh = nh;
+    return gnrc_pkt_prepend(ipv6, netif);
+}
+
+static gnrc_pktsnip_t *_build_tagged(char tag, uint8_t dscp)
+{
+    return _build_pkt(tag, dscp, PROTNUM_IPV6_NONXT, 0);
+}
+
+static char _tag(gnrc_pktsnip_t *pkt)
+{
+    char tag;
+
+    expect(pkt != NULL);
+    tag = *((char *)pkt->next->next->data);
+    gnrc_pktbuf_release(pkt);
+    return tag;
+}
+
+static void set_up(void)
+{
+    gnrc_pktsnip_t *pkt;
+
+    while ((pkt = gnrc_netif_pktq_get(&_queue_netif)) != NULL) {
+        gnrc_pktbuf_release(pkt);
+    }
+    _busy = false;
+    _sent_numof = 0;
+}
+
+static void _assert_class(gnrc_netif_pktq_class_t exp, gnrc_pktsnip_t *pkt)
+{
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(exp, gnrc_netif_pktq_class(pkt));
+    gnrc_pktbuf_release(pkt);
+}
+
+static void test_class__no_ipv6(void)
+{
+    gnrc_pktsnip_t *netif = gnrc_netif_hdr_build(NULL, 0, _dst, sizeof(_dst));
+    gnrc_pktsnip_t *payload = gnrc_pktbuf_add(NULL, "abcd", 4,
+                                              GNRC_NETTYPE_UNDEF);
+
+    TEST_ASSERT_NOT_NULL(netif);
+    TEST_ASSERT_NOT_NULL(payload);
+    _assert_class(GNRC_NETIF_PKTQ_CLASS_DEFAULT,
+                  gnrc_pkt_prepend(payload, netif));
+}
+
+static void test_class__dscp(void)
+{
+    _assert_class(GNRC_NETIF_PKTQ_CLASS_DEFAULT, _build_tagged('d', 0));
+    _assert_class(GNRC_NETIF_PKTQ_CLASS_CONTROL, _build_tagged('c', DSCP_CS6));
+    _assert_class(GNRC_NETIF_PKTQ_CLASS_BULK, _build_tagged('b', DSCP_CS1));
+    _assert_class(GNRC_NETIF_PKTQ_CLASS_BULK, _build_tagged('b', DSCP_LE));
+}
+
+static void test_class__icmpv6(void)
+{
+    _assert_class(GNRC_NETIF_PKTQ_CLASS_CONTROL,
+                  _build_pkt('c', 0, PROTNUM_ICMPV6, ICMPV6_NBR_SOL));
+    _assert_class(GNRC_NETIF_PKTQ_CLASS_CONTROL,
+                  _build_pkt('c', 0, PROTNUM_ICMPV6, ICMPV6_RPL_CTRL));
+    _assert_class(GNRC_NETIF_PKTQ_CLASS_DEFAULT,
+                  _build_pkt('d', 0, PROTNUM_ICMPV6, ICMPV6_ECHO_REQ));
+}
+
+static void test_class__marked(void)
+{
+    gnrc_pktsnip_t *pkt = _build_tagged('c', DSCP_CS6);
+
+    gnrc_netif_hdr_set_qclass(pkt->data, GNRC_NETIF_PKTQ_CLASS_BULK);
+    _assert_class(GNRC_NETIF_PKTQ_CLASS_BULK, pkt);
+    pkt = _build_tagged('b', DSCP_CS1);
+    gnrc_netif_hdr_set_qclass(pkt->data, GNRC_NETIF_PKTQ_CLASS_CONTROL);
+    _assert_class(GNRC_NETIF_PKTQ_CLASS_CONTROL, pkt);
+}
+
+static void test_get__strict_priority(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_queue_netif,
+                                                 _build_tagged('b', DSCP_CS1)));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_queue_netif,
+                                                 _build_tagged('d', 0)));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_queue_netif,
+                                                 _build_tagged('c', DSCP_CS6)));
+    TEST_ASSERT_EQUAL_INT('c', _tag(gnrc_netif_pktq_get(&_queue_netif)));
+    TEST_ASSERT_EQUAL_INT('d', _tag(gnrc_netif_pktq_get(&_queue_netif)));
+    TEST_ASSERT_EQUAL_INT('b', _tag(gnrc_netif_pktq_get(&_queue_netif)));
+    TEST_ASSERT_NULL(gnrc_netif_pktq_get(&_queue_netif));
+}
+
+static void test_get__drr(void)
+{
+    /* with equally sized packets, the quanta determine the share of each
+     * class per round */
+    static const char exp[] = "dddd" "bb" "dd" "bb";
+    const unsigned per_round_default = CONFIG_GNRC_NETIF_PKTQ_QUANTUM_DEFAULT / PKT_LEN;
+    const unsigned per_round_bulk = CONFIG_GNRC_NETIF_PKTQ_QUANTUM_BULK / PKT_LEN;
+
+    TEST_ASSERT_EQUAL_INT(4, per_round_default);
+    TEST_ASSERT_EQUAL_INT(2, per_round_bulk);
+    for (unsigned i = 0; i < 6; i++) {
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_queue_netif,
+                                                     _build_tagged('d', 0)));
+    }
+    for (unsigned i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_queue_netif,
+                                                     _build_tagged('b', DSCP_CS1)));
+    }
+    for (unsigned i = 0; i < sizeof(exp) - 1; i++) {
+        TEST_ASSERT_EQUAL_INT(exp[i], _tag(gnrc_netif_pktq_get(&_queue_netif)));
+    }
+    TEST_ASSERT_NULL(gnrc_netif_pktq_get(&_queue_netif));
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_put__depth_limit(void)
+{
+    gnrc_pktsnip_t *pkt;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_NETIF_PKTQ_DEPTH_BULK; i++) {
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_queue_netif,
+                                                     _build_tagged('b', DSCP_CS1)));
+    }
+    pkt = _build_tagged('b', DSCP_CS1);
+    TEST_ASSERT_EQUAL_INT(-1, gnrc_netif_pktq_put(&_queue_netif, pkt));
+    /* other classes are not affected */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_queue_netif,
+                                                 _build_tagged('d', 0)));
+    /* a packet that could not be sent is always taken back */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_push_back(&_queue_netif, pkt));
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_NETIF_PKTQ_DEPTH_BULK + 2,
+                          gnrc_netif_pktq_usage());
+    while ((pkt = gnrc_netif_pktq_get(&_queue_netif)) != NULL) {
+        gnrc_pktbuf_release(pkt);
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_send__busy(void)
+{
+    msg_t msg = { .type = GNRC_NETIF_PKTQ_DEQUEUE_MSG };
+    netstats_t stats;
+    unsigned bulk = 0;
+
+    _busy = true;
+    /* one more than fits into the bulk queue */
+    for (unsigned i = 0; i <= CONFIG_GNRC_NETIF_PKTQ_DEPTH_BULK; i++) {
+        TEST_ASSERT_EQUAL_INT(1, gnrc_netif_send(&_netif,
+                                                 _build_tagged('b', DSCP_CS1)));
+    }
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netif_send(&_netif, _build_tagged('d', 0)));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netif_send(&_netif,
+                                             _build_tagged('c', DSCP_CS6)));
+    TEST_ASSERT_EQUAL_INT(sizeof(stats),
+                          gnrc_netapi_get(_netif.pid, NETOPT_STATS,
+                                          NETSTATS_LAYER2, &stats,
+                                          sizeof(stats)));
+    TEST_ASSERT_EQUAL_INT(0, stats.tx_queue_drops[GNRC_NETIF_PKTQ_CLASS_CONTROL]);
+    TEST_ASSERT_EQUAL_INT(0, stats.tx_queue_drops[GNRC_NETIF_PKTQ_CLASS_DEFAULT]);
+    TEST_ASSERT_EQUAL_INT(1, stats.tx_queue_drops[GNRC_NETIF_PKTQ_CLASS_BULK]);
+
+    _busy = false;
+    while (!gnrc_netif_pktq_empty(&_netif)) {
+        msg_send(&msg, _netif.pid);
+    }
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_NETIF_PKTQ_DEPTH_BULK + 2, _sent_numof);
+    /* the control packet overtakes everything queued before it */
+    TEST_ASSERT_EQUAL_INT('c', _sent[0]);
+    for (unsigned i = 1; i < _sent_numof; i++) {
+        bulk += (_sent[i] == 'b');
+    }
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_NETIF_PKTQ_DEPTH_BULK, bulk);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_send__depth_limit(void)
+{
+    msg_t msg = { .type = GNRC_NETIF_PKTQ_DEQUEUE_MSG };
+    netstats_t stats;
+    uint32_t drops;
+
+    TEST_ASSERT_EQUAL_INT(sizeof(stats),
+                          gnrc_netapi_get(_netif.pid, NETOPT_STATS,
+                                          NETSTATS_LAYER2, &stats,
+                                          sizeof(stats)));
+    drops = stats.tx_queue_drops[GNRC_NETIF_PKTQ_CLASS_BULK];
+
+    _busy = true;
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netif_send(&_netif, _build_tagged('d', 0)));
+    for (unsigned i = 0; i < CONFIG_GNRC_NETIF_PKTQ_DEPTH_BULK; i++) {
+        TEST_ASSERT_EQUAL_INT(1, gnrc_netif_send(&_netif,
+                                                 _build_tagged('b', DSCP_CS1)));
+    }
+    TEST_ASSERT_EQUAL_INT(0, _sent_numof);
+
+    /* the device is free again, but the bulk queue is still full: only the
+     * queued default packet may go out, the new bulk packet is dropped */
+    _busy = false;
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netif_send(&_netif,
+                                             _build_tagged('x', DSCP_CS1)));
+    TEST_ASSERT_EQUAL_INT(1, _sent_numof);
+    TEST_ASSERT_EQUAL_INT('d', _sent[0]);
+    TEST_ASSERT_EQUAL_INT(sizeof(stats),
+                          gnrc_netapi_get(_netif.pid, NETOPT_STATS,
+                                          NETSTATS_LAYER2, &stats,
+                                          sizeof(stats)));
+    TEST_ASSERT_EQUAL_INT(drops + 1,
+                          stats.tx_queue_drops[GNRC_NETIF_PKTQ_CLASS_BULK]);
+
+    while (!gnrc_netif_pktq_empty(&_netif)) {
+        msg_send(&msg, _netif.pid);
+    }
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_NETIF_PKTQ_DEPTH_BULK + 1, _sent_numof);
+    for (unsigned i = 1; i < _sent_numof; i++) {
+        TEST_ASSERT_EQUAL_INT('b', _sent[i]);
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static Test *tests_gnrc_netif_pktq_prio(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_class__no_ipv6),
+        new_TestFixture(test_class__dscp),
+        new_TestFixture(test_class__icmpv6),
+        new_TestFixture(test_class__marked),
+        new_TestFixture(test_get__strict_priority),
+        new_TestFixture(test_get__drr),
+        new_TestFixture(test_put__depth_limit),
+        new_TestFixture(test_send__busy),
+        new_TestFixture(test_send__depth_limit),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, set_up, NULL, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    netdev_test_setup(&_netdev, 0);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_netdev, NETOPT_MAX_PDU_SIZE,
+                           _get_max_packet_size);
+    netdev_test_set_get_cb(&_netdev, NETOPT_ADDRESS, _get_address);
+    netdev_test_set_send_cb(&_netdev, _send);
+    expect(gnrc_netif_ethernet_create(&_netif, _netif_stack,
+                                      sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                      "eth", &_netdev.netdev.netdev) == 0);
+
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_netif_pktq_prio());
+    TESTS_END();
+    return 0;
+}
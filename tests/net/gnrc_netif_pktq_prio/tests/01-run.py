@@ -0,0 +1,15 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run, check_unittests
+
+
+def testfunc(child):
+    check_unittests(child)
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
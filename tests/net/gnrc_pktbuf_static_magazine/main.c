@@ -0,0 +1,274 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the per-thread caches of the static packet buffer
+ *
+ * @}
+ */
+
+#include <limits.h>
+#include <string.h>
+
+#include "container.h"
+#include "embUnit.h"
+#include "net/gnrc/pktbuf.h"
+#include "thread.h"
+
+#include "pktbuf_static.h"
+
+#define TEST_ROUNDS     (64U)
+#define TEST_SIZE       (16U)
+
+static const char _data[] = "0123456789abcdef0123456789abcdef";
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static char _stack2[THREAD_STACKSIZE_DEFAULT];
+static char _parked_stacks[CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_NUMOF + 1]
+                          [THREAD_STACKSIZE_DEFAULT];
+static unsigned _other_failed;
+static unsigned _other_locked;
+
+static void set_up(void)
+{
+    gnrc_pktbuf_init();
+}
+
+static gnrc_pktsnip_t *_build_pkt(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, _data, TEST_SIZE,
+                                          GNRC_NETTYPE_UNDEF);
+
+    if (pkt != NULL) {
+        gnrc_pktsnip_t *hdr = gnrc_pktbuf_add(pkt, _data, 8,
+                                              GNRC_NETTYPE_UNDEF);
+        if (hdr == NULL) {
+            gnrc_pktbuf_release(pkt);
+        }
+        pkt = hdr;
+    }
+    return pkt;
+}
+
+static void test_magazine__avoids_lock(void)
+{
+    unsigned locked = gnrc_pktbuf_lock_stats()->locked;
+
+    for (unsigned i = 0; i < TEST_ROUNDS; i++) {
+        gnrc_pktsnip_t *pkt = _build_pkt();
+
+        TEST_ASSERT_NOT_NULL(pkt);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(pkt->data, _data, 8));
+        TEST_ASSERT_EQUAL_INT(0, memcmp(pkt->next->data, _data, TEST_SIZE));
+        gnrc_pktbuf_release(pkt);
+    }
+    /* only claiming the cache and the first refills lock */
+    TEST_ASSERT(gnrc_pktbuf_lock_stats()->locked - locked < 8);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_magazine__large(void)
+{
+    unsigned locked = gnrc_pktbuf_lock_stats()->locked;
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL,
+                                          CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_CHUNK_MAX + 1,
+                                          GNRC_NETTYPE_UNDEF);
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    gnrc_pktbuf_release(pkt);
+    /* allocation and release of large snips lock the packet buffer */
+    TEST_ASSERT(gnrc_pktbuf_lock_stats()->locked - locked >= 2);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_magazine__shared(void)
+{
+    gnrc_pktsnip_t *pkt = _build_pkt();
+    gnrc_pktsnip_t *copy;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    gnrc_pktbuf_hold(pkt, 1);
+    copy = gnrc_pktbuf_start_write(pkt);
+    TEST_ASSERT_NOT_NULL(copy);
+    TEST_ASSERT(copy != pkt);
+    TEST_ASSERT_EQUAL_INT(1, pkt->users);
+    /* copy holds the shared payload snip */
+    TEST_ASSERT_EQUAL_INT(2, pkt->next->users);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT_EQUAL_INT(1, copy->next->users);
+    gnrc_pktbuf_release(copy);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_magazine__mark_realloc(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, _data, 32, GNRC_NETTYPE_UNDEF);
+    gnrc_pktsnip_t *hdr;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    hdr = gnrc_pktbuf_mark(pkt, 8, GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(hdr);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(hdr->data, _data, 8));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(pkt->data, _data + 8, 24));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, 4));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(hdr, 48));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_magazine__exhausted(void)
+{
+    gnrc_pktsnip_t *pkt = NULL;
+    gnrc_pktsnip_t *large;
+
+    /* leave the cache of this thread as full as possible */
+    for (unsigned i = 0; i < CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_SIZE; i++) {
+        gnrc_pktsnip_t *tmp = gnrc_pktbuf_add(pkt, NULL, 8,
+                                              GNRC_NETTYPE_UNDEF);
+
+        TEST_ASSERT_NOT_NULL(tmp);
+        pkt = tmp;
+    }
+    gnrc_pktbuf_release(pkt);
+    /* the cached chunks are returned to the packet buffer if it runs out
+     * of space */
+    large = gnrc_pktbuf_add(NULL, NULL,
+                            CONFIG_GNRC_PKTBUF_SIZE - _align(sizeof(gnrc_pktsnip_t)),
+                            GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(large);
+    gnrc_pktbuf_release(large);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void *_other(void *arg)
+{
+    (void)arg;
+    for (unsigned i = 0; i < TEST_ROUNDS; i++) {
+        gnrc_pktsnip_t *pkt = _build_pkt();
+
+        if (pkt == NULL) {
+            _other_failed++;
+            continue;
+        }
+        /* yield with the packet allocated, to interleave with main */
+        thread_yield();
+        gnrc_pktbuf_release(pkt);
+    }
+    return NULL;
+}
+
+static void test_magazine__threads(void)
+{
+    _other_failed = 0;
+    thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN,
+                  0, _other, NULL, "other");
+    for (unsigned i = 0; i < TEST_ROUNDS; i++) {
+        gnrc_pktsnip_t *pkt = _build_pkt();
+
+        TEST_ASSERT_NOT_NULL(pkt);
+        thread_yield();
+        gnrc_pktbuf_release(pkt);
+    }
+    /* let the other thread finish */
+    thread_yield();
+    TEST_ASSERT_EQUAL_INT(0, _other_failed);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void *_short_lived(void *arg)
+{
+    unsigned locked = gnrc_pktbuf_lock_stats()->locked;
+
+    (void)arg;
+    for (unsigned i = 0; i < TEST_ROUNDS; i++) {
+        gnrc_pktsnip_t *pkt = _build_pkt();
+
+        if (pkt == NULL) {
+            _other_failed++;
+            continue;
+        }
+        gnrc_pktbuf_release(pkt);
+    }
+    _other_locked = gnrc_pktbuf_lock_stats()->locked - locked;
+    /* exit with chunks left in the cache */
+    return NULL;
+}
+
+static void *_parked(void *arg)
+{
+    (void)arg;
+    thread_sleep();
+    return NULL;
+}
+
+static void _run_short_lived(char *stack)
+{
+    _other_locked = UINT_MAX;
+    thread_create(stack, sizeof(_stack), THREAD_PRIORITY_MAIN - 1,
+                  0, _short_lived, NULL, "short");
+    /* the thread got a cache, so only claiming it and the first refills
+     * lock */
+    TEST_ASSERT(_other_locked < 8);
+}
+
+static void test_magazine__thread_exit(void)
+{
+    kernel_pid_t parked[ARRAY_SIZE(_parked_stacks)];
+
+    _other_failed = 0;
+    /* more threads than caches, each exits before the next one starts and
+     * gets the PID of the previous one, but not its stack */
+    for (unsigned i = 0; i < 2 * CONFIG_GNRC_PKTBUF_STATIC_MAGAZINE_NUMOF; i++) {
+        _run_short_lived((i & 1) ? _stack2 : _stack);
+    }
+    /* the PIDs of exited threads are taken by threads that do not use the
+     * packet buffer, so the caches of the exited threads are orphaned */
+    for (unsigned i = 0; i < ARRAY_SIZE(_parked_stacks); i++) {
+        _run_short_lived(_stack);
+        parked[i] = thread_create(_parked_stacks[i], sizeof(_parked_stacks[i]),
+                                  THREAD_PRIORITY_MAIN - 1, 0, _parked, NULL,
+                                  "parked");
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(parked); i++) {
+        thread_wakeup(parked[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(0, _other_failed);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static Test *tests_gnrc_pktbuf_static_magazine(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_magazine__avoids_lock),
+        new_TestFixture(test_magazine__large),
+        new_TestFixture(test_magazine__shared),
+        new_TestFixture(test_magazine__mark_realloc),
+        new_TestFixture(test_magazine__exhausted),
+        new_TestFixture(test_magazine__threads),
+        new_TestFixture(test_magazine__thread_exit),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, set_up, NULL, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_pktbuf_static_magazine());
+    TESTS_END();
+    return 0;
+}
@@ -0,0 +1,148 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the TLSF allocator of the static packet buffer
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+#include "net/gnrc/pktbuf.h"
+#include "random.h"
+
+#include "pktbuf_static.h"
+
+#define TEST_SNIPS      (16U)
+#define TEST_ROUNDS     (2000U)
+
+static gnrc_pktsnip_t *_snips[TEST_SNIPS];
+
+static void set_up(void)
+{
+    memset(_snips, 0, sizeof(_snips));
+    gnrc_pktbuf_init();
+}
+
+static void test_pktbuf_tlsf__fill_complete(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL,
+                                          CONFIG_GNRC_PKTBUF_SIZE -
+                                          _align(sizeof(gnrc_pktsnip_t)),
+                                          GNRC_NETTYPE_UNDEF);
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT_NULL(gnrc_pktbuf_add(NULL, NULL, 1, GNRC_NETTYPE_UNDEF));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_tlsf__merge_holes(void)
+{
+    const size_t size = (CONFIG_GNRC_PKTBUF_SIZE / TEST_SNIPS) -
+                        _align(sizeof(gnrc_pktsnip_t));
+
+    for (unsigned i = 0; i < TEST_SNIPS; i++) {
+        _snips[i] = gnrc_pktbuf_add(NULL, NULL, size, GNRC_NETTYPE_UNDEF);
+        TEST_ASSERT_NOT_NULL(_snips[i]);
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    /* release every other snip, so no hole is large enough for two snips */
+    for (unsigned i = 0; i < TEST_SNIPS; i += 2) {
+        gnrc_pktbuf_release(_snips[i]);
+        TEST_ASSERT(gnrc_pktbuf_is_sane());
+    }
+    TEST_ASSERT_NULL(gnrc_pktbuf_add(NULL, NULL, 2 * size, GNRC_NETTYPE_UNDEF));
+    /* releasing the remaining snips merges holes from both sides */
+    for (unsigned i = 1; i < TEST_SNIPS; i += 2) {
+        gnrc_pktbuf_release(_snips[i]);
+        TEST_ASSERT(gnrc_pktbuf_is_sane());
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_tlsf__exact_fit(void)
+{
+    /* a hole that is not large enough for the rounded up size class must
+     * still be found when it fits */
+    const size_t size = _align(3 * sizeof(gnrc_pktsnip_t)) + 1;
+    gnrc_pktsnip_t *hole, *fill, *pkt;
+
+    hole = gnrc_pktbuf_add(NULL, NULL, size, GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(hole);
+    fill = gnrc_pktbuf_add(NULL, NULL,
+                           CONFIG_GNRC_PKTBUF_SIZE - _align(size) -
+                           (3 * _align(sizeof(gnrc_pktsnip_t))),
+                           GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(fill);
+    gnrc_pktbuf_release(hole);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    pkt = gnrc_pktbuf_add(NULL, NULL, size, GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    gnrc_pktbuf_release(fill);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_tlsf__random(void)
+{
+    random_init(0x2b1f);
+    for (unsigned round = 0; round < TEST_ROUNDS; round++) {
+        unsigned i = random_uint32_range(0, TEST_SNIPS);
+
+        if (_snips[i] == NULL) {
+            _snips[i] = gnrc_pktbuf_add(NULL, NULL,
+                                        random_uint32_range(1, 256),
+                                        GNRC_NETTYPE_UNDEF);
+        }
+        else if (random_uint32_range(0, 2)) {
+            TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(
+                                        _snips[i],
+                                        random_uint32_range(1, _snips[i]->size + 1)));
+        }
+        else {
+            gnrc_pktbuf_release(_snips[i]);
+            _snips[i] = NULL;
+        }
+        TEST_ASSERT(gnrc_pktbuf_is_sane());
+    }
+    for (unsigned i = 0; i < TEST_SNIPS; i++) {
+        gnrc_pktbuf_release(_snips[i]);
+        _snips[i] = NULL;
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static Test *tests_gnrc_pktbuf_static_tlsf(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_pktbuf_tlsf__fill_complete),
+        new_TestFixture(test_pktbuf_tlsf__merge_holes),
+        new_TestFixture(test_pktbuf_tlsf__exact_fit),
+        new_TestFixture(test_pktbuf_tlsf__random),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, set_up, NULL, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_pktbuf_static_tlsf());
+    TESTS_END();
+
+    return 0;
+}
@@ -423,6 +423,63 @@ static void test_rbuf_add__full_rbuf(void)
     _check_pktbuf(NULL);
 }
 
+static void test_rbuf_add__interleaved_datagrams(void)
+{
+    const gnrc_sixlowpan_frag_rb_t *rbuf;
+    unsigned rbuf_entries = 0;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        gnrc_pktsnip_t *pkt;
+
+        _set_fragment_tag(_fragment1, TEST_TAG + i);
+        pkt = gnrc_pktbuf_add(NULL, _fragment1, sizeof(_fragment1),
+                              GNRC_NETTYPE_SIXLOWPAN);
+        TEST_ASSERT_NOT_NULL(pkt);
+        TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_frag_rb_add(
+            &_test_netif_hdr.hdr, pkt, TEST_FRAGMENT1_OFFSET, TEST_PAGE
+        ));
+    }
+    /* add second fragments in reverse order, so each one has to be matched
+     * to its datagram by tag and not by recency */
+    for (unsigned i = CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i > 0; i--) {
+        gnrc_pktsnip_t *pkt;
+
+        _set_fragment_tag(_fragment2, TEST_TAG + i - 1);
+        pkt = gnrc_pktbuf_add(NULL, _fragment2, sizeof(_fragment2),
+                              GNRC_NETTYPE_SIXLOWPAN);
+        TEST_ASSERT_NOT_NULL(pkt);
+        TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_frag_rb_add(
+            &_test_netif_hdr.hdr, pkt, TEST_FRAGMENT2_OFFSET, TEST_PAGE
+        ));
+    }
+    rbuf = gnrc_sixlowpan_frag_rb_array();
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        const gnrc_sixlowpan_frag_rb_t *entry = &rbuf[i];
+
+        if (!gnrc_sixlowpan_frag_rb_entry_empty(entry)) {
+            rbuf_entries++;
+            /* both fragments of the datagram ended up in the same entry */
+            TEST_ASSERT_EQUAL_INT(TEST_FRAGMENT3_OFFSET,
+                                  entry->super.current_size);
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE, rbuf_entries);
+    /* removing one datagram must not affect look-up of the others */
+    gnrc_sixlowpan_frag_rb_rm_by_datagram(&_test_netif_hdr.hdr, TEST_TAG);
+    TEST_ASSERT(!gnrc_sixlowpan_frag_rb_exists(&_test_netif_hdr.hdr, TEST_TAG));
+    for (unsigned i = 1; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        gnrc_sixlowpan_frag_rb_t *entry = gnrc_sixlowpan_frag_rb_get_by_datagram(
+            &_test_netif_hdr.hdr, TEST_TAG + i
+        );
+
+        TEST_ASSERT_NOT_NULL(entry);
+        TEST_ASSERT_EQUAL_INT(TEST_TAG + i, entry->super.tag);
+        /* releasing pkt to check if packet buffer is empty in the end */
+        gnrc_pktbuf_release(entry->pkt);
+    }
+    _check_pktbuf(NULL);
+}
+
 static void test_rbuf_add__too_big_fragment(void)
 {
     gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, _fragment1,
@@ -647,6 +704,7 @@ static void run_unittests(void)
         new_TestFixture(test_rbuf_add__success_duplicate_fragments),
         new_TestFixture(test_rbuf_add__success_complete),
         new_TestFixture(test_rbuf_add__full_rbuf),
+        new_TestFixture(test_rbuf_add__interleaved_datagrams),
         new_TestFixture(test_rbuf_add__too_big_fragment),
         new_TestFixture(test_rbuf_add__overlap_lhs),
         new_TestFixture(test_rbuf_add__overlap_rhs),
@@ -281,6 +281,9 @@ static const gnrc_sixlowpan_frag_rb_base_t _vrbe_base = {
     };
 static uint8_t _target_buf[128U];
 static uint8_t _target_buf_len;
+/* start of the first payload chunk handed to the device, to check whether a
+ * fragment was forwarded without copying it */
+static const void *_target_payload_base;
 /* to protect _target_buf and _target_buf_len */
 /* to wait for new data in _target_buf */
 static mutex_t _target_buf_filled = MUTEX_INIT_LOCKED;
@@ -618,6 +621,86 @@ static void test_minfwd_forward__success__nth_frag_complete(void)
                                                  _vrbe_base.tag));
 }
 
+static void test_minfwd_forward_inplace__success__nth_frag(void)
+{
+    gnrc_sixlowpan_frag_vrb_t *vrbe = gnrc_sixlowpan_frag_vrb_add(
+            &_vrbe_base, _mock_netif, _rem_l2, sizeof(_rem_l2)
+        );
+    gnrc_pktsnip_t *pkt;
+    const void *frag_data;
+    size_t mhr_len;
+
+    vrbe->super.arrival = xtimer_now_usec();
+    TEST_ASSERT_NOT_NULL((pkt = gnrc_pktbuf_add(NULL, _test_nth_frag,
+                                                sizeof(_test_nth_frag),
+                                                GNRC_NETTYPE_SIXLOWPAN)));
+    frag_data = pkt->data;
+    netdev_ieee802154_t *netdev_ieee802154 = container_of(_mock_netif->dev,
+                                                          netdev_ieee802154_t,
+                                                          netdev);
+    netdev_test_t *netdev_test = container_of(netdev_ieee802154, netdev_test_t,
+                                              netdev);
+    netdev_test_set_send_cb(netdev_test,
+                            _mock_netdev_send);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_sixlowpan_frag_minfwd_forward_inplace(pkt,
+                                                                        vrbe,
+                                                                        0));
+    TEST_ASSERT((mhr_len = _wait_for_packet(sizeof(_test_nth_frag))));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    /* fragment was handed to the device where it was received */
+    TEST_ASSERT(_target_payload_base == frag_data);
+    _check_vrbe_values(vrbe, mhr_len, NTH_FRAGMENT);
+    TEST_ASSERT(_target_buf[0] & IEEE802154_FCF_FRAME_PEND);
+    TEST_ASSERT_MESSAGE(
+            memcmp(&_test_nth_frag[TEST_NTH_FRAG_PAYLOAD_POS],
+                   &_target_buf[mhr_len + sizeof(sixlowpan_frag_n_t)],
+                   TEST_NTH_FRAG_SIZE) == 0,
+            "unexpected forwarded packet payload"
+        );
+    /* VRB entry should not have been removed */
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_frag_vrb_get(_vrbe_base.src,
+                                                     _vrbe_base.src_len,
+                                                     _vrbe_base.tag));
+}
+
+static void test_minfwd_forward_inplace__success__shared(void)
+{
+    gnrc_sixlowpan_frag_vrb_t *vrbe = gnrc_sixlowpan_frag_vrb_add(
+            &_vrbe_base, _mock_netif, _rem_l2, sizeof(_rem_l2)
+        );
+    gnrc_pktsnip_t *pkt;
+    size_t mhr_len;
+
+    vrbe->super.arrival = xtimer_now_usec();
+    TEST_ASSERT_NOT_NULL((pkt = gnrc_pktbuf_add(NULL, _test_nth_frag,
+                                                sizeof(_test_nth_frag),
+                                                GNRC_NETTYPE_SIXLOWPAN)));
+    /* keep a reference, so the fragment must not be modified */
+    gnrc_pktbuf_hold(pkt, 1);
+    netdev_ieee802154_t *netdev_ieee802154 = container_of(_mock_netif->dev,
+                                                          netdev_ieee802154_t,
+                                                          netdev);
+    netdev_test_t *netdev_test = container_of(netdev_ieee802154, netdev_test_t,
+                                              netdev);
+    netdev_test_set_send_cb(netdev_test,
+                            _mock_netdev_send);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_sixlowpan_frag_minfwd_forward_inplace(pkt,
+                                                                        vrbe,
+                                                                        0));
+    TEST_ASSERT((mhr_len = _wait_for_packet(sizeof(_test_nth_frag))));
+    TEST_ASSERT(_target_payload_base != pkt->data);
+    _check_vrbe_values(vrbe, mhr_len, NTH_FRAGMENT);
+    TEST_ASSERT_EQUAL_INT(1, pkt->users);
+    TEST_ASSERT_MESSAGE(
+            memcmp(_test_nth_frag, pkt->data, sizeof(_test_nth_frag)) == 0,
+            "shared fragment was modified"
+        );
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
 static void test_minfwd_forward__ENOMEM__netif_hdr_build_fail(void)
 {
     gnrc_sixlowpan_frag_vrb_t *vrbe = gnrc_sixlowpan_frag_vrb_add(
@@ -1210,6 +1293,7 @@ static void test_sixlo_recv__nth_frag(void)
 {
     gnrc_sixlowpan_frag_vrb_t *vrbe;
     gnrc_pktsnip_t *frag;
+    const void *frag_data;
     size_t mhr_len;
 
     TEST_ASSERT_NOT_NULL(
@@ -1227,6 +1311,7 @@ static void test_sixlo_recv__nth_frag(void)
                                               netdev);
     netdev_test_set_send_cb(netdev_test,
                             _mock_netdev_send);
+    frag_data = frag->data;
     TEST_ASSERT(0 < gnrc_netapi_dispatch_receive(GNRC_NETTYPE_SIXLOWPAN,
                                                  GNRC_NETREG_DEMUX_CTX_ALL,
                                                  frag));
@@ -1235,6 +1320,8 @@ static void test_sixlo_recv__nth_frag(void)
     TEST_ASSERT_NULL(_first_non_empty_rbuf());
     TEST_ASSERT(gnrc_pktbuf_is_sane());
     TEST_ASSERT(gnrc_pktbuf_is_empty());
+    /* fragment was forwarded without copying it */
+    TEST_ASSERT(_target_payload_base == frag_data);
     _check_vrbe_values(vrbe, mhr_len, NTH_FRAGMENT);
     TEST_ASSERT_EQUAL_INT(TEST_NTH_FRAG_SIZE, vrbe->super.current_size);
     TEST_ASSERT(_target_buf[0] & IEEE802154_FCF_FRAME_PEND);
@@ -1478,6 +1565,8 @@ static Test *tests_gnrc_sixlowpan_frag_minfwd_api(void)
         new_TestFixture(test_minfwd_forward__success__1st_frag_iphc),
         new_TestFixture(test_minfwd_forward__success__nth_frag_incomplete),
         new_TestFixture(test_minfwd_forward__success__nth_frag_complete),
+        new_TestFixture(test_minfwd_forward_inplace__success__nth_frag),
+        new_TestFixture(test_minfwd_forward_inplace__success__shared),
         new_TestFixture(test_minfwd_forward__ENOMEM__netif_hdr_build_fail),
         new_TestFixture(test_minfwd_frag_iphc__success),
         new_TestFixture(test_minfwd_frag_iphc__no_frag),
@@ -1791,6 +1880,8 @@ static int _mock_netdev_send(netdev_t *dev, const iolist_t *iolist)
     (void)dev;
     mutex_lock(&_target_buf_barrier);
     _target_buf_len = 0;
+    _target_payload_base = (iolist->iol_next) ? iolist->iol_next->iol_base
+                                              : NULL;
     for (const iolist_t *ptr = iolist; ptr != NULL; ptr = ptr->iol_next) {
         if ((_target_buf_len + iolist->iol_len) > sizeof(_target_buf)) {
             return -ENOBUFS;
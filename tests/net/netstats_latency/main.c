@@ -0,0 +1,240 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the latency histograms of @ref net_gnrc_netif
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "net/ethernet.h"
+#include "net/gnrc.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/netdev_test.h"
+#include "net/netstats.h"
+#include "net/netstats/latency.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#define PKTS_NUMOF      (4U)
+#define AIR_US          (1000U)
+
+static const uint8_t _src[] = { 0x3e, 0xe6, 0xb5, 0x22, 0xfd, 0x0a };
+static const uint8_t _dst[] = { 0x3e, 0xe6, 0xb5, 0x22, 0xfd, 0x0b };
+static gnrc_netif_t _netif;
+static netdev_test_t _netdev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static bool _tx_events;
+static netstats_latency_t _stats;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_src));
+    memcpy(value, _src, sizeof(_src));
+    return sizeof(_src);
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    int res = 0;
+
+    for (; iolist != NULL; iolist = iolist->iol_next) {
+        res += iolist->iol_len;
+    }
+    if (_tx_events) {
+        /* behaves like a radio that does channel access in software */
+        dev->event_callback(dev, NETDEV_EVENT_TX_STARTED);
+        ztimer_spin(ZTIMER_USEC, AIR_US);
+        dev->event_callback(dev, NETDEV_EVENT_TX_COMPLETE);
+    }
+    return res;
+}
+
+static int _recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    static const uint8_t payload[] = { 0x12, 0x34, 0x45, 0x56 };
+    ethernet_hdr_t *hdr = (ethernet_hdr_t *)buf;
+
+    (void)dev;
+    (void)info;
+    if (buf == NULL) {
+        return sizeof(ethernet_hdr_t) + sizeof(payload);
+    }
+    expect((size_t)len >= sizeof(ethernet_hdr_t) + sizeof(payload));
+    memcpy(hdr->dst, _src, sizeof(hdr->dst));
+    memcpy(hdr->src, _dst, sizeof(hdr->src));
+    hdr->type = byteorder_htons(ETHERTYPE_UNKNOWN);
+    memcpy(hdr + 1, payload, sizeof(payload));
+    return sizeof(ethernet_hdr_t) + sizeof(payload);
+}
+
+static void _isr(netdev_t *dev)
+{
+    dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+}
+
+static gnrc_pktsnip_t *_build_pkt(void)
+{
+    gnrc_pktsnip_t *netif, *payload;
+
+    netif = gnrc_netif_hdr_build(NULL, 0, _dst, sizeof(_dst));
+    expect(netif != NULL);
+    payload = gnrc_pktbuf_add(NULL, "abcdefgh", 8, GNRC_NETTYPE_UNDEF);
+    expect(payload != NULL);
+    return gnrc_pkt_prepend(payload, netif);
+}
+
+static uint32_t _samples(netstats_latency_kind_t kind)
+{
+    uint32_t total = 0;
+
+    for (unsigned i = 0; i < CONFIG_NETSTATS_LATENCY_BUCKETS; i++) {
+        total += _stats.count[kind][i];
+    }
+    return total;
+}
+
+static void _get_stats(void)
+{
+    TEST_ASSERT_EQUAL_INT(sizeof(_stats),
+                          gnrc_netapi_get(_netif.pid, NETOPT_STATS,
+                                          NETSTATS_LATENCY, &_stats,
+                                          sizeof(_stats)));
+}
+
+static void set_up(void)
+{
+    gnrc_netapi_set(_netif.pid, NETOPT_STATS, NETSTATS_LATENCY, NULL, 0);
+}
+
+static void test_bucket(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, netstats_latency_bucket(0));
+    TEST_ASSERT_EQUAL_INT(0, netstats_latency_bucket(1));
+    TEST_ASSERT_EQUAL_INT(1, netstats_latency_bucket(2));
+    TEST_ASSERT_EQUAL_INT(1, netstats_latency_bucket(3));
+    TEST_ASSERT_EQUAL_INT(9, netstats_latency_bucket(1000));
+    TEST_ASSERT_EQUAL_INT(CONFIG_NETSTATS_LATENCY_BUCKETS - 1,
+                          netstats_latency_bucket(UINT32_MAX));
+}
+
+static void test_reset(void)
+{
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netif_send(&_netif, _build_pkt()));
+    _get_stats();
+    TEST_ASSERT_EQUAL_INT(1, _samples(NETSTATS_LATENCY_TX_QUEUE));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netapi_set(_netif.pid, NETOPT_STATS,
+                                             NETSTATS_LATENCY, NULL, 0));
+    _get_stats();
+    for (unsigned kind = 0; kind < NETSTATS_LATENCY_NUMOF; kind++) {
+        TEST_ASSERT_EQUAL_INT(0, _samples(kind));
+    }
+}
+
+/* must run before test_tx__events, the interface remembers that the device
+ * reports TX completion by events */
+static void test_tx__blocking(void)
+{
+    for (unsigned i = 0; i < PKTS_NUMOF; i++) {
+        TEST_ASSERT_EQUAL_INT(1, gnrc_netif_send(&_netif, _build_pkt()));
+    }
+    _get_stats();
+    TEST_ASSERT_EQUAL_INT(PKTS_NUMOF, _samples(NETSTATS_LATENCY_TX_QUEUE));
+    TEST_ASSERT_EQUAL_INT(0, _samples(NETSTATS_LATENCY_TX_ACCESS));
+    TEST_ASSERT_EQUAL_INT(PKTS_NUMOF, _samples(NETSTATS_LATENCY_TX_AIR));
+    TEST_ASSERT_EQUAL_INT(0, _samples(NETSTATS_LATENCY_RX));
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_tx__events(void)
+{
+    unsigned min_bucket = netstats_latency_bucket(AIR_US);
+
+    _tx_events = true;
+    for (unsigned i = 0; i < PKTS_NUMOF; i++) {
+        TEST_ASSERT_EQUAL_INT(1, gnrc_netif_send(&_netif, _build_pkt()));
+    }
+    _tx_events = false;
+    _get_stats();
+    TEST_ASSERT_EQUAL_INT(PKTS_NUMOF, _samples(NETSTATS_LATENCY_TX_QUEUE));
+    TEST_ASSERT_EQUAL_INT(PKTS_NUMOF, _samples(NETSTATS_LATENCY_TX_ACCESS));
+    TEST_ASSERT_EQUAL_INT(PKTS_NUMOF, _samples(NETSTATS_LATENCY_TX_AIR));
+    /* the transmission took at least AIR_US */
+    for (unsigned i = 0; i < min_bucket; i++) {
+        TEST_ASSERT_EQUAL_INT(0, _stats.count[NETSTATS_LATENCY_TX_AIR][i]);
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_rx(void)
+{
+    for (unsigned i = 0; i < PKTS_NUMOF; i++) {
+        netdev_trigger_event_isr(&_netdev.netdev.netdev);
+    }
+    _get_stats();
+    TEST_ASSERT_EQUAL_INT(PKTS_NUMOF, _samples(NETSTATS_LATENCY_RX));
+    TEST_ASSERT_EQUAL_INT(0, _samples(NETSTATS_LATENCY_TX_QUEUE));
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static Test *tests_netstats_latency(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_bucket),
+        new_TestFixture(test_reset),
+        new_TestFixture(test_tx__blocking),
+        new_TestFixture(test_tx__events),
+        new_TestFixture(test_rx),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, set_up, NULL, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    netdev_test_setup(&_netdev, 0);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_netdev, NETOPT_MAX_PDU_SIZE,
+                           _get_max_packet_size);
+    netdev_test_set_get_cb(&_netdev, NETOPT_ADDRESS, _get_address);
+    netdev_test_set_send_cb(&_netdev, _send);
+    netdev_test_set_recv_cb(&_netdev, _recv);
+    netdev_test_set_isr_cb(&_netdev, _isr);
+    expect(gnrc_netif_ethernet_create(&_netif, _netif_stack,
+                                      sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                      "eth", &_netdev.netdev.netdev) == 0);
+
+    TESTS_START();
+    TESTS_RUN(tests_netstats_latency());
+    TESTS_END();
+    return 0;
+}
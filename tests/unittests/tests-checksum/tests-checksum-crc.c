@@ -0,0 +1,129 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#include "checksum/crc.h"
+#include "checksum/crc16_ccitt.h"
+#include "checksum/crc32.h"
+#include "container.h"
+#include "tests-checksum.h"
+
+static const unsigned char _check[] = "123456789";
+
+static uint32_t _table[256];
+
+/* check values from the "Catalogue of parametrised CRC algorithms" */
+static const struct {
+    crc_model_t model;
+    uint32_t check;
+} _catalogue[] = {
+    /* CRC-3/ROHC */
+    { { .width = 3, .poly = 0x3, .init = 0x7, .refin = true, .refout = true,
+        .xorout = 0x0 }, 0x6 },
+    /* CRC-5/USB */
+    { { .width = 5, .poly = 0x05, .init = 0x1f, .refin = true, .refout = true,
+        .xorout = 0x1f }, 0x19 },
+    /* CRC-7/MMC */
+    { { .width = 7, .poly = 0x09, .init = 0x00, .refin = false, .refout = false,
+        .xorout = 0x00 }, 0x75 },
+    /* CRC-12/UMTS */
+    { { .width = 12, .poly = 0x80f, .init = 0x000, .refin = false, .refout = true,
+        .xorout = 0x000 }, 0xdaf },
+    /* CRC-24/OPENPGP */
+    { { .width = 24, .poly = 0x864cfb, .init = 0xb704ce, .refin = false,
+        .refout = false, .xorout = 0x000000 }, 0x21cf02 },
+    /* CRC-32/MPEG-2 */
+    { { .width = 32, .poly = 0x04c11db7, .init = 0xffffffff, .refin = false,
+        .refout = false, .xorout = 0x00000000 }, 0x0376e6e7 },
+};
+
+static void test_checksum_crc_catalogue(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_catalogue); i++) {
+        const crc_model_t *model = &_catalogue[i].model;
+
+        TEST_ASSERT_EQUAL_INT(_catalogue[i].check,
+                              crc_calc(model, NULL, _check, sizeof(_check) - 1));
+        crc_table_init(model, _table);
+        TEST_ASSERT_EQUAL_INT(_catalogue[i].check,
+                              crc_calc(model, _table, _check, sizeof(_check) - 1));
+    }
+}
+
+static void test_checksum_crc_predefined(void)
+{
+    static const struct {
+        const crc_model_t *model;
+        uint32_t check;
+    } models[] = {
+        { &crc_model_crc32, 0xcbf43926 },
+        { &crc_model_crc32c, 0xe3069283 },
+        { &crc_model_crc16_kermit, 0x2189 },
+        { &crc_model_crc16_ccitt_false, 0x29b1 },
+        { &crc_model_crc8_smbus, 0xf4 },
+    };
+
+    for (unsigned i = 0; i < ARRAY_SIZE(models); i++) {
+        TEST_ASSERT_EQUAL_INT(models[i].check,
+                              crc_calc(models[i].model, NULL, _check,
+                                       sizeof(_check) - 1));
+        crc_table_init(models[i].model, _table);
+        TEST_ASSERT_EQUAL_INT(models[i].check,
+                              crc_calc(models[i].model, _table, _check,
+                                       sizeof(_check) - 1));
+    }
+}
+
+static void test_checksum_crc_update(void)
+{
+    const crc_model_t *model = &crc_model_crc16_ccitt_false;
+    uint32_t crc = crc_start(model);
+
+    crc = crc_update(model, NULL, crc, _check, 4);
+    crc = crc_update(model, NULL, crc, _check + 4, 0);
+    crc = crc_update(model, NULL, crc, _check + 4, 5);
+    TEST_ASSERT_EQUAL_INT(0x29b1, crc_finish(model, crc));
+}
+
+/* compare against the dedicated implementations, including the multi-byte
+ * code paths of crc32() (module `crc32_fast`, slicing-by-4 by default, see
+ * Makefile.include) for all lengths and alignments */
+static void test_checksum_crc_dedicated(void)
+{
+    uint8_t buf[80 + 8];
+
+    for (unsigned i = 0; i < sizeof(buf); i++) {
+        buf[i] = i * 0x9d + 0x42;
+    }
+
+    crc_table_init(&crc_model_crc32, _table);
+    for (unsigned align = 0; align < 8; align++) {
+        for (unsigned len = 0; len <= 80; len++) {
+            TEST_ASSERT_EQUAL_INT(crc_calc(&crc_model_crc32, _table,
+                                           &buf[align], len),
+                                  crc32(&buf[align], len));
+        }
+    }
+
+    for (unsigned len = 0; len <= 80; len++) {
+        TEST_ASSERT_EQUAL_INT(crc_calc(&crc_model_crc16_kermit, NULL, buf, len),
+                              crc16_ccitt_kermit_calc(buf, len));
+        TEST_ASSERT_EQUAL_INT(crc_calc(&crc_model_crc16_ccitt_false, NULL, buf, len),
+                              crc16_ccitt_false_calc(buf, len));
+    }
+}
+
+Test *tests_checksum_crc_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_checksum_crc_catalogue),
+        new_TestFixture(test_checksum_crc_predefined),
+        new_TestFixture(test_checksum_crc_update),
+        new_TestFixture(test_checksum_crc_dedicated),
+    };
+
+    EMB_UNIT_TESTCALLER(checksum_crc_tests, NULL, NULL, fixtures);
+
+    return (Test *)&checksum_crc_tests;
+}
@@ -18,6 +18,7 @@ void tests_checksum(void)
     TESTS_RUN(tests_checksum_crc16_ccitt_aug_tests());
     TESTS_RUN(tests_checksum_crc16_ccitt_false_tests());
     TESTS_RUN(tests_checksum_crc32_tests());
+    TESTS_RUN(tests_checksum_crc_tests());
     TESTS_RUN(tests_checksum_fletcher16_tests());
     TESTS_RUN(tests_checksum_fletcher32_tests());
     TESTS_RUN(tests_checksum_ucrc16_tests());
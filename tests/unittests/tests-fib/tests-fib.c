@@ -11,6 +11,7 @@
 #include <stdio.h> /**< required for snprintf() */
 #include <string.h>
 #include <errno.h>
+#include "container.h"
 #include "embUnit.h"
 #include "tests-fib.h"
 #include "xtimer.h"
@@ -983,6 +984,187 @@ static void test_fib_20_replace_prefix(void)
     fib_deinit(&test_fib_table);
 }
 
+/* simple xorshift, so the test does not depend on the random module */
+static uint32_t _rand(void)
+{
+    static uint32_t state = 0x2545f491;
+
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+/* address with random bytes from a small set up to prefix_len bytes, so
+ * prefixes overlap a lot */
+static void _rand_addr(uint8_t *addr, size_t size, unsigned prefix_len)
+{
+    static const uint8_t bytes[] = { 0x00, 0x01, 0x80 };
+
+    memset(addr, 0, size);
+    for (unsigned i = 0; i < prefix_len; i++) {
+        addr[i] = bytes[_rand() % ARRAY_SIZE(bytes)];
+    }
+}
+
+/*
+* @brief testing random adds, removes and lookups of prefixes against a
+*        brute force longest prefix match
+*/
+static void test_fib_21_random_prefixes(void)
+{
+    enum { addr_size = 16, rounds = 2000 };
+    struct {
+        uint8_t dst[addr_size];
+        unsigned prefix_len;    /* in bytes */
+        uint8_t nxt;
+        bool used;
+    } ref[TEST_FIB_TABLE_SIZE] = { 0 };
+    uint8_t addr[addr_size];
+    uint8_t nxt[addr_size];
+    uint8_t nxt_hop[addr_size];
+
+    for (unsigned round = 0; round < rounds; round++) {
+        uint32_t r = _rand();
+        unsigned i = r % TEST_FIB_TABLE_SIZE;
+
+        if ((r & 0x300) == 0) {
+            /* remove */
+            if (ref[i].used) {
+                fib_remove_entry(&test_fib_table, ref[i].dst, addr_size);
+                ref[i].used = false;
+            }
+            continue;
+        }
+
+        unsigned prefix_len = (r >> 16) % (addr_size + 1);
+        _rand_addr(addr, addr_size, prefix_len);
+
+        if ((r & 0x300) == 0x100) {
+            /* add (or update an entry with the same address) */
+            unsigned slot = TEST_FIB_TABLE_SIZE;
+            for (unsigned j = 0; j < TEST_FIB_TABLE_SIZE; j++) {
+                if (ref[j].used && !memcmp(ref[j].dst, addr, addr_size)) {
+                    slot = j;
+                    break;
+                }
+                if (!ref[j].used && (slot == TEST_FIB_TABLE_SIZE)) {
+                    slot = j;
+                }
+            }
+            if (slot == TEST_FIB_TABLE_SIZE) {
+                continue;
+            }
+            if (!ref[slot].used) {
+                memcpy(ref[slot].dst, addr, addr_size);
+                ref[slot].prefix_len = prefix_len;
+                ref[slot].used = true;
+            }
+            ref[slot].nxt = round % 10;
+            memset(nxt, ref[slot].nxt, addr_size);
+            uint32_t flags = (prefix_len > 0) ?
+                ((prefix_len << 3) << FIB_FLAG_NET_PREFIX_SHIFT) : 0;
+            TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42, addr,
+                                                   addr_size, flags, nxt,
+                                                   addr_size, 0,
+                                                   (uint32_t)FIB_LIFETIME_NO_EXPIRE));
+            continue;
+        }
+
+        /* lookup, the destination may also be longer than the prefix */
+        if (r & 0x400) {
+            for (unsigned j = prefix_len; j < addr_size; j++) {
+                addr[j] = _rand();
+            }
+        }
+        int best = -1;
+        unsigned best_len = 0;
+        for (unsigned j = 0; j < TEST_FIB_TABLE_SIZE; j++) {
+            if (!ref[j].used) {
+                continue;
+            }
+            if (!memcmp(ref[j].dst, addr, addr_size)) {
+                /* exact match */
+                best = j;
+                break;
+            }
+            /* all-zero addresses are default routes */
+            uint8_t zeros[addr_size];
+            memset(zeros, 0, addr_size);
+            unsigned len = memcmp(ref[j].dst, zeros, addr_size) ? ref[j].prefix_len : 0;
+            if (len == addr_size) {
+                /* host route */
+                continue;
+            }
+            if (!memcmp(ref[j].dst, addr, len) && ((best < 0) || (len > best_len))) {
+                best = j;
+                best_len = len;
+            }
+        }
+
+        kernel_pid_t iface_id;
+        uint32_t next_hop_flags;
+        size_t nxt_hop_size = addr_size;
+        int ret = fib_get_next_hop(&test_fib_table, &iface_id, nxt_hop,
+                                   &nxt_hop_size, &next_hop_flags, addr,
+                                   addr_size, 0);
+        if (best < 0) {
+            TEST_ASSERT_EQUAL_INT(-EHOSTUNREACH, ret);
+        }
+        else {
+            TEST_ASSERT_EQUAL_INT(0, ret);
+            memset(nxt, ref[best].nxt, addr_size);
+            TEST_ASSERT_EQUAL_INT(0, memcmp(nxt, nxt_hop, addr_size));
+        }
+    }
+
+    fib_deinit(&test_fib_table);
+}
+
+/*
+* @brief testing that expired entries neither match nor take up space
+*/
+static void test_fib_22_expired_prefix(void)
+{
+    enum { addr_size = 16 };
+    uint8_t addr_dst[addr_size] = { 0x20, 0x01, 0x0d, 0xb8 };
+    uint8_t addr_nxt[addr_size] = { 0xfe, 0x80, [15] = 0x01 };
+    uint8_t addr_lookup[addr_size] = { 0x20, 0x01, 0x0d, 0xb8, [15] = 0x42 };
+    uint8_t addr_nxt_hop[addr_size];
+    size_t nxt_hop_size = addr_size;
+    kernel_pid_t iface_id;
+    uint32_t next_hop_flags;
+
+    /* fill the table with a short lived prefix and host routes */
+    TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42, addr_dst, addr_size,
+                                           (32 << FIB_FLAG_NET_PREFIX_SHIFT),
+                                           addr_nxt, addr_size, 0, 1));
+    for (unsigned i = 1; i < TEST_FIB_TABLE_SIZE; i++) {
+        addr_dst[15] = i;
+        TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42, addr_dst,
+                                               addr_size, 0, addr_nxt,
+                                               addr_size, 0, 100000));
+    }
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                                              addr_nxt_hop, &nxt_hop_size,
+                                              &next_hop_flags, addr_lookup,
+                                              addr_size, 0));
+
+    xtimer_usleep(2000);
+
+    nxt_hop_size = addr_size;
+    TEST_ASSERT_EQUAL_INT(-EHOSTUNREACH, fib_get_next_hop(&test_fib_table, &iface_id,
+                                                          addr_nxt_hop, &nxt_hop_size,
+                                                          &next_hop_flags, addr_lookup,
+                                                          addr_size, 0));
+    addr_dst[15] = 0x42;
+    TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42, addr_dst, addr_size,
+                                           0, addr_nxt, addr_size, 0, 100000));
+    TEST_ASSERT_EQUAL_INT(TEST_FIB_TABLE_SIZE, fib_get_num_used_entries(&test_fib_table));
+
+    fib_deinit(&test_fib_table);
+}
+
 Test *tests_fib_tests(void)
 {
     fib_init(&test_fib_table);
@@ -1007,6 +1189,8 @@ Test *tests_fib_tests(void)
                         new_TestFixture(test_fib_18_get_next_hop_invalid_parameters),
                         new_TestFixture(test_fib_19_default_gateway),
                         new_TestFixture(test_fib_20_replace_prefix),
+                        new_TestFixture(test_fib_21_random_prefixes),
+                        new_TestFixture(test_fib_22_expired_prefix),
     };
 
     EMB_UNIT_TESTCALLER(fib_tests, NULL, NULL, fixtures);
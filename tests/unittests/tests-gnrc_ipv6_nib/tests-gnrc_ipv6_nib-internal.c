@@ -361,6 +361,62 @@ static void test_nib_get__empty(void)
     TEST_ASSERT_NULL(_nib_onl_get(&addr, IFACE));
 }
 
+/*
+ * Creates CONFIG_GNRC_IPV6_NIB_NUMOF neighbor cache entries on two interfaces,
+ * removes every second one, re-adds them and then adds one more.
+ * Expected result: _nib_onl_get() always finds exactly the entries currently
+ * in the NIB, also when the last one replaced a garbage-collectible entry
+ */
+static void test_nib_get__many(void)
+{
+    _nib_onl_entry_t *nodes[CONFIG_GNRC_IPV6_NIB_NUMOF];
+    ipv6_addr_t addrs[CONFIG_GNRC_IPV6_NIB_NUMOF];
+    ipv6_addr_t addr = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                  { .u64 = TEST_UINT64 } } };
+    unsigned found = 0;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        addrs[i] = addr;
+        addrs[i].u64[1].u64 += i;
+        TEST_ASSERT_NOT_NULL((nodes[i] = _nib_nc_add(&addrs[i], IFACE + (i % 2),
+                                                     GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE)));
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        TEST_ASSERT(nodes[i] == _nib_onl_get(&addrs[i], IFACE + (i % 2)));
+        TEST_ASSERT(nodes[i] == _nib_onl_get(&addrs[i], 0));
+        TEST_ASSERT_NULL(_nib_onl_get(&addrs[i], IFACE + ((i + 1) % 2)));
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i += 2) {
+        _nib_nc_remove(nodes[i]);
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        if (i % 2) {
+            TEST_ASSERT(nodes[i] == _nib_onl_get(&addrs[i], 0));
+        }
+        else {
+            TEST_ASSERT_NULL(_nib_onl_get(&addrs[i], 0));
+        }
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i += 2) {
+        TEST_ASSERT_NOT_NULL((nodes[i] = _nib_nc_add(&addrs[i], IFACE,
+                                                     GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE)));
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        TEST_ASSERT(nodes[i] == _nib_onl_get(&addrs[i], IFACE + (i % 2)));
+    }
+    /* NIB is full, so an entry is cached out */
+    addr.u64[1].u64 += CONFIG_GNRC_IPV6_NIB_NUMOF;
+    TEST_ASSERT_NOT_NULL(_nib_nc_add(&addr, IFACE,
+                                     GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE));
+    TEST_ASSERT_NOT_NULL(_nib_onl_get(&addr, IFACE));
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        if (_nib_onl_get(&addrs[i], 0) != NULL) {
+            found++;
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_IPV6_NIB_NUMOF - 1, found);
+}
+
 /*
  * Creates CONFIG_GNRC_IPV6_NIB_NUMOF neighbor cache entries with different IP
  * addresses and a non-garbage-collectible AR state and then tries to add
@@ -2072,6 +2128,7 @@ Test *tests_gnrc_ipv6_nib_internal_tests(void)
         new_TestFixture(test_nib_iter__three_elem),
         new_TestFixture(test_nib_iter__three_elem_middle_removed),
         new_TestFixture(test_nib_get__empty),
+        new_TestFixture(test_nib_get__many),
         new_TestFixture(test_nib_get__not_in_nib),
         new_TestFixture(test_nib_get__success),
         new_TestFixture(test_nib_nc_add__no_space_left_diff_addr),
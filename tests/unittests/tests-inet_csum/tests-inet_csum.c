@@ -13,7 +13,9 @@
  */
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 
+#include "container.h"
 #include "embUnit.h"
 
 #include "net/inet_csum.h"
@@ -165,6 +167,100 @@ static void test_inet_csum__empty_app_buffer(void)
     TEST_ASSERT_EQUAL_INT(hdr_expected, pyld_sum);
 }
 
+/* straightforward byte-pair implementation to compare the optimized one to */
+static uint16_t _ref_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len,
+                                size_t accum_len)
+{
+    uint32_t csum = sum;
+
+    if (len == 0) {
+        return csum;
+    }
+    if (accum_len & 1) {
+        csum += *buf;
+        buf++;
+        len--;
+        accum_len++;
+    }
+    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
+        csum += (uint16_t)(*buf << 8) + *(buf + 1);
+    }
+    if ((accum_len + len) & 1) {
+        csum += (uint16_t)(*buf << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+static void _fill(uint8_t *buf, size_t len, uint8_t seed)
+{
+    for (size_t i = 0; i < len; i++) {
+        buf[i] = (uint8_t)(seed + i * 0x9d);
+    }
+}
+
+static void test_inet_csum__alignments(void)
+{
+    static const uint16_t sums[] = { 0x0000, 0x1234, 0xfffe, 0xffff };
+    uint8_t buf[304 + 8];
+
+    for (unsigned align = 0; align < 8; align++) {
+        for (uint16_t len = 0; len <= 304; len += (len < 40) ? 1 : 13) {
+            uint8_t *data = &buf[align];
+
+            _fill(data, len, align + len);
+            for (unsigned i = 0; i < ARRAY_SIZE(sums); i++) {
+                for (size_t accum_len = 0; accum_len < 2; accum_len++) {
+                    TEST_ASSERT_EQUAL_INT(
+                        _ref_csum_slice(sums[i], data, len, accum_len),
+                        inet_csum_slice(sums[i], data, len, accum_len));
+                }
+            }
+        }
+    }
+}
+
+static void test_inet_csum__all_ones(void)
+{
+    uint8_t buf[128 + 1];
+
+    /* a sum of 0xffff must not turn into 0x0000 (or vice versa) */
+    memset(buf, 0xff, sizeof(buf));
+    for (unsigned align = 0; align < 2; align++) {
+        TEST_ASSERT_EQUAL_INT(0xffff, inet_csum_slice(0, &buf[align], 128, 0));
+        TEST_ASSERT_EQUAL_INT(0xffff, inet_csum_slice(0xffff, &buf[align], 128, 0));
+    }
+    memset(buf, 0, sizeof(buf));
+    for (unsigned align = 0; align < 2; align++) {
+        TEST_ASSERT_EQUAL_INT(0x0000, inet_csum_slice(0, &buf[align], 128, 0));
+        TEST_ASSERT_EQUAL_INT(0xffff, inet_csum_slice(0xffff, &buf[align], 128, 1));
+    }
+}
+
+static void test_inet_csum__slice_copy(void)
+{
+    uint8_t src[200 + 4], dst[200 + 4];
+
+    for (unsigned src_align = 0; src_align < 4; src_align++) {
+        for (unsigned dst_align = 0; dst_align < 4; dst_align++) {
+            for (uint16_t len = 0; len <= 200; len += 7) {
+                _fill(src, sizeof(src), src_align * 4 + dst_align);
+                memset(dst, 0, sizeof(dst));
+                TEST_ASSERT_EQUAL_INT(
+                    _ref_csum_slice(0x4242, &src[src_align], len, len & 1),
+                    inet_csum_slice_copy(0x4242, &dst[dst_align],
+                                         &src[src_align], len, len & 1));
+                TEST_ASSERT_EQUAL_INT(0, memcmp(&dst[dst_align],
+                                                &src[src_align], len));
+                /* nothing beyond len is written */
+                TEST_ASSERT_EQUAL_INT(0, dst[dst_align + len]);
+            }
+        }
+    }
+}
+
 Test *tests_inet_csum_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -176,6 +272,9 @@ Test *tests_inet_csum_tests(void)
         new_TestFixture(test_inet_csum__odd_len),
         new_TestFixture(test_inet_csum__two_app_snips),
         new_TestFixture(test_inet_csum__empty_app_buffer),
+        new_TestFixture(test_inet_csum__alignments),
+        new_TestFixture(test_inet_csum__all_ones),
+        new_TestFixture(test_inet_csum__slice_copy),
     };
 
     EMB_UNIT_TESTCALLER(inet_csum_tests, NULL, NULL, fixtures);
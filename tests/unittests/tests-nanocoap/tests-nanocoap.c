@@ -974,6 +974,57 @@ static void test_nanocoap__options_iterate(void)
     }
 }
 
+/*
+ * Tests finding present and absent options in a built packet with repeated
+ * options, in the parsed packet and after removing options.
+ */
+static void test_nanocoap__options_find(void)
+{
+    uint8_t buf[_BUF_SIZE];
+    coap_pkt_t pkt;
+    uint8_t path[CONFIG_NANOCOAP_URI_MAX];
+    uint32_t value;
+    size_t len = coap_build_hdr((coap_hdr_t *)&buf[0], COAP_TYPE_CON, NULL, 0,
+                                COAP_METHOD_GET, 1);
+
+    coap_pkt_init(&pkt, &buf[0], sizeof(buf), len);
+    TEST_ASSERT(coap_opt_add_uri_path(&pkt, "/a/b/c") > 0);
+    TEST_ASSERT(coap_opt_add_uri_query(&pkt, "k", "v") > 0);
+    TEST_ASSERT(coap_opt_add_uint(&pkt, COAP_OPT_ACCEPT, 50) > 0);
+    TEST_ASSERT(coap_opt_add_uint(&pkt, COAP_OPT_SIZE1, 100) > 0);
+    TEST_ASSERT(coap_opt_add_uint(&pkt, COAP_OPT_NO_RESPONSE, 26) > 0);
+
+    for (unsigned i = 0; i < 2; i++) {
+        TEST_ASSERT_NULL(coap_find_option(&pkt, COAP_OPT_OBSERVE));
+        TEST_ASSERT_NULL(coap_find_option(&pkt, COAP_OPT_BLOCK2));
+        TEST_ASSERT_NULL(coap_find_option(&pkt, COAP_OPT_PROXY_URI));
+        TEST_ASSERT_EQUAL_INT(50, coap_get_accept(&pkt));
+        TEST_ASSERT_EQUAL_INT(0, coap_opt_get_uint(&pkt, COAP_OPT_SIZE1, &value));
+        TEST_ASSERT_EQUAL_INT(100, value);
+        TEST_ASSERT_EQUAL_INT(0, coap_opt_get_uint(&pkt, COAP_OPT_NO_RESPONSE,
+                                                   &value));
+        TEST_ASSERT_EQUAL_INT(26, value);
+        TEST_ASSERT_EQUAL_INT(7, coap_get_uri_path(&pkt, path));
+        TEST_ASSERT_EQUAL_STRING("/a/b/c", (char *)path);
+
+        /* once more in the parsed packet */
+        TEST_ASSERT_EQUAL_INT(0, coap_parse(&pkt, &buf[0],
+                                            coap_opt_finish(&pkt, COAP_OPT_FINISH_NONE)));
+    }
+
+    /* remove the first of the repeated options */
+    coap_pkt_init(&pkt, &buf[0], sizeof(buf), len);
+    TEST_ASSERT(coap_opt_add_uri_path(&pkt, "/a/b") > 0);
+    TEST_ASSERT(coap_opt_add_uint(&pkt, COAP_OPT_ACCEPT, 50) > 0);
+    TEST_ASSERT(coap_opt_remove(&pkt, COAP_OPT_URI_PATH) > 0);
+    TEST_ASSERT_EQUAL_INT(3, coap_get_uri_path(&pkt, path));
+    TEST_ASSERT_EQUAL_STRING("/b", (char *)path);
+    TEST_ASSERT_EQUAL_INT(50, coap_get_accept(&pkt));
+    TEST_ASSERT(coap_opt_remove(&pkt, COAP_OPT_URI_PATH) > 0);
+    TEST_ASSERT_NULL(coap_find_option(&pkt, COAP_OPT_URI_PATH));
+    TEST_ASSERT_EQUAL_INT(50, coap_get_accept(&pkt));
+}
+
 /*
  * Tests use of coap_opt_get_opaque() to find an option as a byte array, and
  * coap_opt_get_next() to find a second option with the same option number.
@@ -1311,6 +1362,7 @@ Test *tests_nanocoap_tests(void)
         new_TestFixture(test_nanocoap__option_remove_no_payload),
         new_TestFixture(test_nanocoap__options_get_opaque),
         new_TestFixture(test_nanocoap__options_iterate),
+        new_TestFixture(test_nanocoap__options_find),
         new_TestFixture(test_nanocoap__server_get_req),
         new_TestFixture(test_nanocoap__server_reply_simple),
         new_TestFixture(test_nanocoap__server_get_req_con),
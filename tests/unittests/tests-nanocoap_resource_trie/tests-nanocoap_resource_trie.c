@@ -0,0 +1,184 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "embUnit.h"
+
+#include "net/nanocoap/resource_trie.h"
+
+#include "tests-nanocoap_resource_trie.h"
+
+static const coap_resource_t _resources[] = {
+    { "/", COAP_GET, NULL, NULL },
+    { "/3/0", COAP_GET, NULL, NULL },
+    { "/3/0/1", COAP_GET | COAP_PUT, NULL, NULL },
+    { "/3/0/1", COAP_POST, NULL, NULL },
+    { "/3/0/1", COAP_PUT, NULL, NULL },
+    { "/3/0/10", COAP_GET, NULL, NULL },
+    { "/3/0/2", COAP_GET, NULL, NULL },
+    { "/4", COAP_GET | COAP_MATCH_SUBTREE, NULL, NULL },
+    { "/4/0/1", COAP_GET | COAP_POST, NULL, NULL },
+    { "/5/", COAP_POST | COAP_MATCH_SUBTREE, NULL, NULL },
+    { "/5/0", COAP_GET, NULL, NULL },
+    { "/6/fw", COAP_GET | COAP_MATCH_SUBTREE, NULL, NULL },
+    { "/6/fw", COAP_PUT, NULL, NULL },
+    { "/6/fw", COAP_PUT | COAP_MATCH_SUBTREE, NULL, NULL },
+    { "/a//b", COAP_GET, NULL, NULL },
+};
+
+static const char *_uris[] = {
+    "/", "//", "/3", "/3/", "/3/0", "/3/0/", "/3/0/1", "/3/0/10", "/3/0/100",
+    "/3/0/2", "/3/1/1", "/4", "/40", "/4/0/1", "/4/0/1/2", "/5", "/5/", "/5/0",
+    "/5/01", "/6", "/6/f", "/6/fw", "/6/fwx", "/6/fw/1", "/a", "/a/", "/a//b",
+    "/a/b", "/7/0/1",
+};
+
+static const coap_method_flags_t _methods[] = {
+    COAP_GET, COAP_POST, COAP_PUT, COAP_DELETE,
+};
+
+static coap_resource_t _many[CONFIG_NANOCOAP_RESOURCE_TRIE_NODES + 1];
+static char _many_paths[ARRAY_SIZE(_many)][8];
+
+/* the linear search of coap_tree_handler() and gcoap */
+static int _find_linear(const char *uri, coap_method_flags_t method_flag,
+                        const coap_resource_t **resource)
+{
+    int res = -ENOENT;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_resources); i++) {
+        if (coap_match_path(&_resources[i], (const uint8_t *)uri) != 0) {
+            continue;
+        }
+        if (_resources[i].methods & method_flag) {
+            *resource = &_resources[i];
+            return 0;
+        }
+        res = -ENOTSUP;
+    }
+    return res;
+}
+
+static void test_nanocoap_resource_trie__find(void)
+{
+    coap_resource_trie_t trie;
+    const coap_resource_t *resource = NULL;
+
+    TEST_ASSERT_EQUAL_INT(0, coap_resource_trie_init(&trie, _resources,
+                                                     ARRAY_SIZE(_resources)));
+    TEST_ASSERT_EQUAL_INT(0, coap_resource_trie_find(&trie, "/3/0/1", COAP_GET,
+                                                     &resource));
+    TEST_ASSERT(resource == &_resources[2]);
+    TEST_ASSERT_EQUAL_INT(0, coap_resource_trie_find(&trie, "/3/0/1", COAP_POST,
+                                                     &resource));
+    TEST_ASSERT(resource == &_resources[3]);
+    /* the first of two resources allowing the method */
+    TEST_ASSERT_EQUAL_INT(0, coap_resource_trie_find(&trie, "/3/0/1", COAP_PUT,
+                                                     &resource));
+    TEST_ASSERT(resource == &_resources[2]);
+    TEST_ASSERT_EQUAL_INT(-ENOTSUP,
+                          coap_resource_trie_find(&trie, "/3/0/1", COAP_DELETE,
+                                                  &resource));
+    TEST_ASSERT_EQUAL_INT(-ENOENT,
+                          coap_resource_trie_find(&trie, "/3/0/3", COAP_GET,
+                                                  &resource));
+    /* the subtree resource comes first */
+    TEST_ASSERT_EQUAL_INT(0, coap_resource_trie_find(&trie, "/4/0/1", COAP_GET,
+                                                     &resource));
+    TEST_ASSERT(resource == &_resources[7]);
+    TEST_ASSERT_EQUAL_INT(0, coap_resource_trie_find(&trie, "/4/0/1", COAP_POST,
+                                                     &resource));
+    TEST_ASSERT(resource == &_resources[8]);
+}
+
+static void test_nanocoap_resource_trie__same_as_linear(void)
+{
+    coap_resource_trie_t trie;
+
+    TEST_ASSERT_EQUAL_INT(0, coap_resource_trie_init(&trie, _resources,
+                                                     ARRAY_SIZE(_resources)));
+    for (unsigned i = 0; i < ARRAY_SIZE(_uris); i++) {
+        for (unsigned j = 0; j < ARRAY_SIZE(_methods); j++) {
+            const coap_resource_t *exp = NULL, *res = NULL;
+            int exp_ret = _find_linear(_uris[i], _methods[j], &exp);
+            int ret = coap_resource_trie_find(&trie, _uris[i], _methods[j],
+                                              &res);
+
+            TEST_ASSERT_EQUAL_INT(exp_ret, ret);
+            TEST_ASSERT(exp == res);
+        }
+    }
+}
+
+static void test_nanocoap_resource_trie__empty(void)
+{
+    coap_resource_trie_t trie;
+    const coap_resource_t *resource;
+
+    TEST_ASSERT_EQUAL_INT(0, coap_resource_trie_init(&trie, _resources, 0));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, coap_resource_trie_find(&trie, "/", COAP_GET,
+                                                           &resource));
+}
+
+static void test_nanocoap_resource_trie__invalid(void)
+{
+    static const coap_resource_t resources[] = {
+        { "/a", COAP_GET, NULL, NULL },
+        { "b", COAP_GET, NULL, NULL },
+    };
+    coap_resource_trie_t trie;
+
+    TEST_ASSERT_EQUAL_INT(-EINVAL, coap_resource_trie_init(&trie, resources,
+                                                           ARRAY_SIZE(resources)));
+}
+
+static void test_nanocoap_resource_trie__no_space(void)
+{
+    coap_resource_trie_t trie;
+    const coap_resource_t *resource = NULL;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_many); i++) {
+        snprintf(_many_paths[i], sizeof(_many_paths[i]), "/%u", i);
+        _many[i] = (coap_resource_t){ .path = _many_paths[i],
+                                      .methods = COAP_GET };
+    }
+    TEST_ASSERT_EQUAL_INT(-ENOMEM, coap_resource_trie_init(&trie, _many,
+                                                           ARRAY_SIZE(_many)));
+    /* the nodes of the failed trie are available again */
+    TEST_ASSERT_EQUAL_INT(0, coap_resource_trie_init(&trie, _many, 8));
+    TEST_ASSERT_EQUAL_INT(0, coap_resource_trie_find(&trie, "/7", COAP_GET,
+                                                     &resource));
+    TEST_ASSERT(resource == &_many[7]);
+}
+
+Test *tests_nanocoap_resource_trie_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_nanocoap_resource_trie__find),
+        new_TestFixture(test_nanocoap_resource_trie__same_as_linear),
+        new_TestFixture(test_nanocoap_resource_trie__empty),
+        new_TestFixture(test_nanocoap_resource_trie__invalid),
+        new_TestFixture(test_nanocoap_resource_trie__no_space),
+    };
+
+    EMB_UNIT_TESTCALLER(nanocoap_resource_trie_tests, NULL, NULL, fixtures);
+
+    return (Test *)&nanocoap_resource_trie_tests;
+}
+
+void tests_nanocoap_resource_trie(void)
+{
+    TESTS_RUN(tests_nanocoap_resource_trie_tests());
+}
+/** @} */
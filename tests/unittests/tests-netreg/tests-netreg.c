@@ -13,6 +13,8 @@
  */
 #include <errno.h>
 
+#include "container.h"
+
 #include "embUnit.h"
 
 #include "net/gnrc/netreg.h"
@@ -185,6 +187,54 @@ void test_netreg_getnext__2_entries(void)
     gnrc_netreg_release_shared();
 }
 
+void test_netreg_lookup__other_type(void)
+{
+    gnrc_netreg_entry_t *res = NULL;
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &entries[0]));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &entries[1]));
+    gnrc_netreg_acquire_shared();
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_TEST, TEST_UINT16));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_UNDEF, TEST_UINT16));
+    TEST_ASSERT_NOT_NULL((res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16)));
+    TEST_ASSERT(&entries[0] == res);
+    TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+    TEST_ASSERT_NOT_NULL((res = gnrc_netreg_lookup(GNRC_NETTYPE_UNDEF, TEST_UINT16)));
+    TEST_ASSERT(&entries[1] == res);
+    TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+    gnrc_netreg_release_shared();
+    gnrc_netreg_unregister(GNRC_NETTYPE_UNDEF, &entries[1]);
+}
+
+void test_netreg_lookup__many_entries(void)
+{
+    static gnrc_netreg_entry_t many[32];
+    gnrc_netreg_entry_t *res;
+
+    /* two entries per context, so every context is a multi-subscriber one */
+    for (unsigned i = 0; i < ARRAY_SIZE(many); i++) {
+        gnrc_netreg_entry_init_pid(&many[i], i / 2, TEST_UINT8);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &many[i]));
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(many); i += 4) {
+        gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &many[i]);
+    }
+    gnrc_netreg_acquire_shared();
+    for (unsigned ctx = 0; ctx < ARRAY_SIZE(many) / 2; ctx++) {
+        int num = (ctx % 2) ? 2 : 1;
+        TEST_ASSERT_EQUAL_INT(num, gnrc_netreg_num(GNRC_NETTYPE_TEST, ctx));
+        res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST, ctx);
+        while (res) {
+            TEST_ASSERT_EQUAL_INT(ctx, res->demux_ctx);
+            num--;
+            res = gnrc_netreg_getnext(res);
+        }
+        TEST_ASSERT_EQUAL_INT(0, num);
+    }
+    TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_TEST, ARRAY_SIZE(many)));
+    gnrc_netreg_release_shared();
+}
+
 Test *tests_netreg_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -201,6 +251,8 @@ Test *tests_netreg_tests(void)
         new_TestFixture(test_netreg_num__2_entries),
         new_TestFixture(test_netreg_getnext__NULL),
         new_TestFixture(test_netreg_getnext__2_entries),
+        new_TestFixture(test_netreg_lookup__other_type),
+        new_TestFixture(test_netreg_lookup__many_entries),
     };
 
     EMB_UNIT_TESTCALLER(netreg_tests, set_up, NULL, fixtures);
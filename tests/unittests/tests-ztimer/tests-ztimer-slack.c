@@ -0,0 +1,172 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unit tests for ztimer_set_slack()
+ */
+
+#include "ztimer.h"
+#include "ztimer/mock.h"
+
+#include "embUnit/embUnit.h"
+
+#include "tests-ztimer.h"
+
+typedef struct {
+    ztimer_mock_t *zmock;
+    uint32_t fired_at;
+    unsigned count;
+} slack_alarm_t;
+
+static void _cb(void *arg)
+{
+    slack_alarm_t *alarm = arg;
+
+    alarm->fired_at = alarm->zmock->now;
+    alarm->count++;
+}
+
+/**
+ * @brief   A slack timer rides along with a timer due within its window
+ */
+static void test_ztimer_slack_ride_along(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    slack_alarm_t a = { .zmock = &zmock }, b = { .zmock = &zmock };
+    ztimer_t precise = { .callback = _cb, .arg = &a };
+    ztimer_t loose = { .callback = _cb, .arg = &b };
+
+    ztimer_mock_init(&zmock, 32);
+    ztimer_set(z, &precise, 1000);
+    ztimer_set_slack(z, &loose, 900, 200);
+
+    ztimer_mock_advance(&zmock, 999);
+    TEST_ASSERT_EQUAL_INT(0, a.count + b.count);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(1, a.count);
+    TEST_ASSERT_EQUAL_INT(1, b.count);
+    TEST_ASSERT_EQUAL_INT(1000, a.fired_at);
+    TEST_ASSERT_EQUAL_INT(1000, b.fired_at);
+    TEST_ASSERT_EQUAL_INT(2, z->fired);
+    TEST_ASSERT_EQUAL_INT(1, z->coalesced);
+}
+
+/**
+ * @brief   Slack timers are aligned, so they share their expiration, while
+ *          precise timers keep their target
+ */
+static void test_ztimer_slack_align(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    slack_alarm_t a = { .zmock = &zmock }, b = { .zmock = &zmock },
+                  c = { .zmock = &zmock };
+    ztimer_t precise = { .callback = _cb, .arg = &a };
+    ztimer_t loose1 = { .callback = _cb, .arg = &b };
+    ztimer_t loose2 = { .callback = _cb, .arg = &c };
+
+    ztimer_mock_init(&zmock, 32);
+    ztimer_mock_advance(&zmock, 7);
+    ztimer_set(z, &precise, 100);
+    /* [7 + 150, 7 + 150 + 50] is aligned to 32: 160 */
+    ztimer_set_slack(z, &loose1, 150, 50);
+    ztimer_mock_advance(&zmock, 3);
+    /* [10 + 140, 10 + 140 + 40] includes 160 */
+    ztimer_set_slack(z, &loose2, 140, 40);
+
+    ztimer_mock_advance(&zmock, 97);
+    TEST_ASSERT_EQUAL_INT(1, a.count);
+    TEST_ASSERT_EQUAL_INT(107, a.fired_at);
+    ztimer_mock_advance(&zmock, 52);
+    TEST_ASSERT_EQUAL_INT(0, b.count + c.count);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(1, b.count);
+    TEST_ASSERT_EQUAL_INT(1, c.count);
+    TEST_ASSERT_EQUAL_INT(160, b.fired_at);
+    TEST_ASSERT_EQUAL_INT(160, c.fired_at);
+    TEST_ASSERT_EQUAL_INT(3, z->fired);
+    TEST_ASSERT_EQUAL_INT(1, z->coalesced);
+}
+
+typedef struct {
+    ztimer_clock_t *clock;
+    ztimer_t *timer;
+} rearm_t;
+
+static void _rearm_cb(void *arg)
+{
+    rearm_t *rearm = arg;
+
+    ztimer_set(rearm->clock, rearm->timer, 0);
+}
+
+/**
+ * @brief   Timers collected in the same interrupt after a callback set them
+ *          are not counted as coalesced
+ */
+static void test_ztimer_slack_rearm(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    slack_alarm_t a = { .zmock = &zmock };
+    ztimer_t next = { .callback = _cb, .arg = &a };
+    rearm_t rearm = { .clock = z, .timer = &next };
+    ztimer_t first = { .callback = _rearm_cb, .arg = &rearm };
+
+    ztimer_mock_init(&zmock, 32);
+    ztimer_set(z, &first, 100);
+    ztimer_mock_advance(&zmock, 100);
+    TEST_ASSERT_EQUAL_INT(1, a.count);
+    TEST_ASSERT_EQUAL_INT(100, a.fired_at);
+    TEST_ASSERT_EQUAL_INT(2, z->fired);
+    TEST_ASSERT_EQUAL_INT(0, z->coalesced);
+}
+
+/**
+ * @brief   Without slack, the timer fires at its exact target
+ */
+static void test_ztimer_slack_none(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    slack_alarm_t a = { .zmock = &zmock };
+    ztimer_t t = { .callback = _cb, .arg = &a };
+
+    ztimer_mock_init(&zmock, 32);
+    ztimer_mock_advance(&zmock, 5);
+    ztimer_set_slack(z, &t, 123, 0);
+    ztimer_mock_advance(&zmock, 1000);
+    TEST_ASSERT_EQUAL_INT(1, a.count);
+    TEST_ASSERT_EQUAL_INT(128, a.fired_at);
+    TEST_ASSERT_EQUAL_INT(1, z->fired);
+    TEST_ASSERT_EQUAL_INT(0, z->coalesced);
+
+    /* the window is capped at the largest possible target */
+    ztimer_set_slack(z, &t, UINT32_MAX - 1, UINT32_MAX);
+    TEST_ASSERT(ztimer_is_set(z, &t));
+    ztimer_mock_advance(&zmock, UINT32_MAX - 2);
+    TEST_ASSERT_EQUAL_INT(1, a.count);
+    ztimer_remove(z, &t);
+}
+
+Test *tests_ztimer_slack_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_ztimer_slack_ride_along),
+        new_TestFixture(test_ztimer_slack_align),
+        new_TestFixture(test_ztimer_slack_none),
+        new_TestFixture(test_ztimer_slack_rearm),
+    };
+
+    EMB_UNIT_TESTCALLER(ztimer_tests, NULL, NULL, fixtures);
+
+    return (Test *)&ztimer_tests;
+}
+
+/** @} */
@@ -0,0 +1,287 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unit tests for ztimer_wheel
+ */
+
+#include <string.h>
+
+#include "ztimer.h"
+#include "ztimer/mock.h"
+#include "ztimer/wheel.h"
+
+#include "embUnit/embUnit.h"
+
+#include "tests-ztimer.h"
+
+#define TIMERS_NUMOF    (24U)
+#define RANDOM_ROUNDS   (2000U)
+
+typedef struct {
+    ztimer_t timer;
+    ztimer_mock_t *zmock;
+    uint32_t fired_at;
+    unsigned count;
+} wheel_alarm_t;
+
+static ztimer_wheel_t _wheel;
+static ztimer_mock_t _zmock;
+static wheel_alarm_t _alarms[TIMERS_NUMOF];
+static unsigned _order[TIMERS_NUMOF];
+static unsigned _fired;
+
+static void _cb(void *arg)
+{
+    wheel_alarm_t *alarm = arg;
+
+    alarm->fired_at = alarm->zmock->now;
+    alarm->count++;
+    _order[_fired++ % TIMERS_NUMOF] = alarm - _alarms;
+}
+
+static void _init(unsigned width)
+{
+    ztimer_mock_init(&_zmock, width);
+    ztimer_wheel_init(&_zmock.super, &_wheel);
+    memset(_alarms, 0, sizeof(_alarms));
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        _alarms[i].timer.callback = _cb;
+        _alarms[i].timer.arg = &_alarms[i];
+        _alarms[i].zmock = &_zmock;
+    }
+    _fired = 0;
+}
+
+/* simple xorshift, so the test does not depend on the random module */
+static uint32_t _rand(void)
+{
+    static uint32_t state = 0x2545f491;
+
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+/**
+ * @brief   Timers set in arbitrary order fire in order of their targets
+ */
+static void test_ztimer_wheel_order(void)
+{
+    static const uint32_t offsets[] = {
+        1000, 3, 70000, 17, 0, 256, 255, 0x10000000ul, 4096, 4095,
+    };
+    ztimer_clock_t *z = &_zmock.super;
+
+    _init(32);
+    for (unsigned i = 0; i < ARRAY_SIZE(offsets); i++) {
+        ztimer_set(z, &_alarms[i].timer, offsets[i]);
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(offsets); i++) {
+        TEST_ASSERT(ztimer_is_set(z, &_alarms[i].timer));
+    }
+
+    ztimer_mock_advance(&_zmock, 0x10000000ul);
+    TEST_ASSERT_EQUAL_INT(ARRAY_SIZE(offsets), _fired);
+
+    static const unsigned expected[] = { 4, 1, 3, 6, 5, 0, 9, 8, 2, 7 };
+    for (unsigned i = 0; i < ARRAY_SIZE(expected); i++) {
+        TEST_ASSERT_EQUAL_INT(expected[i], _order[i]);
+        TEST_ASSERT_EQUAL_INT(offsets[expected[i]],
+                              _alarms[expected[i]].fired_at);
+        TEST_ASSERT(!ztimer_is_set(z, &_alarms[expected[i]].timer));
+    }
+    TEST_ASSERT_EQUAL_INT(0, _zmock.armed);
+}
+
+/**
+ * @brief   Removing timers, including the earliest one, keeps the others
+ */
+static void test_ztimer_wheel_remove(void)
+{
+    ztimer_clock_t *z = &_zmock.super;
+
+    _init(32);
+    ztimer_set(z, &_alarms[0].timer, 100);
+    ztimer_set(z, &_alarms[1].timer, 200);
+    ztimer_set(z, &_alarms[2].timer, 200);
+    ztimer_set(z, &_alarms[3].timer, 5000);
+
+    TEST_ASSERT(ztimer_remove(z, &_alarms[0].timer));
+    TEST_ASSERT(!ztimer_remove(z, &_alarms[0].timer));
+    TEST_ASSERT(ztimer_remove(z, &_alarms[2].timer));
+    TEST_ASSERT(_zmock.armed);
+
+    ztimer_mock_advance(&_zmock, 199);
+    TEST_ASSERT_EQUAL_INT(0, _fired);
+    ztimer_mock_advance(&_zmock, 1);
+    TEST_ASSERT_EQUAL_INT(1, _fired);
+    TEST_ASSERT_EQUAL_INT(1, _alarms[1].count);
+
+    TEST_ASSERT(ztimer_remove(z, &_alarms[3].timer));
+    TEST_ASSERT_EQUAL_INT(0, _zmock.armed);
+    ztimer_mock_advance(&_zmock, 10000);
+    TEST_ASSERT_EQUAL_INT(1, _fired);
+}
+
+/**
+ * @brief   Timers that were never set may contain anything
+ */
+static void test_ztimer_wheel_uninitialized(void)
+{
+    ztimer_clock_t *z = &_zmock.super;
+
+    _init(32);
+    ztimer_set(z, &_alarms[0].timer, 200);
+    ztimer_set(z, &_alarms[1].timer, 200);
+
+    /* garbage links */
+    memset(&_alarms[2].timer, 0xa5, sizeof(_alarms[2].timer));
+    _alarms[2].timer.callback = _cb;
+    _alarms[2].timer.arg = &_alarms[2];
+    TEST_ASSERT(!ztimer_is_set(z, &_alarms[2].timer));
+    ztimer_set(z, &_alarms[2].timer, 100);
+
+    /* stale copies of the links of timers that are set, one pointing into
+     * the slot array and one pointing to the other timer in that slot */
+    memcpy(&_alarms[3].timer.base, &_alarms[0].timer.base,
+           sizeof(_alarms[3].timer.base));
+    memcpy(&_alarms[4].timer.base, &_alarms[1].timer.base,
+           sizeof(_alarms[4].timer.base));
+    TEST_ASSERT(!ztimer_is_set(z, &_alarms[3].timer));
+    TEST_ASSERT(!ztimer_is_set(z, &_alarms[4].timer));
+    TEST_ASSERT(!ztimer_remove(z, &_alarms[3].timer));
+    ztimer_set(z, &_alarms[3].timer, 300);
+    ztimer_set(z, &_alarms[4].timer, 300);
+
+    ztimer_mock_advance(&_zmock, 300);
+    TEST_ASSERT_EQUAL_INT(5, _fired);
+    for (unsigned i = 0; i < 5; i++) {
+        TEST_ASSERT_EQUAL_INT(1, _alarms[i].count);
+    }
+    TEST_ASSERT_EQUAL_INT(100, _alarms[2].fired_at);
+    TEST_ASSERT_EQUAL_INT(200, _alarms[0].fired_at);
+    TEST_ASSERT_EQUAL_INT(200, _alarms[1].fired_at);
+    TEST_ASSERT_EQUAL_INT(300, _alarms[3].fired_at);
+    TEST_ASSERT_EQUAL_INT(300, _alarms[4].fired_at);
+}
+
+/**
+ * @brief   Timers across the 32 bit wrap-around of the base time
+ */
+static void test_ztimer_wheel_wrap(void)
+{
+    ztimer_clock_t *z = &_zmock.super;
+
+    _init(32);
+    ztimer_mock_jump(&_zmock, 0xfffffff0ul);
+    ztimer_set(z, &_alarms[0].timer, 0x20);
+    ztimer_set(z, &_alarms[1].timer, 0xfffffff0ul);
+    ztimer_set(z, &_alarms[2].timer, 0x8);
+
+    ztimer_mock_advance(&_zmock, 0x8);
+    TEST_ASSERT_EQUAL_INT(1, _alarms[2].count);
+    TEST_ASSERT_EQUAL_INT(0xfffffff8ul, _alarms[2].fired_at);
+    ztimer_mock_advance(&_zmock, 0x18);
+    TEST_ASSERT_EQUAL_INT(1, _alarms[0].count);
+    TEST_ASSERT_EQUAL_INT(0x10, _alarms[0].fired_at);
+    TEST_ASSERT_EQUAL_INT(0, _alarms[1].count);
+    ztimer_mock_advance(&_zmock, 0xffffffcful);
+    TEST_ASSERT_EQUAL_INT(0, _alarms[1].count);
+    ztimer_mock_advance(&_zmock, 1);
+    TEST_ASSERT_EQUAL_INT(1, _alarms[1].count);
+    TEST_ASSERT_EQUAL_INT(0xffffffe0ul, _alarms[1].fired_at);
+}
+
+/**
+ * @brief   Timers on a wheel of an extended 16 bit clock
+ */
+static void test_ztimer_wheel_extend(void)
+{
+    ztimer_clock_t *z = &_zmock.super;
+
+    _init(16);
+    ztimer_set(z, &_alarms[0].timer, 0x23456);
+    ztimer_set(z, &_alarms[1].timer, 0x1000);
+
+    ztimer_mock_advance(&_zmock, 0x1000);
+    TEST_ASSERT_EQUAL_INT(1, _alarms[1].count);
+    ztimer_mock_advance(&_zmock, 0x22455);
+    TEST_ASSERT_EQUAL_INT(0, _alarms[0].count);
+    ztimer_mock_advance(&_zmock, 1);
+    TEST_ASSERT_EQUAL_INT(1, _alarms[0].count);
+    TEST_ASSERT_EQUAL_INT(0x3456, _alarms[0].fired_at);
+}
+
+/**
+ * @brief   Random sets, removes and clock advances fire every timer exactly
+ *          at its target
+ */
+static void test_ztimer_wheel_random(void)
+{
+    ztimer_clock_t *z = &_zmock.super;
+    uint32_t target[TIMERS_NUMOF];
+    bool armed[TIMERS_NUMOF] = { false };
+
+    _init(32);
+    ztimer_mock_jump(&_zmock, 0xffff0000ul);
+
+    for (unsigned round = 0; round < RANDOM_ROUNDS; round++) {
+        unsigned i = _rand() % TIMERS_NUMOF;
+        uint32_t r = _rand();
+
+        switch (r % 4) {
+        case 0:
+        case 1: {
+            /* mix short and long timeouts */
+            uint32_t offset = (r & 0x100) ? (_rand() >> (r % 32)) : (r >> 24);
+            ztimer_set(z, &_alarms[i].timer, offset);
+            target[i] = _zmock.now + offset;
+            armed[i] = true;
+            _alarms[i].count = 0;
+            break;
+        }
+        case 2:
+            TEST_ASSERT_EQUAL_INT(armed[i], ztimer_remove(z, &_alarms[i].timer));
+            armed[i] = false;
+            break;
+        default: {
+            uint32_t step = (_rand() >> (8 + (r % 24))) + 1;
+            uint32_t start = _zmock.now;
+            ztimer_mock_advance(&_zmock, step);
+            for (unsigned j = 0; j < TIMERS_NUMOF; j++) {
+                if (armed[j] && ((target[j] - start) <= step)) {
+                    TEST_ASSERT_EQUAL_INT(1, _alarms[j].count);
+                    TEST_ASSERT_EQUAL_INT(target[j], _alarms[j].fired_at);
+                    armed[j] = false;
+                }
+                TEST_ASSERT_EQUAL_INT(armed[j], ztimer_is_set(z, &_alarms[j].timer));
+            }
+        }
+        }
+    }
+}
+
+Test *tests_ztimer_wheel_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_ztimer_wheel_order),
+        new_TestFixture(test_ztimer_wheel_remove),
+        new_TestFixture(test_ztimer_wheel_uninitialized),
+        new_TestFixture(test_ztimer_wheel_wrap),
+        new_TestFixture(test_ztimer_wheel_extend),
+        new_TestFixture(test_ztimer_wheel_random),
+    };
+
+    EMB_UNIT_TESTCALLER(ztimer_tests, NULL, NULL, fixtures);
+
+    return (Test *)&ztimer_tests;
+}
+
+/** @} */